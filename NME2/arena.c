@@ -0,0 +1,83 @@
+#include "arena.h"
+
+#include "utils.h"
+
+static size_t align_up(size_t size) {
+    return (size + ARENA_ALIGNMENT - 1) & ~(size_t)(ARENA_ALIGNMENT - 1);
+}
+
+arena new_arena(size_t capacity) {
+    arena a;
+    a.capacity = capacity ? align_up(capacity) : ARENA_DEFAULT_CAPACITY;
+    a.data = malloc(a.capacity);
+    a.used = 0;
+    a.overflow = NULL;
+    a.overflow_bytes = 0;
+
+    if (a.data == NULL) {
+        perrf("Out of memory allocating %zu bytes of scratch space\n", a.capacity);
+
+        exit(1);
+    }
+
+    return a;
+}
+
+void* arena_alloc(arena* a, size_t size) {
+    size = align_up(size ? size : 1);
+
+    if (size <= a->capacity - a->used) {
+        void* p = &a->data[a->used];
+        a->used += size;
+
+        return p;
+    }
+
+    // The header is padded so the allocation after it stays aligned
+    size_t header = align_up(sizeof(arena_overflow));
+    arena_overflow* o = malloc(header + size);
+    if (o == NULL) {
+        perrf("Out of memory allocating %zu bytes of scratch space\n", size);
+
+        exit(1);
+    }
+
+    o->next = a->overflow;
+    o->size = size;
+    a->overflow = o;
+    a->overflow_bytes += size;
+
+    return (uint8_t*)o + header;
+}
+
+void reset_arena(arena* a) {
+    while (a->overflow != NULL) {
+        arena_overflow* next = a->overflow->next;
+        free(a->overflow);
+        a->overflow = next;
+    }
+
+    // Grow to the high water mark, so the same round fits in the block next time
+    if (a->overflow_bytes > 0) {
+        size_t capacity = a->capacity + a->overflow_bytes;
+        uint8_t* data = malloc(capacity);
+
+        if (data != NULL) {
+            free(a->data);
+            a->data = data;
+            a->capacity = capacity;
+        }
+
+        a->overflow_bytes = 0;
+    }
+
+    a->used = 0;
+}
+
+void free_arena(arena* a) {
+    reset_arena(a);
+
+    free(a->data);
+    a->data = NULL;
+    a->capacity = 0;
+}
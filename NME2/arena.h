@@ -0,0 +1,38 @@
+#pragma once
+
+#include "defs.h"
+
+// Size of the first block of an arena created with a capacity of 0
+#define ARENA_DEFAULT_CAPACITY (64 * 1024)
+
+// Alignment of every allocation made from an arena
+#define ARENA_ALIGNMENT 16
+
+// An allocation that didn't fit in the block of an arena
+typedef struct arena_overflow {
+    struct arena_overflow* next;
+    size_t size;
+} arena_overflow;
+
+// A bump allocator for temporaries that all die at the same time, freed together by reset_arena
+typedef struct arena {
+    uint8_t* data;
+    size_t capacity;
+    size_t used;
+
+    // Allocations made after the block filled up, folded into the block on the next reset
+    arena_overflow* overflow;
+    size_t overflow_bytes;
+} arena;
+
+// Creates an arena whose block holds capacity bytes (ARENA_DEFAULT_CAPACITY for 0)
+arena new_arena(size_t capacity);
+
+// Allocates size bytes from the arena, valid until the next reset_arena. Exits on out of memory
+void* arena_alloc(arena* a, size_t size);
+
+// Frees all allocations of the arena at once, growing its block if the last round overflowed
+void reset_arena(arena* a);
+
+// Frees the arena and all its allocations
+void free_arena(arena* a);
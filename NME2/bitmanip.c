@@ -1,17 +1,10 @@
 #include "bitmanip.h"
+#include "cpu.h"
+#include "crc.h"
 
-uint64_t split_bytes(char* search, uint64_t search_len, char* delimiter, uint64_t delimiter_len, uint64_t start) {
-    uint64_t pointer = start;
-
-    while (memcmp(&search[pointer], delimiter, delimiter_len) != 0) {
-        if (pointer >= search_len) {
-            return -1;
-        }
-        pointer++;
-    }
-
-    return (pointer == 0) ? 0 : pointer - 1;
-}
+#if CPU_X86
+#include <immintrin.h>
+#endif
 
 uint16_t read_16_buf(unsigned char b[2]) {
     uint16_t v = 0;
@@ -45,6 +38,15 @@ uint32_t read_32_membuf(membuf* buf) {
     return val;
 }
 
+membuf new_membuf(char* data, uint64_t size) {
+    membuf buf;
+    buf.data = data;
+    buf.size = size;
+    buf.pos = 0;
+
+    return buf;
+}
+
 uint_var new_uint_var(uint32_t v, uint64_t bit_size) {
     uint_var bit;
     bit.value = v;
@@ -52,106 +54,345 @@ uint_var new_uint_var(uint32_t v, uint64_t bit_size) {
     return bit;
 }
 
-ogg_output_stream new_ogg_output_stream(FILE* stream) {
+ogg_output_stream new_ogg_output_stream(ogg_sink* sink, uint32_t page_target) {
     ogg_output_stream s;
-    s.out_stream = stream;
-    s.bit_buffer = 0;
-    s.bits_stored = 0;
-    s.payload_bytes = 0;
-    s.granule = 0;
-    s.seqno = 0;
-    s.first = false;
-    s.continued = false;
+    reset_ogg_output_stream(&s, sink, page_target);
 
     return s;
 }
 
-void ogg_write(ogg_output_stream* os, uint_var bits) {
-    for (unsigned int i = 0; i < bits.n_bits; i++) {
-        put_bit(os, (bits.value & (1U << i)) != 0);
+void reset_ogg_output_stream(ogg_output_stream* os, ogg_sink* sink, uint32_t page_target) {
+    os->sink = sink;
+    os->bit_buffer = 0;
+    os->bits_stored = 0;
+    os->payload_bytes = 0;
+    os->segments = 0;
+    os->packet_start = 0;
+    os->page_target = page_target;
+    os->page_granule = 0;
+    os->granule = 0;
+    os->seqno = 0;
+    os->first = false;
+    os->continued = false;
+    os->payload_crc = 0;
+    os->crc_bytes = 0;
+}
+
+static void emit_page(ogg_output_stream* os, bool next_continued, bool last);
+
+// Number of payload bytes after which the current page can't take any more of the open packet
+static uint32_t page_limit(const ogg_output_stream* os) {
+    return os->packet_start + (MAX_SEGMENTS - os->segments) * SEGMENT_SIZE;
+}
+
+// Emits the current page with the open packet's bytes so far as full segments, the rest of the packet goes on a continued page
+static void continue_packet(ogg_output_stream* os) {
+    uint32_t size = os->payload_bytes - os->packet_start;
+
+    // Pages on which no packet ends carry a granule of -1
+    if (os->segments == 0) {
+        os->page_granule = UINT32_C(0xFFFFFFFF);
+    }
+
+    for (; size != 0; size -= SEGMENT_SIZE) {
+        os->lacing[os->segments++] = SEGMENT_SIZE;
     }
+
+    emit_page(os, os->payload_bytes != os->packet_start, false);
 }
 
-void put_bit(ogg_output_stream* os, bool bit) {
-    if (bit) {
-        os->bit_buffer |= 1 << os->bits_stored;
+// Stores the lowest byte of the accumulator in the payload
+static void store_byte(ogg_output_stream* os) {
+    if (os->payload_bytes == page_limit(os)) {
+        continue_packet(os);
     }
 
-    os->bits_stored += 1;
-    if (os->bits_stored == 8) {
-        flush_bits(os);
+    os->page_buffer[HEADER_BYTES + MAX_SEGMENTS + os->payload_bytes] = (uint8_t)os->bit_buffer;
+
+    os->payload_bytes += 1;
+
+    os->bit_buffer >>= 8;
+    os->bits_stored = (os->bits_stored > 8) ? os->bits_stored - 8 : 0;
+}
+
+// Moves the lowest 32 bits of the accumulator into the payload as one little endian word
+static void spill_bits(ogg_output_stream* os) {
+    if (os->payload_bytes + 4 <= page_limit(os)) {
+        uint32_t word = (uint32_t)os->bit_buffer;
+        memcpy(&os->page_buffer[HEADER_BYTES + MAX_SEGMENTS + os->payload_bytes], &word, 4);
+
+        os->payload_bytes += 4;
+
+        os->bit_buffer >>= 32;
+        os->bits_stored -= 32;
+    } else {
+        while (os->bits_stored >= 8) {
+            store_byte(os);
+        }
+    }
+}
+
+void ogg_write(ogg_output_stream* os, uint_var bits) {
+    uint64_t v = bits.value & ((UINT64_C(1) << bits.n_bits) - 1);
+
+    os->bit_buffer |= v << os->bits_stored;
+    os->bits_stored += (uint32_t)bits.n_bits;
+
+    if (os->bits_stored >= 32) {
+        spill_bits(os);
+    }
+}
+
+void ogg_write_bits(ogg_output_stream* os, const uint8_t* src, uint64_t n_bits) {
+    ogg_write_bytes(os, src, (uint32_t)(n_bits / 8));
+
+    if (n_bits % 8 != 0) {
+        ogg_write(os, new_uint_var(src[n_bits / 8], n_bits % 8));
     }
 }
 
+void put_bit(ogg_output_stream* os, bool bit) {
+    ogg_write(os, new_uint_var(bit, 1));
+}
+
 void flush_bits(ogg_output_stream* os) {
-    if (os->bits_stored != 0) {
-        if (os->payload_bytes == SEGMENT_SIZE * MAX_SEGMENTS) {
-            perrf("Ran out of space in an Ogg packet: %i %s %i\n", os->bits_stored, os->page_buffer, os->payload_bytes);
-            flush_page(os, true, false);
-            exit(1);
+    while (os->bits_stored != 0) {
+        store_byte(os);
+    }
+}
+
+// Extends the payload checksum over all bytes stored since the last update
+static void update_payload_crc(ogg_output_stream* os) {
+    const uint8_t* payload = &os->page_buffer[HEADER_BYTES + MAX_SEGMENTS];
+
+    os->payload_crc = ogg_crc_update(os->payload_crc, &payload[os->crc_bytes], os->payload_bytes - os->crc_bytes);
+    os->crc_bytes = os->payload_bytes;
+}
+
+void ogg_write_bytes(ogg_output_stream* os, const uint8_t* src, uint32_t n) {
+    while (os->bits_stored >= 8) {
+        store_byte(os);
+    }
+
+    // Copy page by page, the partial byte in the accumulator carries over between chunks
+    while (n != 0) {
+        if (os->payload_bytes == page_limit(os)) {
+            continue_packet(os);
         }
 
-        os->page_buffer[HEADER_BYTES + MAX_SEGMENTS + os->payload_bytes] = os->bit_buffer;
+        uint32_t chunk = page_limit(os) - os->payload_bytes;
+        if (chunk > n) {
+            chunk = n;
+        }
+
+        uint8_t* dst = &os->page_buffer[HEADER_BYTES + MAX_SEGMENTS + os->payload_bytes];
+
+        os->bit_buffer = shift_copy(dst, src, chunk, os->bits_stored, (uint8_t)os->bit_buffer);
+        os->payload_bytes += chunk;
+
+        // Checksum the new bytes while they are still in cache
+        update_payload_crc(os);
+
+        src += chunk;
+        n -= chunk;
+    }
+}
+
+// Byte aligns the packet being written and appends its lacing values to the page
+static void finish_packet(ogg_output_stream* os) {
+    flush_bits(os);
+
+    uint32_t size = os->payload_bytes - os->packet_start;
+
+    // A packet takes one lacing value per full segment, plus a final one below SEGMENT_SIZE.
+    // If only the final one doesn't fit, it goes alone on a continued page.
+    if (os->segments + size / SEGMENT_SIZE + 1 > MAX_SEGMENTS) {
+        continue_packet(os);
+        size = 0;
+    }
+
+    for (; size >= SEGMENT_SIZE; size -= SEGMENT_SIZE) {
+        os->lacing[os->segments++] = SEGMENT_SIZE;
+    }
+
+    os->lacing[os->segments++] = (uint8_t)size;
+
+    os->packet_start = os->payload_bytes;
+    os->page_granule = os->granule;
+}
 
-        os->payload_bytes += 1;
+void ogg_end_packet(ogg_output_stream* os) {
+    finish_packet(os);
+
+    if (os->payload_bytes >= os->page_target) {
+        emit_page(os, false, false);
+    }
+}
 
-        os->bits_stored = 0;
-        os->bit_buffer = 0;
+void ogg_reserve_packet(ogg_output_stream* os, uint32_t bytes) {
+    if (os->segments + bytes / SEGMENT_SIZE + 1 > MAX_SEGMENTS ||
+        os->payload_bytes + bytes > SEGMENT_SIZE * MAX_SEGMENTS) {
+        flush_page(os, false, false);
     }
 }
 
 void flush_page(ogg_output_stream* os, bool next_continued, bool last) {
-    if (os->payload_bytes != SEGMENT_SIZE * MAX_SEGMENTS) {
-        flush_bits(os);
+    if (os->payload_bytes != os->packet_start || os->bits_stored != 0) {
+        finish_packet(os);
     }
-    if (os->payload_bytes != 0) {
-        unsigned int segments = (os->payload_bytes + SEGMENT_SIZE) / SEGMENT_SIZE;
-        if (segments == MAX_SEGMENTS + 1) {
-            segments = MAX_SEGMENTS;
-        }
 
-        for (unsigned int i = 0; i < os->payload_bytes; i++) {
-            os->page_buffer[HEADER_BYTES + segments + i] = os->page_buffer[282 + i];
-        }
+    emit_page(os, next_continued, last);
+}
 
-        os->page_buffer[0] = 'O';
-        os->page_buffer[1] = 'g';
-        os->page_buffer[2] = 'g';
-        os->page_buffer[3] = 'S';
-        os->page_buffer[4] = '\0';
-        os->page_buffer[5] = (os->continued ? 1 : 0) | (os->first ? 2 : 0) | (last ? 4 : 0);
-        write_32(&os->page_buffer[6], os->granule);
-        write_32(&os->page_buffer[10], 0);
-        if (os->granule == UINT32_C(0xFFFFFFFF)) {
-            write_32(&os->page_buffer[10], UINT32_C(0xFFFFFFFF));
-        }
-        write_32(&os->page_buffer[14], 1);
-        write_32(&os->page_buffer[18], os->seqno);
-        write_32(&os->page_buffer[22], 0);
-        os->page_buffer[26] = segments;
-
-        for (unsigned int i = 0, bytes_left = os->payload_bytes; i < segments; i++) {
-            if (bytes_left >= SEGMENT_SIZE) {
-                bytes_left -= SEGMENT_SIZE;
-                os->page_buffer[27 + i] = SEGMENT_SIZE;
-            } else {
-                os->page_buffer[27 + i] = bytes_left;
-            }
+// Writes all packets completed so far to the output stream as a single page
+static void emit_page(ogg_output_stream* os, bool next_continued, bool last) {
+    if (os->segments != 0) {
+        unsigned int segments = os->segments;
+
+        update_payload_crc(os);
+
+        // The payload stays where it is, the header and segment table are placed directly in front of it
+        uint8_t* page = &os->page_buffer[MAX_SEGMENTS - segments];
+
+        page[0] = 'O';
+        page[1] = 'g';
+        page[2] = 'g';
+        page[3] = 'S';
+        page[4] = '\0';
+        page[5] = (os->continued ? 1 : 0) | (os->first ? 2 : 0) | (last ? 4 : 0);
+        write_32(&page[6], os->page_granule);
+        write_32(&page[10], 0);
+        if (os->page_granule == UINT32_C(0xFFFFFFFF)) {
+            write_32(&page[10], UINT32_C(0xFFFFFFFF));
         }
+        write_32(&page[14], 1);
+        write_32(&page[18], os->seqno);
+        write_32(&page[22], 0);
+        page[26] = segments;
 
-        write_32(&os->page_buffer[22], checksum(os->page_buffer, HEADER_BYTES + segments + os->payload_bytes));
+        memcpy(&page[27], os->lacing, segments);
 
-        for (unsigned int i = 0; i < 27 + segments + os->payload_bytes; i++) {
-            fputc(os->page_buffer[i], os->out_stream);
-        }
+        uint32_t header_crc = checksum(page, HEADER_BYTES + segments);
+        write_32(&page[22], ogg_crc_combine(header_crc, os->payload_crc, os->payload_bytes));
+
+        sink_write(os->sink, page, HEADER_BYTES + segments + os->payload_bytes);
 
         os->seqno += 1;
         os->first = false;
         os->continued = next_continued;
         os->payload_bytes = 0;
+        os->payload_crc = 0;
+        os->crc_bytes = 0;
+        os->segments = 0;
+        os->packet_start = 0;
     }
 }
 
+static uint8_t shift_copy_scalar(uint8_t* dst, const uint8_t* src, size_t n, uint32_t shift, uint8_t carry) {
+    size_t i = 0;
+
+    // Whole 64 bit words, the top bits of each word carry over into the next one
+    for (; i + 8 <= n; i += 8) {
+        uint64_t w;
+        memcpy(&w, &src[i], 8);
+
+        uint64_t out = (w << shift) | carry;
+        memcpy(&dst[i], &out, 8);
+
+        carry = (uint8_t)(w >> (64 - shift));
+    }
+
+    for (; i < n; i++) {
+        dst[i] = (uint8_t)((src[i] << shift) | carry);
+        carry = (uint8_t)(src[i] >> (8 - shift));
+    }
+
+    return carry;
+}
+
+#if CPU_X86
+// Every output byte combines the current source byte shifted up with the previous one shifted down.
+// The 16 bit lane shifts leak bits across byte boundaries, the masks strip those bits again.
+static uint8_t shift_copy_sse2(uint8_t* dst, const uint8_t* src, size_t n, uint32_t shift, uint8_t carry) {
+    if (n < 17) {
+        return shift_copy_scalar(dst, src, n, shift, carry);
+    }
+
+    dst[0] = (uint8_t)((src[0] << shift) | carry);
+
+    const __m128i up = _mm_cvtsi32_si128(shift);
+    const __m128i down = _mm_cvtsi32_si128(8 - shift);
+    const __m128i up_mask = _mm_set1_epi8((char)(0xFF << shift));
+    const __m128i down_mask = _mm_set1_epi8((char)((1 << shift) - 1));
+
+    size_t i = 1;
+    for (; i + 16 <= n; i += 16) {
+        __m128i cur = _mm_loadu_si128((const __m128i*)&src[i]);
+        __m128i prev = _mm_loadu_si128((const __m128i*)&src[i - 1]);
+
+        __m128i out = _mm_or_si128(
+            _mm_and_si128(_mm_sll_epi16(cur, up), up_mask),
+            _mm_and_si128(_mm_srl_epi16(prev, down), down_mask));
+
+        _mm_storeu_si128((__m128i*)&dst[i], out);
+    }
+
+    return shift_copy_scalar(&dst[i], &src[i], n - i, shift, (uint8_t)(src[i - 1] >> (8 - shift)));
+}
+
+TARGET("avx2")
+static uint8_t shift_copy_avx2(uint8_t* dst, const uint8_t* src, size_t n, uint32_t shift, uint8_t carry) {
+    if (n < 33) {
+        return shift_copy_sse2(dst, src, n, shift, carry);
+    }
+
+    dst[0] = (uint8_t)((src[0] << shift) | carry);
+
+    const __m128i up = _mm_cvtsi32_si128(shift);
+    const __m128i down = _mm_cvtsi32_si128(8 - shift);
+    const __m256i up_mask = _mm256_set1_epi8((char)(0xFF << shift));
+    const __m256i down_mask = _mm256_set1_epi8((char)((1 << shift) - 1));
+
+    size_t i = 1;
+    for (; i + 32 <= n; i += 32) {
+        __m256i cur = _mm256_loadu_si256((const __m256i*)&src[i]);
+        __m256i prev = _mm256_loadu_si256((const __m256i*)&src[i - 1]);
+
+        __m256i out = _mm256_or_si256(
+            _mm256_and_si256(_mm256_sll_epi16(cur, up), up_mask),
+            _mm256_and_si256(_mm256_srl_epi16(prev, down), down_mask));
+
+        _mm256_storeu_si256((__m256i*)&dst[i], out);
+    }
+
+    return shift_copy_sse2(&dst[i], &src[i], n - i, shift, (uint8_t)(src[i - 1] >> (8 - shift)));
+}
+#endif
+
+typedef uint8_t(*shift_copy_fn)(uint8_t*, const uint8_t*, size_t, uint32_t, uint8_t);
+
+uint8_t shift_copy(uint8_t* dst, const uint8_t* src, size_t n, uint32_t shift, uint8_t carry) {
+    static shift_copy_fn impl = NULL;
+
+    if (shift == 0) {
+        memcpy(dst, src, n);
+        return carry;
+    }
+
+    if (!impl) {
+        impl = shift_copy_scalar;
+#if CPU_X86
+        if (cpu_supports(CPU_AVX2)) {
+            impl = shift_copy_avx2;
+        } else if (cpu_supports(CPU_SSE2)) {
+            impl = shift_copy_sse2;
+        }
+#endif
+    }
+
+    return impl(dst, src, n, shift, carry);
+}
+
 void write_32(unsigned char b[4], uint32_t v) {
     for (int i = 0; i < 4; i++) {
         b[i] = v & 0xFF;
@@ -160,30 +401,7 @@ void write_32(unsigned char b[4], uint32_t v) {
 }
 
 uint32_t checksum(unsigned char* data, int bytes) {
-    uint32_t crc_reg = 0;
-    uint32_t crc_lookup[256] = {
-        0x00000000,0x04c11db7,0x09823b6e,0x0d4326d9,0x130476dc,0x17c56b6b,0x1a864db2,0x1e475005,0x2608edb8,0x22c9f00f,0x2f8ad6d6,0x2b4bcb61,0x350c9b64,0x31cd86d3,0x3c8ea00a,0x384fbdbd,
-        0x4c11db70,0x48d0c6c7,0x4593e01e,0x4152fda9,0x5f15adac,0x5bd4b01b,0x569796c2,0x52568b75,0x6a1936c8,0x6ed82b7f,0x639b0da6,0x675a1011,0x791d4014,0x7ddc5da3,0x709f7b7a,0x745e66cd,
-        0x9823b6e0,0x9ce2ab57,0x91a18d8e,0x95609039,0x8b27c03c,0x8fe6dd8b,0x82a5fb52,0x8664e6e5,0xbe2b5b58,0xbaea46ef,0xb7a96036,0xb3687d81,0xad2f2d84,0xa9ee3033,0xa4ad16ea,0xa06c0b5d,
-        0xd4326d90,0xd0f37027,0xddb056fe,0xd9714b49,0xc7361b4c,0xc3f706fb,0xceb42022,0xca753d95,0xf23a8028,0xf6fb9d9f,0xfbb8bb46,0xff79a6f1,0xe13ef6f4,0xe5ffeb43,0xe8bccd9a,0xec7dd02d,
-        0x34867077,0x30476dc0,0x3d044b19,0x39c556ae,0x278206ab,0x23431b1c,0x2e003dc5,0x2ac12072,0x128e9dcf,0x164f8078,0x1b0ca6a1,0x1fcdbb16,0x018aeb13,0x054bf6a4,0x0808d07d,0x0cc9cdca,
-        0x7897ab07,0x7c56b6b0,0x71159069,0x75d48dde,0x6b93dddb,0x6f52c06c,0x6211e6b5,0x66d0fb02,0x5e9f46bf,0x5a5e5b08,0x571d7dd1,0x53dc6066,0x4d9b3063,0x495a2dd4,0x44190b0d,0x40d816ba,
-        0xaca5c697,0xa864db20,0xa527fdf9,0xa1e6e04e,0xbfa1b04b,0xbb60adfc,0xb6238b25,0xb2e29692,0x8aad2b2f,0x8e6c3698,0x832f1041,0x87ee0df6,0x99a95df3,0x9d684044,0x902b669d,0x94ea7b2a,
-        0xe0b41de7,0xe4750050,0xe9362689,0xedf73b3e,0xf3b06b3b,0xf771768c,0xfa325055,0xfef34de2,0xc6bcf05f,0xc27dede8,0xcf3ecb31,0xcbffd686,0xd5b88683,0xd1799b34,0xdc3abded,0xd8fba05a,
-        0x690ce0ee,0x6dcdfd59,0x608edb80,0x644fc637,0x7a089632,0x7ec98b85,0x738aad5c,0x774bb0eb,0x4f040d56,0x4bc510e1,0x46863638,0x42472b8f,0x5c007b8a,0x58c1663d,0x558240e4,0x51435d53,
-        0x251d3b9e,0x21dc2629,0x2c9f00f0,0x285e1d47,0x36194d42,0x32d850f5,0x3f9b762c,0x3b5a6b9b,0x0315d626,0x07d4cb91,0x0a97ed48,0x0e56f0ff,0x1011a0fa,0x14d0bd4d,0x19939b94,0x1d528623,
-        0xf12f560e,0xf5ee4bb9,0xf8ad6d60,0xfc6c70d7,0xe22b20d2,0xe6ea3d65,0xeba91bbc,0xef68060b,0xd727bbb6,0xd3e6a601,0xdea580d8,0xda649d6f,0xc423cd6a,0xc0e2d0dd,0xcda1f604,0xc960ebb3,
-        0xbd3e8d7e,0xb9ff90c9,0xb4bcb610,0xb07daba7,0xae3afba2,0xaafbe615,0xa7b8c0cc,0xa379dd7b,0x9b3660c6,0x9ff77d71,0x92b45ba8,0x9675461f,0x8832161a,0x8cf30bad,0x81b02d74,0x857130c3,
-        0x5d8a9099,0x594b8d2e,0x5408abf7,0x50c9b640,0x4e8ee645,0x4a4ffbf2,0x470cdd2b,0x43cdc09c,0x7b827d21,0x7f436096,0x7200464f,0x76c15bf8,0x68860bfd,0x6c47164a,0x61043093,0x65c52d24,
-        0x119b4be9,0x155a565e,0x18197087,0x1cd86d30,0x029f3d35,0x065e2082,0x0b1d065b,0x0fdc1bec,0x3793a651,0x3352bbe6,0x3e119d3f,0x3ad08088,0x2497d08d,0x2056cd3a,0x2d15ebe3,0x29d4f654,
-        0xc5a92679,0xc1683bce,0xcc2b1d17,0xc8ea00a0,0xd6ad50a5,0xd26c4d12,0xdf2f6bcb,0xdbee767c,0xe3a1cbc1,0xe760d676,0xea23f0af,0xeee2ed18,0xf0a5bd1d,0xf464a0aa,0xf9278673,0xfde69bc4,
-        0x89b8fd09,0x8d79e0be,0x803ac667,0x84fbdbd0,0x9abc8bd5,0x9e7d9662,0x933eb0bb,0x97ffad0c,0xafb010b1,0xab710d06,0xa6322bdf,0xa2f33668,0xbcb4666d,0xb8757bda,0xb5365d03,0xb1f740b4 };
-    int i;
-
-    for (i = 0; i < bytes; ++i)
-        crc_reg = (crc_reg << 8) ^ crc_lookup[((crc_reg >> 24) & 0xff) ^ data[i]];
-
-    return crc_reg;
+    return ogg_crc_update(0, data, bytes);
 }
 
 void ogg_write_vph(ogg_output_stream* os, uint8_t type) {
@@ -196,75 +414,200 @@ void ogg_write_vph(ogg_output_stream* os, uint8_t type) {
     }
 }
 
-Packet packet(membuf* data, long offset) {
-    data->pos = offset;
-
-    Packet packet;
-    packet.offset = offset;
-    packet.size = read_16_membuf(data);
-    packet.absolute_granule = 0;
+// Defines packet_HEADER_SIZE, with the header size fixed at compile time so each layout reads its fields
+// without any branches
+#define DEFINE_PACKET_READER(HEADER_SIZE) \
+Packet packet_##HEADER_SIZE(membuf* data, long offset) { \
+    unsigned char* header = (unsigned char*)&data->data[offset]; \
+    \
+    Packet packet; \
+    packet.offset = offset; \
+    packet.size = ((HEADER_SIZE) == 8) ? read_32_buf(header) : read_16_buf(header); \
+    packet.absolute_granule = ((HEADER_SIZE) == 2) ? 0 : read_32_buf(&header[(HEADER_SIZE) - 4]); \
+    packet.header_size = (HEADER_SIZE); \
+    \
+    return packet; \
+}
 
-    return packet;
+DEFINE_PACKET_READER(2)
+DEFINE_PACKET_READER(6)
+DEFINE_PACKET_READER(8)
+
+packet_reader get_packet_reader(uint32_t header_size) {
+    switch (header_size) {
+        case 2:
+            return packet_2;
+        case 6:
+            return packet_6;
+        case 8:
+            return packet_8;
+        default:
+            return NULL;
+    }
 }
 
 long packet_offset(Packet packet) {
-    return packet.offset + 2;
+    return packet.offset + packet.header_size;
 }
 
 long packet_next_offset(Packet packet) {
-    return packet.offset + 2 + packet.size;
+    return packet.offset + packet.header_size + packet.size;
 }
 
 bit_stream new_bit_stream(membuf* data) {
     bit_stream bs;
     bs.data = data;
-    bs.bit_buffer = 0;
-    bs.bits_left = 0;
+    bs.start = data->pos;
+    bs.cache = 0;
+    bs.cache_bits = 0;
     bs.total_bits_read = 0;
     return bs;
 }
 
+// Reloads the cache starting at the byte holding the next unread bit. A single
+// unaligned little endian load yields at least 57 usable bits, which is enough
+// for any read of up to 32 bits. Bytes past the end of the buffer read as 0.
+static void bs_refill(bit_stream* bs) {
+    uint64_t byte = bs->start + (bs->total_bits_read >> 3);
+    uint32_t shift = bs->total_bits_read & 7;
+    uint64_t word = 0;
+
+    if (byte + 8 <= bs->data->size) {
+        memcpy(&word, &bs->data->data[byte], 8);
+    } else if (byte < bs->data->size) {
+        memcpy(&word, &bs->data->data[byte], (size_t)(bs->data->size - byte));
+    }
+
+    bs->cache = word >> shift;
+    bs->cache_bits = 64 - shift;
+}
+
 void bs_read(bit_stream* bstream, uint_var* uv) {
-    uv->value = 0;
-    for (unsigned int i = 0; i < uv->n_bits; i++) {
-        if (get_bit(bstream)) {
-            uv->value |= (1U << i);
-        }
+    uv->value = read_bits(bstream, (uint32_t)uv->n_bits);
+}
+
+uint32_t peek_bits(bit_stream* bs, uint32_t n_bits) {
+    if (n_bits > bs->cache_bits) {
+        bs_refill(bs);
+    }
+
+    return (uint32_t)(bs->cache & ((UINT64_C(1) << n_bits) - 1));
+}
+
+void skip_bits(bit_stream* bs, uint32_t n_bits) {
+    if (n_bits > bs->cache_bits) {
+        bs_refill(bs);
     }
+
+    bs->cache >>= n_bits;
+    bs->cache_bits -= n_bits;
+    bs->total_bits_read += n_bits;
+
+    // Keep the underlying buffer positioned after the last byte touched, like reading bytewise would
+    bs->data->pos = bs->start + (bs->total_bits_read + 7) / 8;
+}
+
+uint32_t read_bits(bit_stream* bs, uint32_t n_bits) {
+    uint32_t v = peek_bits(bs, n_bits);
+    skip_bits(bs, n_bits);
+    return v;
 }
 
 bool get_bit(bit_stream* bs) {
-    if (bs->bits_left == 0) {
-        int c = membufgetc(bs->data);
-        bs->bit_buffer = c;
-        bs->bits_left = 8;
+    return read_bits(bs, 1) != 0;
+}
+
+bit_writer new_bit_writer(void) {
+    bit_writer bw;
+    bw.data = NULL;
+    bw.capacity = 0;
+    bw.n_bits = 0;
+
+    return bw;
+}
+
+void bw_write(bit_writer* bw, uint_var bits) {
+    // Up to 32 bits at any bit offset touch at most 5 bytes, plus 3 of slack for the 64 bit store
+    size_t pos = (size_t)(bw->n_bits / 8);
+
+    if (pos + 8 > bw->capacity) {
+        size_t capacity = bw->capacity ? bw->capacity * 2 : 256;
+        uint8_t* data = realloc(bw->data, capacity);
+
+        if (data == NULL) {
+            perrf("Out of memory in bit_writer\n");
+            exit(1);
+        }
+
+        memset(&data[bw->capacity], 0, capacity - bw->capacity);
+
+        bw->data = data;
+        bw->capacity = capacity;
+    }
+
+    uint64_t v = bits.value & ((UINT64_C(1) << bits.n_bits) - 1);
+    uint64_t word;
+
+    memcpy(&word, &bw->data[pos], 8);
+    word |= v << (bw->n_bits % 8);
+    memcpy(&bw->data[pos], &word, 8);
+
+    bw->n_bits += bits.n_bits;
+}
+
+void bw_write_bits(bit_writer* bw, const uint8_t* src, uint64_t n_bits) {
+    uint64_t i = 0;
+
+    for (; i + 32 <= n_bits; i += 32) {
+        uint32_t word;
+        memcpy(&word, &src[i / 8], 4);
+
+        bw_write(bw, new_uint_var(word, 32));
     }
-    bs->total_bits_read += 1;
-    bs->bits_left -= 1;
-    return ((bs->bit_buffer & (0x80 >> bs->bits_left)) != 0);
+
+    for (; i < n_bits; i += 8) {
+        uint64_t n = (n_bits - i < 8) ? n_bits - i : 8;
+
+        bw_write(bw, new_uint_var(src[i / 8], n));
+    }
+}
+
+void reset_bit_writer(bit_writer* bw) {
+    // Bits are ORed in, so the used bytes have to be cleared again
+    if (bw->data != NULL) {
+        memset(bw->data, 0, (size_t)((bw->n_bits + 7) / 8));
+    }
+
+    bw->n_bits = 0;
+}
+
+void free_bit_writer(bit_writer* bw) {
+    free(bw->data);
+
+    *bw = new_bit_writer();
 }
 
-void parse_codebook(bit_stream* bs, int size, ogg_output_stream* os) {
+void parse_codebook(bit_stream* bs, int size, bit_writer* bw) {
     uint_var dimensions = new_uint_var(0, 4);
     uint_var entries = new_uint_var(0, 14);
 
     bs_read(bs, &dimensions);
     bs_read(bs, &entries);
 
-    ogg_write(os, new_uint_var(0x564342, 24));
-    ogg_write(os, new_uint_var(dimensions.value, 16));
-    ogg_write(os, new_uint_var(entries.value, 24));
+    bw_write(bw, new_uint_var(0x564342, 24));
+    bw_write(bw, new_uint_var(dimensions.value, 16));
+    bw_write(bw, new_uint_var(entries.value, 24));
 
     uint_var ordered = new_uint_var(0, 1);
     bs_read(bs, &ordered);
-    ogg_write(os, ordered);
+    bw_write(bw, ordered);
     uint_var codeword_length_length = new_uint_var(0, 3);
     uint_var sparse = new_uint_var(0, 1);
 
     bs_read(bs, &codeword_length_length);
     bs_read(bs, &sparse);
 
-    ogg_write(os, sparse);
+    bw_write(bw, sparse);
 
     for (unsigned int i = 0; i < entries.value; i++) {
         bool present_bool = true;
@@ -272,7 +615,7 @@ void parse_codebook(bit_stream* bs, int size, ogg_output_stream* os) {
         if (sparse.value) {
             uint_var present = new_uint_var(0, 1);
             bs_read(bs, &present);
-            ogg_write(os, present);
+            bw_write(bw, present);
 
             present_bool = present.value != 0;
         }
@@ -280,14 +623,14 @@ void parse_codebook(bit_stream* bs, int size, ogg_output_stream* os) {
         if (present_bool) {
             uint_var codeword_length = new_uint_var(0, codeword_length_length.value);
             bs_read(bs, &codeword_length);
-            ogg_write(os, new_uint_var(codeword_length.value, 5));
+            bw_write(bw, new_uint_var(codeword_length.value, 5));
 
         }
     }
 
     uint_var lookup_type = new_uint_var(0, 1);
     bs_read(bs, &lookup_type);
-    ogg_write(os, new_uint_var(lookup_type.value, 4));
+    bw_write(bw, new_uint_var(lookup_type.value, 4));
 
     if (lookup_type.value == 1) {
         uint_var min = new_uint_var(0, 32);
@@ -300,17 +643,17 @@ void parse_codebook(bit_stream* bs, int size, ogg_output_stream* os) {
         bs_read(bs, &value_length);
         bs_read(bs, &sequence_flag);
 
-        ogg_write(os, min);
-        ogg_write(os, max);
-        ogg_write(os, value_length);
-        ogg_write(os, sequence_flag);
+        bw_write(bw, min);
+        bw_write(bw, max);
+        bw_write(bw, value_length);
+        bw_write(bw, sequence_flag);
 
         unsigned int quantvals = _book_maptype1_quantvals(entries.value, dimensions.value);
 
         for (unsigned int i = 0; i < quantvals; i++) {
             uint_var val = new_uint_var(0, value_length.value + 1);
             bs_read(bs, &val);
-            ogg_write(os, val);
+            bw_write(bw, val);
         }
     }
 }
@@ -2,6 +2,7 @@
 
 #include "defs.h"
 #include "utils.h"
+#include "sink.h"
 
 #define HEADER_BYTES 27
 #define MAX_SEGMENTS 255
@@ -17,19 +18,38 @@ typedef struct uint_var {
 } uint_var;
 
 typedef struct ogg_output_stream {
-    // Final output stream
-    FILE* out_stream;
+    // Receives the finished pages
+    ogg_sink* sink;
 
-    // Buffer for individual bits and the final page
-    uint8_t bit_buffer;
+    // Accumulator for bits not yet stored in the payload, the oldest bit is the lowest
+    uint64_t bit_buffer;
+
+    // Buffer for the final page
     uint8_t page_buffer[HEADER_BYTES + MAX_SEGMENTS + SEGMENT_SIZE * MAX_SEGMENTS];
 
-    // Number of bits stored (flush on 8)
+    // Number of bits in the accumulator (spilled to the payload in 32 bit words)
     uint32_t bits_stored;
 
     // Number of bytes in the final payload
     uint32_t payload_bytes;
 
+    // Lacing values of the packets completed on the current page
+    uint8_t lacing[MAX_SEGMENTS];
+    uint32_t segments;
+
+    // Offset in the payload at which the packet being written starts
+    uint32_t packet_start;
+
+    // Pages are emitted once they hold at least this many payload bytes, 0 gives one page per packet
+    uint32_t page_target;
+
+    // Granule of the last packet completed on the current page
+    uint32_t page_granule;
+
+    // Checksum of the first crc_bytes bytes of the payload
+    uint32_t payload_crc;
+    uint32_t crc_bytes;
+
     uint32_t granule;
     uint32_t seqno;
 
@@ -43,13 +63,16 @@ typedef struct Packet {
     long offset;
 
     // The packet's size
-    uint16_t size;
+    uint32_t size;
 
-    // The packet's granule
+    // The packet's granule, 0 for headers without one
     uint32_t absolute_granule;
+
+    // Size of the header in front of the packet
+    uint32_t header_size;
 } Packet;
 
-// A file-like buffer stored in memory
+// A file-like view of memory. It doesn't own its data, so it can be a slice of a larger buffer
 typedef struct membuf {
     // The buffer's data
     char* data;
@@ -61,35 +84,38 @@ typedef struct membuf {
     uint64_t pos;
 } membuf;
 
+// Reads the header of the packet at offset, which has to fit in the buffer
+typedef Packet(*packet_reader)(membuf* data, long offset);
+
 // A wrapper to read individual bits from a membuf into variable width integers
 typedef struct bit_stream {
     // Underlying buffer
     membuf* data;
 
-    // Buffer for reading bits
-    uint8_t bit_buffer;
+    // Offset in the buffer at which the stream starts
+    uint64_t start;
 
-    // The total number of bits left in the stream
-    uint32_t bits_left;
+    // Cache of upcoming bits, the next bit in the stream is the lowest bit
+    uint64_t cache;
+
+    // The number of valid bits in the cache
+    uint32_t cache_bits;
 
     // Total number of bits read from the stream
     uint64_t total_bits_read;
 } bit_stream;
 
-// Codebook library
-typedef struct codebook_library {
-    // Pointers to the codebook data
-    char* codebook_data;
-
-    // Pointers to the codebook offsets
-    long* codebook_offsets;
+// A growable in-memory buffer to write a variable number of bits to, in Ogg bit order
+typedef struct bit_writer {
+    // The written bits, unused bits of the last byte are 0
+    uint8_t* data;
 
-    // Total number of codebooks
-    long codebook_count;
-} codebook_library;
+    // Allocated size of data in bytes
+    size_t capacity;
 
-// Splits the char* at the given delimiter, and returns the index
-uint64_t split_bytes(char* search, uint64_t search_len, char* delimiter, uint64_t delimiter_len, uint64_t start);
+    // Number of bits written
+    uint64_t n_bits;
+} bit_writer;
 
 // Reads 16 bits from a buffer
 uint16_t read_16_buf(unsigned char b[2]);
@@ -103,24 +129,48 @@ uint32_t read_32_buf(unsigned char b[4]);
 // Reads 32 bits from a membuf struct
 uint32_t read_32_membuf(membuf* buf);
 
+// Creates a membuf over the size bytes at data, without copying them
+membuf new_membuf(char* data, uint64_t size);
+
 // Creates a uint_var with value v and size bit_size
 uint_var new_uint_var(uint32_t v, uint64_t bit_size);
 
 // A bit stream to write a variable number of bits to, instead of bytes at a time
-ogg_output_stream new_ogg_output_stream(FILE* stream);
+ogg_output_stream new_ogg_output_stream(ogg_sink* sink, uint32_t page_target);
 
-// Write bits.value to the output stream in bits.n_bits bits
+// Starts a new logical stream on os, which then writes to sink, keeping its page buffer
+void reset_ogg_output_stream(ogg_output_stream* os, ogg_sink* sink, uint32_t page_target);
+
+// Write bits.value to the output stream in bits.n_bits (at most 32) bits. Packets that outgrow
+// a page are continued on the next one
 void ogg_write(ogg_output_stream* os, uint_var bits);
 
+// Writes n whole bytes to the output stream, starting at the current bit position
+void ogg_write_bytes(ogg_output_stream* os, const uint8_t* src, uint32_t n);
+
+// Writes the first n_bits bits of src to the output stream, starting at the current bit position
+void ogg_write_bits(ogg_output_stream* os, const uint8_t* src, uint64_t n_bits);
+
 // Writes a single bit to the output stream
 void put_bit(ogg_output_stream* os, bool bit);
 
 // Flushes all bits to the payload buffer
 void flush_bits(ogg_output_stream* os);
 
-// Flushes all bits to the output stream
+// Ends the packet being written, which gets its granule from os->granule. Emits the page
+// once it reaches the page target
+void ogg_end_packet(ogg_output_stream* os);
+
+// Emits the current page first if a packet of up to bytes bytes would not fit on it
+void ogg_reserve_packet(ogg_output_stream* os, uint32_t bytes);
+
+// Ends the packet being written, if any, and flushes all packets on the page to the output stream
 void flush_page(ogg_output_stream* os, bool next_continued, bool last);
 
+// Copies n bytes from src to dst, shifted up by shift (0 - 7) bits. The lowest shift bits of
+// dst[0] are taken from carry, the bits shifted out of the last byte are returned
+uint8_t shift_copy(uint8_t* dst, const uint8_t* src, size_t n, uint32_t shift, uint8_t carry);
+
 // Writes 32 bits to the specified buffer
 void write_32(unsigned char b[4], uint32_t v);
 
@@ -130,8 +180,17 @@ uint32_t checksum(unsigned char* data, int bytes);
 // Writes the Vorbis packet header to the stream
 void ogg_write_vph(ogg_output_stream* os, uint8_t type);
 
-// Creates a Vorbis packet from the data in data
-Packet packet(membuf* data, long offset);
+// Creates a Vorbis packet from a 2 byte header, which only holds a 16 bit size
+Packet packet_2(membuf* data, long offset);
+
+// Creates a Vorbis packet from a 6 byte header, a 16 bit size followed by a 32 bit granule
+Packet packet_6(membuf* data, long offset);
+
+// Creates a Vorbis packet from an 8 byte header, a 32 bit size followed by a 32 bit granule
+Packet packet_8(membuf* data, long offset);
+
+// Returns the reader for packet headers of header_size bytes, or NULL if there is no such layout
+packet_reader get_packet_reader(uint32_t header_size);
 
 // Returns the packet's offset (adjusted for overhead)
 long packet_offset(Packet packet);
@@ -145,11 +204,35 @@ bit_stream new_bit_stream(membuf* data);
 // Reads uv.n_bits of bits from the stram into uv.value
 void bs_read(bit_stream* bstream, uint_var* uv);
 
+// Returns the next n_bits (at most 32) bits from the stream without consuming them
+uint32_t peek_bits(bit_stream* bs, uint32_t n_bits);
+
+// Consumes n_bits (at most 32) bits from the stream
+void skip_bits(bit_stream* bs, uint32_t n_bits);
+
+// Reads n_bits (at most 32) bits from the stream
+uint32_t read_bits(bit_stream* bs, uint32_t n_bits);
+
 // Gets a single bit from the stream
 bool get_bit(bit_stream* bs);
 
-// Parses the codebook from buf, with size size, and writes output into os
-void parse_codebook(bit_stream* buf, int size, ogg_output_stream* os);
+// Creates an empty bit_writer
+bit_writer new_bit_writer(void);
+
+// Appends bits.value to the buffer in bits.n_bits (at most 32) bits
+void bw_write(bit_writer* bw, uint_var bits);
+
+// Appends the first n_bits bits of src to the buffer
+void bw_write_bits(bit_writer* bw, const uint8_t* src, uint64_t n_bits);
+
+// Empties a bit_writer, keeping its buffer for the next bits
+void reset_bit_writer(bit_writer* bw);
+
+// Frees the buffer of a bit_writer
+void free_bit_writer(bit_writer* bw);
+
+// Parses the packed Wwise codebook from buf, with size size, and writes the full Vorbis codebook into bw
+void parse_codebook(bit_stream* buf, int size, bit_writer* bw);
 
 // Returns the number of bits required to represent v
 int ilog(unsigned int v);
@@ -0,0 +1,298 @@
+#include "codebook.h"
+
+// Everything about the built-in codebooks is known at compile time
+static const codebook_library library = { pcb, pcb_offsets, CODEBOOK_COUNT - 1, pcb_expanded, NULL, 0 };
+
+// Libraries added with add_codebook_library
+static const codebook_library* libraries[MAX_CODEBOOK_LIBRARIES];
+static unsigned int n_libraries = 0;
+
+const codebook_library* get_codebook_library(void) {
+    return &library;
+}
+
+// Reads bits in Ogg bit order from a buffer of size bytes, failing instead of reading past its end
+typedef struct bounded_reader {
+    const uint8_t* data;
+    uint64_t n_bits;
+    uint64_t pos;
+    bool overrun;
+} bounded_reader;
+
+static uint32_t bounded_read(bounded_reader* r, uint32_t n_bits) {
+    if (r->pos + n_bits > r->n_bits) {
+        r->overrun = true;
+        r->pos = r->n_bits;
+
+        return 0;
+    }
+
+    uint32_t value = 0;
+    for (uint32_t i = 0; i < n_bits; i++, r->pos++) {
+        value |= (uint32_t)((r->data[r->pos / 8] >> (r->pos % 8)) & 1) << i;
+    }
+
+    return value;
+}
+
+// Skips the codeword lengths of a codebook with entries entries, starting at its ordered flag. Packed
+// codebooks store the lengths of unordered ones in fewer bits. Returns false if they are inconsistent
+static bool skip_codeword_lengths(bounded_reader* r, uint32_t entries, bool packed) {
+    if (bounded_read(r, 1)) {
+        // Initial length, then runs of entries with increasing lengths
+        bounded_read(r, 5);
+
+        uint32_t current = 0;
+        while (current < entries && !r->overrun) {
+            current += bounded_read(r, ilog(entries - current));
+        }
+
+        return current == entries && !r->overrun;
+    }
+
+    uint32_t codeword_length_length = 5;
+    if (packed) {
+        codeword_length_length = bounded_read(r, 3);
+
+        if (codeword_length_length == 0 || codeword_length_length > 5) {
+            return false;
+        }
+    }
+
+    uint32_t sparse = bounded_read(r, 1);
+
+    for (uint32_t i = 0; i < entries && !r->overrun; i++) {
+        if (!sparse || bounded_read(r, 1)) {
+            bounded_read(r, codeword_length_length);
+        }
+    }
+
+    return !r->overrun;
+}
+
+// Checks that a packed codebook can be expanded: its header is consistent and it ends in the last
+// byte of its size bytes, as parse_codebook reads it
+static bool packed_codebook_valid(const uint8_t* data, uint32_t size) {
+    bounded_reader r = { data, (uint64_t)size * 8, 0, false };
+
+    uint32_t dimensions = bounded_read(&r, 4);
+    uint32_t entries = bounded_read(&r, 14);
+
+    if (dimensions == 0 || entries == 0 || !skip_codeword_lengths(&r, entries, true)) {
+        return false;
+    }
+
+    if (bounded_read(&r, 1) == 1) {
+        bounded_read(&r, 32);
+        bounded_read(&r, 32);
+        uint32_t value_length = bounded_read(&r, 4) + 1;
+        bounded_read(&r, 1);
+
+        uint64_t quantvals = _book_maptype1_quantvals(entries, dimensions);
+        if (quantvals * value_length > r.n_bits) {
+            return false;
+        }
+
+        r.pos += quantvals * value_length;
+        r.overrun = r.pos > r.n_bits;
+    }
+
+    return !r.overrun && r.pos / 8 + 1 == size;
+}
+
+const codebook_library* map_codebook_library(const char* path) {
+    mapped_file file;
+    if (map_file(path, &file) != 0) {
+        perrf("Can't map codebook file '%s'\n", path);
+
+        return NULL;
+    }
+
+    if (file.size < 8 || file.size > UINT32_MAX) {
+        perrf("Invalid codebook file size '%s'\n", path);
+        unmap_file(&file);
+
+        return NULL;
+    }
+
+    const uint8_t* data = (const uint8_t*)file.data;
+    uint32_t file_size = (uint32_t)file.size;
+    uint32_t offset_offset = read_32_buf((unsigned char*)&data[file_size - 4]);
+
+    if (offset_offset > file_size - 8 || (file_size - offset_offset) % 4 != 0 ||
+        (file_size - offset_offset) / 4 - 1 > 1024) {
+        perrf("Codebook file '%s' has no valid offset table\n", path);
+        unmap_file(&file);
+
+        return NULL;
+    }
+
+    uint32_t count = (file_size - offset_offset) / 4 - 1;
+
+    for (uint32_t i = 0; i <= count; i++) {
+        uint32_t offset = read_32_buf((unsigned char*)&data[offset_offset + i * 4]);
+        uint32_t prev = (i > 0) ? read_32_buf((unsigned char*)&data[offset_offset + (i - 1) * 4]) : 0;
+
+        if (offset > offset_offset || offset < prev) {
+            perrf("Codebook file '%s' has an invalid offset for codebook %u\n", path, i);
+            unmap_file(&file);
+
+            return NULL;
+        }
+    }
+
+    // Codebooks are expanded on first use without further checks, so all of them are checked up front
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t offset = read_32_buf((unsigned char*)&data[offset_offset + i * 4]);
+        uint32_t next = read_32_buf((unsigned char*)&data[offset_offset + (i + 1) * 4]);
+
+        if (!packed_codebook_valid(&data[offset], next - offset)) {
+            perrf("Codebook file '%s' has an invalid codebook %u\n", path, i);
+            unmap_file(&file);
+
+            return NULL;
+        }
+    }
+
+    // Only the small offset table is copied, the codebooks are used in place
+    codebook_library* lib = calloc(1, sizeof(codebook_library));
+    uint32_t* offsets = malloc((count + 1) * sizeof(uint32_t));
+    codebook_cache* cache = calloc(1, sizeof(codebook_cache));
+    expanded_codebook* books = calloc(count, sizeof(expanded_codebook));
+    INIT_ONCE* once = malloc(count * sizeof(INIT_ONCE));
+
+    if (lib == NULL || offsets == NULL || cache == NULL || books == NULL || once == NULL) {
+        perrf("Out of memory loading '%s'\n", path);
+        exit(1);
+    }
+
+    uint64_t hash = UINT64_C(0xcbf29ce484222325);
+    for (uint32_t i = 0; i < file_size; i++) {
+        hash = (hash ^ data[i]) * UINT64_C(0x100000001b3);
+    }
+
+    for (uint32_t i = 0; i <= count; i++) {
+        offsets[i] = read_32_buf((unsigned char*)&data[offset_offset + i * 4]);
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        InitOnceInitialize(&once[i]);
+    }
+
+    cache->books = books;
+    cache->once = once;
+
+    lib->data = data;
+    lib->file = file;
+    lib->offsets = offsets;
+    lib->count = count;
+    lib->expanded = NULL;
+    lib->cache = cache;
+    lib->hash = hash != 0 ? hash : 1;
+
+    return lib;
+}
+
+errno_t add_codebook_library(const codebook_library* lib) {
+    if (n_libraries == MAX_CODEBOOK_LIBRARIES) {
+        perrf("Too many codebook libraries, at most %i can be used\n", MAX_CODEBOOK_LIBRARIES);
+
+        return 1;
+    }
+
+    libraries[n_libraries++] = lib;
+
+    return 0;
+}
+
+unsigned int codebook_library_count(void) {
+    return n_libraries + 1;
+}
+
+const codebook_library* codebook_library_at(unsigned int i) {
+    return (i < n_libraries) ? libraries[i] : &library;
+}
+
+uint64_t codebook_libraries_hash(void) {
+    uint64_t hash = 0;
+
+    for (unsigned int i = 0; i < n_libraries; i++) {
+        hash = (hash ^ libraries[i]->hash) * UINT64_C(0x100000001b3);
+    }
+
+    return hash;
+}
+
+bool get_codebook(const codebook_library* lib, uint32_t id, membuf* buf) {
+    if (id >= lib->count) {
+        return false;
+    }
+
+    *buf = new_membuf((char*)&lib->data[lib->offsets[id]], lib->offsets[id + 1] - lib->offsets[id]);
+
+    return true;
+}
+
+// Identifies the codebook to expand in a call of expand_codebook
+typedef struct expand_request {
+    const codebook_library* lib;
+    uint32_t id;
+} expand_request;
+
+static BOOL CALLBACK expand_codebook(PINIT_ONCE once, PVOID param, PVOID* ctx) {
+    UNUSED(once);
+    UNUSED(ctx);
+
+    expand_request* request = param;
+
+    membuf buf;
+    get_codebook(request->lib, request->id, &buf);
+
+    bit_stream bs = new_bit_stream(&buf);
+    bit_writer bw = new_bit_writer();
+
+    parse_codebook(&bs, (int)buf.size, &bw);
+
+    expanded_codebook* book = &request->lib->cache->books[request->id];
+    book->bits = bw.data;
+    book->n_bits = bw.n_bits;
+
+    return TRUE;
+}
+
+const expanded_codebook* get_expanded_codebook(const codebook_library* lib, uint32_t id) {
+    if (id >= lib->count) {
+        return NULL;
+    }
+
+    if (lib->expanded != NULL) {
+        return &lib->expanded[id];
+    }
+
+    expand_request request = { lib, id };
+    InitOnceExecuteOnce(&lib->cache->once[id], expand_codebook, &request, NULL);
+
+    return &lib->cache->books[id];
+}
+
+uint32_t codebook_dimensions(const expanded_codebook* book) {
+    // Expanded codebooks start byte aligned with the 24 bit sync pattern
+    return book->bits[3] | ((uint32_t)book->bits[4] << 8);
+}
+
+uint32_t codebook_entries(const expanded_codebook* book) {
+    return book->bits[5] | ((uint32_t)book->bits[6] << 8) | ((uint32_t)book->bits[7] << 16);
+}
+
+uint32_t codebook_lookup_type(const expanded_codebook* book) {
+    bounded_reader r = { book->bits, book->n_bits, 0, false };
+
+    // Sync pattern, dimensions and entries
+    r.pos = 24 + 16 + 24;
+
+    if (!skip_codeword_lengths(&r, codebook_entries(book), false)) {
+        return 0;
+    }
+
+    return bounded_read(&r, 4);
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "defs.h"
+#include "bitmanip.h"
+#include "mapfile.h"
+
+// A codebook expanded to the bits of a full Vorbis codebook
+typedef struct expanded_codebook {
+    // The codebook's bits, in Ogg bit order
+    const uint8_t* bits;
+
+    // Number of bits in the codebook
+    uint64_t n_bits;
+} expanded_codebook;
+
+// Maximum number of codebook libraries tried for a setup packet
+#define MAX_CODEBOOK_LIBRARIES 8
+
+// Codebooks of a library expanded so far, filled concurrently on first use of each id
+typedef struct codebook_cache {
+    expanded_codebook* books;
+    INIT_ONCE* once;
+} codebook_cache;
+
+// The packed Wwise codebooks, shared read-only by all conversions
+typedef struct codebook_library {
+    // The packed codebook data
+    const uint8_t* data;
+
+    // Offsets of the codebooks in data, the last one marks the end of the final codebook
+    const uint32_t* offsets;
+
+    // Number of codebooks
+    uint32_t count;
+
+    // Codebooks expanded ahead of time, or NULL to expand them on first use
+    const expanded_codebook* expanded;
+
+    // Codebooks expanded on first use, the only part that changes after setup
+    codebook_cache* cache;
+
+    // Identifies the codebooks in caches, 0 for the built-in ones
+    uint64_t hash;
+
+    // The mapping data points into, empty for the built-in library
+    mapped_file file;
+} codebook_library;
+
+// The offset table of pcb[] and its codebooks expanded, generated by codebook_gen into pcb_expanded.c
+extern const uint32_t pcb_offsets[CODEBOOK_COUNT];
+extern const expanded_codebook pcb_expanded[CODEBOOK_COUNT - 1];
+
+// Returns the library built from pcb[]
+const codebook_library* get_codebook_library(void);
+
+// Maps the codebook file at path into memory. It has the layout of pcb[]: the packed codebooks, followed
+// by the table of their offsets, of which the last one is the offset of the table itself. Returns NULL
+// if the file can't be used
+const codebook_library* map_codebook_library(const char* path);
+
+// Adds lib to the libraries tried for each setup packet, which are tried in the order they were added
+// and before the built-in one. Has to be called before any conversion starts
+errno_t add_codebook_library(const codebook_library* lib);
+
+// Returns the number of libraries tried for each setup packet
+unsigned int codebook_library_count(void);
+
+// Returns the ith library to try for a setup packet
+const codebook_library* codebook_library_at(unsigned int i);
+
+// Returns a hash identifying the libraries tried for setup packets and their order
+uint64_t codebook_libraries_hash(void);
+
+// Points buf at codebook id of lib. Returns false if lib has no such codebook
+bool get_codebook(const codebook_library* lib, uint32_t id, membuf* buf);
+
+// Returns codebook id of lib expanded to a Vorbis codebook, or NULL if lib has no such codebook.
+// Unless lib comes expanded, each id is expanded once and later calls from any thread share the result
+const expanded_codebook* get_expanded_codebook(const codebook_library* lib, uint32_t id);
+
+// Returns the number of dimensions of an expanded codebook
+uint32_t codebook_dimensions(const expanded_codebook* book);
+
+// Returns the number of entries of an expanded codebook
+uint32_t codebook_entries(const expanded_codebook* book);
+
+// Returns the lookup type of an expanded codebook, 0 for codebooks that can only be used as scalars
+uint32_t codebook_lookup_type(const expanded_codebook* book);
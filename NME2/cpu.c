@@ -0,0 +1,89 @@
+#include "cpu.h"
+
+#if CPU_X86
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+#if CPU_X86
+static void cpuid(int regs[4], int leaf, int subleaf) {
+#if defined(_MSC_VER)
+    __cpuidex(regs, leaf, subleaf);
+#else
+    unsigned int a, b, c, d;
+    __cpuid_count(leaf, subleaf, a, b, c, d);
+    regs[0] = (int)a;
+    regs[1] = (int)b;
+    regs[2] = (int)c;
+    regs[3] = (int)d;
+#endif
+}
+
+// Reads the XCR0 register to check which register states the OS saves on context switches
+static uint64_t xgetbv0(void) {
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    uint32_t lo, hi;
+    __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    return ((uint64_t)hi << 32) | lo;
+#endif
+}
+#endif
+
+static uint32_t detect_features(void) {
+    uint32_t features = 0;
+
+#if CPU_X86
+    int regs[4];
+
+    cpuid(regs, 0, 0);
+    int max_leaf = regs[0];
+
+    cpuid(regs, 1, 0);
+
+    if (regs[3] & (1 << 26)) {
+        features |= CPU_SSE2;
+    }
+
+    if (regs[2] & (1 << 9)) {
+        features |= CPU_SSSE3;
+    }
+
+    if (regs[2] & (1 << 1)) {
+        features |= CPU_PCLMUL;
+    }
+
+    // AVX2 also requires the OS to preserve the upper halves of the YMM registers
+    bool osxsave = (regs[2] & (1 << 27)) != 0;
+    if (max_leaf >= 7 && osxsave && (xgetbv0() & 0x6) == 0x6) {
+        cpuid(regs, 7, 0);
+
+        if (regs[1] & (1 << 5)) {
+            features |= CPU_AVX2;
+        }
+    }
+#endif
+
+    return features;
+}
+
+uint32_t cpu_features(void) {
+    // Detection is idempotent, so racing threads at worst repeat it
+    static volatile uint32_t features = 0;
+    static volatile bool detected = false;
+
+    if (!detected) {
+        features = detect_features();
+        detected = true;
+    }
+
+    return features;
+}
+
+bool cpu_supports(uint32_t features) {
+    return (cpu_features() & features) == features;
+}
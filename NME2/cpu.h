@@ -0,0 +1,29 @@
+#pragma once
+
+#include "defs.h"
+
+// Architectures where the SSE2/AVX2 code paths are compiled in
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+#define CPU_X86 1
+#else
+#define CPU_X86 0
+#endif
+
+// Marks a function as using instructions beyond the compiler's baseline (MSVC needs no annotation)
+#if defined(__GNUC__) || defined(__clang__)
+#define TARGET(isa) __attribute__((target(isa)))
+#else
+#define TARGET(isa)
+#endif
+
+// Instruction set extensions that can be used at runtime
+#define CPU_SSE2    0x01
+#define CPU_SSSE3   0x02
+#define CPU_PCLMUL  0x04
+#define CPU_AVX2    0x08
+
+// Returns the supported CPU_* flags of the executing CPU, detected once
+uint32_t cpu_features(void);
+
+// Checks whether every flag in features is supported
+bool cpu_supports(uint32_t features);
@@ -0,0 +1,196 @@
+#include "crc.h"
+#include "cpu.h"
+
+#if CPU_X86
+#include <immintrin.h>
+#endif
+
+#define CRC_POLYNOMIAL UINT32_C(0x04c11db7)
+
+static const uint32_t crc_lookup[256] = {
+    0x00000000,0x04c11db7,0x09823b6e,0x0d4326d9,0x130476dc,0x17c56b6b,0x1a864db2,0x1e475005,0x2608edb8,0x22c9f00f,0x2f8ad6d6,0x2b4bcb61,0x350c9b64,0x31cd86d3,0x3c8ea00a,0x384fbdbd,
+    0x4c11db70,0x48d0c6c7,0x4593e01e,0x4152fda9,0x5f15adac,0x5bd4b01b,0x569796c2,0x52568b75,0x6a1936c8,0x6ed82b7f,0x639b0da6,0x675a1011,0x791d4014,0x7ddc5da3,0x709f7b7a,0x745e66cd,
+    0x9823b6e0,0x9ce2ab57,0x91a18d8e,0x95609039,0x8b27c03c,0x8fe6dd8b,0x82a5fb52,0x8664e6e5,0xbe2b5b58,0xbaea46ef,0xb7a96036,0xb3687d81,0xad2f2d84,0xa9ee3033,0xa4ad16ea,0xa06c0b5d,
+    0xd4326d90,0xd0f37027,0xddb056fe,0xd9714b49,0xc7361b4c,0xc3f706fb,0xceb42022,0xca753d95,0xf23a8028,0xf6fb9d9f,0xfbb8bb46,0xff79a6f1,0xe13ef6f4,0xe5ffeb43,0xe8bccd9a,0xec7dd02d,
+    0x34867077,0x30476dc0,0x3d044b19,0x39c556ae,0x278206ab,0x23431b1c,0x2e003dc5,0x2ac12072,0x128e9dcf,0x164f8078,0x1b0ca6a1,0x1fcdbb16,0x018aeb13,0x054bf6a4,0x0808d07d,0x0cc9cdca,
+    0x7897ab07,0x7c56b6b0,0x71159069,0x75d48dde,0x6b93dddb,0x6f52c06c,0x6211e6b5,0x66d0fb02,0x5e9f46bf,0x5a5e5b08,0x571d7dd1,0x53dc6066,0x4d9b3063,0x495a2dd4,0x44190b0d,0x40d816ba,
+    0xaca5c697,0xa864db20,0xa527fdf9,0xa1e6e04e,0xbfa1b04b,0xbb60adfc,0xb6238b25,0xb2e29692,0x8aad2b2f,0x8e6c3698,0x832f1041,0x87ee0df6,0x99a95df3,0x9d684044,0x902b669d,0x94ea7b2a,
+    0xe0b41de7,0xe4750050,0xe9362689,0xedf73b3e,0xf3b06b3b,0xf771768c,0xfa325055,0xfef34de2,0xc6bcf05f,0xc27dede8,0xcf3ecb31,0xcbffd686,0xd5b88683,0xd1799b34,0xdc3abded,0xd8fba05a,
+    0x690ce0ee,0x6dcdfd59,0x608edb80,0x644fc637,0x7a089632,0x7ec98b85,0x738aad5c,0x774bb0eb,0x4f040d56,0x4bc510e1,0x46863638,0x42472b8f,0x5c007b8a,0x58c1663d,0x558240e4,0x51435d53,
+    0x251d3b9e,0x21dc2629,0x2c9f00f0,0x285e1d47,0x36194d42,0x32d850f5,0x3f9b762c,0x3b5a6b9b,0x0315d626,0x07d4cb91,0x0a97ed48,0x0e56f0ff,0x1011a0fa,0x14d0bd4d,0x19939b94,0x1d528623,
+    0xf12f560e,0xf5ee4bb9,0xf8ad6d60,0xfc6c70d7,0xe22b20d2,0xe6ea3d65,0xeba91bbc,0xef68060b,0xd727bbb6,0xd3e6a601,0xdea580d8,0xda649d6f,0xc423cd6a,0xc0e2d0dd,0xcda1f604,0xc960ebb3,
+    0xbd3e8d7e,0xb9ff90c9,0xb4bcb610,0xb07daba7,0xae3afba2,0xaafbe615,0xa7b8c0cc,0xa379dd7b,0x9b3660c6,0x9ff77d71,0x92b45ba8,0x9675461f,0x8832161a,0x8cf30bad,0x81b02d74,0x857130c3,
+    0x5d8a9099,0x594b8d2e,0x5408abf7,0x50c9b640,0x4e8ee645,0x4a4ffbf2,0x470cdd2b,0x43cdc09c,0x7b827d21,0x7f436096,0x7200464f,0x76c15bf8,0x68860bfd,0x6c47164a,0x61043093,0x65c52d24,
+    0x119b4be9,0x155a565e,0x18197087,0x1cd86d30,0x029f3d35,0x065e2082,0x0b1d065b,0x0fdc1bec,0x3793a651,0x3352bbe6,0x3e119d3f,0x3ad08088,0x2497d08d,0x2056cd3a,0x2d15ebe3,0x29d4f654,
+    0xc5a92679,0xc1683bce,0xcc2b1d17,0xc8ea00a0,0xd6ad50a5,0xd26c4d12,0xdf2f6bcb,0xdbee767c,0xe3a1cbc1,0xe760d676,0xea23f0af,0xeee2ed18,0xf0a5bd1d,0xf464a0aa,0xf9278673,0xfde69bc4,
+    0x89b8fd09,0x8d79e0be,0x803ac667,0x84fbdbd0,0x9abc8bd5,0x9e7d9662,0x933eb0bb,0x97ffad0c,0xafb010b1,0xab710d06,0xa6322bdf,0xa2f33668,0xbcb4666d,0xb8757bda,0xb5365d03,0xb1f740b4
+};
+
+// crc_slices[k][i] is the CRC of byte i followed by k zero bytes, crc_slices[0] equals crc_lookup
+static uint32_t crc_slices[16][256];
+
+// x^n mod P for the folding distances used by the PCLMULQDQ path
+static uint32_t fold_128[2];
+static uint32_t fold_512[2];
+
+static INIT_ONCE crc_init_once = INIT_ONCE_STATIC_INIT;
+
+// Multiplies two polynomials modulo the CRC polynomial
+static uint32_t crc_multiply(uint32_t a, uint32_t b) {
+    uint32_t r = 0;
+
+    for (int i = 31; i >= 0; i--) {
+        r = (r & 0x80000000) ? (r << 1) ^ CRC_POLYNOMIAL : r << 1;
+
+        if (b & (UINT32_C(1) << i)) {
+            r ^= a;
+        }
+    }
+
+    return r;
+}
+
+// Returns x^n modulo the CRC polynomial
+static uint32_t crc_x_pow(uint64_t n) {
+    uint32_t r = 1;
+    uint32_t base = 2;
+
+    while (n) {
+        if (n & 1) {
+            r = crc_multiply(r, base);
+        }
+
+        base = crc_multiply(base, base);
+        n >>= 1;
+    }
+
+    return r;
+}
+
+static BOOL CALLBACK crc_init(PINIT_ONCE once, PVOID param, PVOID* ctx) {
+    UNUSED(once);
+    UNUSED(param);
+    UNUSED(ctx);
+
+    for (int i = 0; i < 256; i++) {
+        crc_slices[0][i] = crc_lookup[i];
+    }
+
+    for (int k = 1; k < 16; k++) {
+        for (int i = 0; i < 256; i++) {
+            uint32_t prev = crc_slices[k - 1][i];
+            crc_slices[k][i] = (prev << 8) ^ crc_lookup[prev >> 24];
+        }
+    }
+
+    // A 64 bit half at bit offset 64 (high) or 0 (low) moved forward by 128 or 512 bits
+    fold_128[0] = crc_x_pow(128 + 64);
+    fold_128[1] = crc_x_pow(128);
+    fold_512[0] = crc_x_pow(512 + 64);
+    fold_512[1] = crc_x_pow(512);
+
+    return TRUE;
+}
+
+static uint32_t crc_bytewise(uint32_t crc, const uint8_t* data, size_t bytes) {
+    for (size_t i = 0; i < bytes; i++) {
+        crc = (crc << 8) ^ crc_lookup[(crc >> 24) ^ data[i]];
+    }
+
+    return crc;
+}
+
+static uint32_t crc_slice16(uint32_t crc, const uint8_t* data, size_t bytes) {
+    while (bytes >= 16) {
+        uint32_t w = crc ^ (((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) | ((uint32_t)data[2] << 8) | data[3]);
+
+        crc = crc_slices[15][w >> 24] ^ crc_slices[14][(w >> 16) & 0xFF] ^
+            crc_slices[13][(w >> 8) & 0xFF] ^ crc_slices[12][w & 0xFF] ^
+            crc_slices[11][data[4]] ^ crc_slices[10][data[5]] ^
+            crc_slices[9][data[6]] ^ crc_slices[8][data[7]] ^
+            crc_slices[7][data[8]] ^ crc_slices[6][data[9]] ^
+            crc_slices[5][data[10]] ^ crc_slices[4][data[11]] ^
+            crc_slices[3][data[12]] ^ crc_slices[2][data[13]] ^
+            crc_slices[1][data[14]] ^ crc_slices[0][data[15]];
+
+        data += 16;
+        bytes -= 16;
+    }
+
+    return crc_bytewise(crc, data, bytes);
+}
+
+#if CPU_X86
+// Multiplies both 64 bit halves of x by their folding constant, which moves x forward in the
+// message while keeping it congruent modulo P. The products are at most 96 bits wide
+TARGET("pclmul,ssse3")
+static inline __m128i crc_fold(__m128i x, __m128i k) {
+    return _mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x11), _mm_clmulepi64_si128(x, k, 0x00));
+}
+
+// Folds 64 byte blocks with four independent accumulators, then reduces the remaining 128 bit
+// value with the tables. Requires at least 64 bytes
+TARGET("pclmul,ssse3")
+static uint32_t crc_pclmul(uint32_t crc, const uint8_t* data, size_t bytes) {
+    // The first byte of the message is the highest degree term, so bytes are loaded reversed
+    const __m128i reverse = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    const __m128i k512 = _mm_set_epi32(0, fold_512[0], 0, fold_512[1]);
+    const __m128i k128 = _mm_set_epi32(0, fold_128[0], 0, fold_128[1]);
+
+    __m128i x0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)&data[0]), reverse);
+    __m128i x1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)&data[16]), reverse);
+    __m128i x2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)&data[32]), reverse);
+    __m128i x3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)&data[48]), reverse);
+
+    // Continuing from crc is the same as xoring it into the first 4 bytes
+    x0 = _mm_xor_si128(x0, _mm_slli_si128(_mm_cvtsi32_si128((int)crc), 12));
+
+    data += 64;
+    bytes -= 64;
+
+    while (bytes >= 64) {
+        x0 = _mm_xor_si128(crc_fold(x0, k512), _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)&data[0]), reverse));
+        x1 = _mm_xor_si128(crc_fold(x1, k512), _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)&data[16]), reverse));
+        x2 = _mm_xor_si128(crc_fold(x2, k512), _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)&data[32]), reverse));
+        x3 = _mm_xor_si128(crc_fold(x3, k512), _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)&data[48]), reverse));
+
+        data += 64;
+        bytes -= 64;
+    }
+
+    __m128i x = _mm_xor_si128(crc_fold(x0, k128), x1);
+    x = _mm_xor_si128(crc_fold(x, k128), x2);
+    x = _mm_xor_si128(crc_fold(x, k128), x3);
+
+    while (bytes >= 16) {
+        x = _mm_xor_si128(crc_fold(x, k128), _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)data), reverse));
+
+        data += 16;
+        bytes -= 16;
+    }
+
+    // x is now congruent to the message, its CRC is the CRC of the whole prefix
+    uint8_t folded[16];
+    _mm_storeu_si128((__m128i*)folded, _mm_shuffle_epi8(x, reverse));
+
+    crc = crc_slice16(0, folded, 16);
+
+    return crc_bytewise(crc, data, bytes);
+}
+#endif
+
+uint32_t ogg_crc_update(uint32_t crc, const uint8_t* data, size_t bytes) {
+    InitOnceExecuteOnce(&crc_init_once, crc_init, NULL, NULL);
+
+#if CPU_X86
+    if (bytes >= 128 && cpu_supports(CPU_PCLMUL | CPU_SSSE3)) {
+        return crc_pclmul(crc, data, bytes);
+    }
+#endif
+
+    return crc_slice16(crc, data, bytes);
+}
+
+uint32_t ogg_crc_combine(uint32_t crc_a, uint32_t crc_b, uint64_t bytes_b) {
+    return crc_multiply(crc_a, crc_x_pow(bytes_b * 8)) ^ crc_b;
+}
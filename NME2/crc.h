@@ -0,0 +1,11 @@
+#pragma once
+
+#include "defs.h"
+
+// CRC32 as used for Ogg page checksums: polynomial 0x04c11db7, not reflected, initial value
+// and final xor 0. Starting from 0 and feeding the data in any number of pieces gives the
+// same result as a single call over all of it
+uint32_t ogg_crc_update(uint32_t crc, const uint8_t* data, size_t bytes);
+
+// Returns the CRC of the concatenation A + B, given the CRC of A, the CRC of B and the size of B
+uint32_t ogg_crc_combine(uint32_t crc_a, uint32_t crc_b, uint64_t bytes_b);
@@ -11,7 +11,7 @@
 // Yes this is stolen from Qt
 #define UNUSED(x) (void)x
 
-#define TRIM(c) realloc(c, strlen(c))
+#define TRIM(c) realloc(c, strlen(c) + 1)
 
 #define VERSION_MAJOR 0
 #define VERSION_MINOR 5
@@ -62,9 +62,13 @@
 
 #define CMD_BASE_VIDEO "ffmpeg -hide_banner -v fatal -stats -f mpegvideo -i \"%s\" -an -c:v %s %s %s -threads %i %s -y \"%s\""
 #define CMD_BASE_AUDIO "ffmpeg -hide_banner -v fatal -i - -c:a copy -f ogg - | revorb - - | ffmpeg -hide_banner -v fatal -stats -i - -c:a %s %s %s -threads %i -y \"%s\""
+#define CMD_BASE_AUDIO_WAV "ffmpeg -hide_banner -v fatal -stats -f wav -i - -c:a %s %s %s -threads %i -y \"%s\""
 
 #define CMD_MAX_LENGTH 0x1FFF
 
+#define OGG_PAGE_SIZE_FALLBACK 4096
+#define OGG_PAGE_SIZE_MAX      65025
+
 #define OFFSET_OFFSET   71991
 #define CODEBOOK_COUNT  599
 
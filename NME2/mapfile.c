@@ -0,0 +1,48 @@
+#include "mapfile.h"
+
+errno_t map_file(const char* path, mapped_file* file) {
+    file->data = NULL;
+    file->size = 0;
+
+    HANDLE handle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (handle == INVALID_HANDLE_VALUE) {
+        return 1;
+    }
+
+    // Empty files can't be mapped
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(handle, &size) || size.QuadPart <= 0) {
+        CloseHandle(handle);
+
+        return 1;
+    }
+
+    HANDLE mapping = CreateFileMappingA(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+    const char* data = NULL;
+    if (mapping != NULL) {
+        data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+        // The view keeps the file mapped after both handles are closed
+        CloseHandle(mapping);
+    }
+
+    CloseHandle(handle);
+
+    if (data == NULL) {
+        return 1;
+    }
+
+    file->data = data;
+    file->size = (uint64_t)size.QuadPart;
+
+    return 0;
+}
+
+void unmap_file(mapped_file* file) {
+    if (file->data != NULL) {
+        UnmapViewOfFile(file->data);
+    }
+
+    file->data = NULL;
+    file->size = 0;
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "defs.h"
+
+// A read-only view of a whole input file, shared with other processes through the page cache
+typedef struct mapped_file {
+    const char* data;
+    uint64_t size;
+} mapped_file;
+
+// Maps the file at path into memory. Returns nonzero if it can't be opened or mapped, or is empty
+errno_t map_file(const char* path, mapped_file* file);
+
+// Unmaps a file mapped by map_file
+void unmap_file(mapped_file* file);
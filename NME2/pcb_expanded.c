@@ -0,0 +1,4544 @@
+// Generated by codebook_gen from pcb.c, do not edit
+
+#include "codebook.h"
+
+const uint32_t pcb_offsets[CODEBOOK_COUNT] = {
+    0,8,21,52,60,75,106,142,274,358,378,458,470,496,555,567,593,652,659,703,747,
+    911,915,921,933,969,1101,1105,1111,1123,1154,1198,1362,1369,1382,1413,1421,1436,1467,1474,1518,1562,
+    1646,1666,1734,1746,1772,1831,1843,1869,1928,1935,1979,2023,2107,2127,2207,2221,2247,2296,2308,2334,2393,
+    2405,2412,2576,2620,2704,2724,2804,2824,2904,2916,2942,3001,3013,3039,3098,3110,3117,3281,3325,3409,3425,
+    3493,3513,3581,3593,3619,3668,3680,3706,3755,3919,3924,3930,3942,3978,4031,4084,4559,5039,5096,5222,5245,
+    5298,5430,5676,5720,5786,5839,5892,6297,6702,6759,6816,6880,6958,7051,7129,7261,7393,7560,7626,7692,7745,
+    8150,8207,8374,8427,8505,8608,8625,8728,8806,8966,9212,9344,9594,9667,9733,9786,9839,10317,10722,10779,10910,
+    10933,10986,11118,11364,11408,11461,11514,11992,12319,12376,12433,12486,12564,12657,12735,12867,12999,13166,13232,13276,13329,
+    13382,13853,14333,14390,14534,14557,14884,14987,15090,15134,15178,15231,15284,15755,16235,16292,16436,16459,16498,16601,16704,
+    16748,16784,16837,16890,17359,17764,17821,17964,17987,18044,18168,18271,18315,18351,18404,18457,18920,19325,19382,19527,19550,
+    19607,19767,19934,19978,20014,20067,20120,20587,20992,21049,21194,21217,21320,21480,21647,21691,21757,21810,21863,22330,22735,
+    22792,22849,22902,22980,23058,23136,23239,23371,23538,23604,23670,23723,23776,24235,24640,24697,24754,24807,24885,24963,25041,
+    25173,25305,25472,25538,25604,25657,25710,26170,26575,26632,26689,26742,26820,26913,26991,27069,27193,27247,27313,27379,27445,
+    27498,27903,27960,28127,28180,28258,28361,28384,28508,28586,28746,28992,29049,29299,29352,29418,29484,29537,29864,29921,30088,
+    30141,30219,30322,30345,30448,30526,30686,30932,31064,31314,31381,31425,31478,31531,32003,32484,32541,32682,32705,33032,33135,
+    33238,33274,34148,34253,34289,34343,34507,34560,34638,34748,34771,34824,34956,35202,35268,35334,36208,36313,36349,36403,36567,
+    36620,36698,36809,36832,36935,37067,37313,37379,37445,37471,37648,37697,37819,37872,37950,38033,38056,38180,38258,38418,38664,
+    38831,39081,39135,39201,40075,40180,40216,40270,40434,40487,40565,40673,40696,40749,40881,41127,41193,42067,42169,42205,42259,
+    42423,42476,42554,42665,42688,42791,42951,43197,43263,43317,44191,44324,44429,44468,44525,44692,44745,44823,44934,44957,45060,
+    45184,45351,45417,45471,46345,46478,46583,46622,46679,46846,46899,46977,47088,47111,47214,47374,47541,47607,47661,48535,48668,
+    48773,48812,48869,49036,49089,49167,49278,49301,49404,49564,49810,49876,49930,50804,50937,51042,51081,51138,51305,51358,51436,
+    51547,51570,51702,51905,52151,52217,52283,52331,52604,52656,52781,52834,52912,52995,53018,53142,53220,53380,53626,53729,53853,
+    53920,53986,54040,54088,54361,54413,54538,54591,54669,54752,54775,54899,54977,55137,55383,55486,55610,55677,55743,55797,55845,
+    56118,56170,56295,56348,56426,56509,56532,56656,56734,56894,57140,57307,57557,57610,57676,57730,57778,58051,58103,58228,58281,
+    58359,58442,58465,58589,58667,58827,59073,59278,59528,59581,59647,59701,60575,60680,60716,60770,60934,60987,61065,61176,61199,
+    61526,61650,61817,61871,61925,62799,62904,62943,63000,63167,63220,63298,63409,63432,63489,63613,63780,63834,63878,64752,64857,
+    64895,64949,65113,65166,65244,65355,65378,65481,65605,65772,65826,65870,66744,66849,66888,66945,67112,67165,67243,67354,67377,
+    67480,67604,67771,67825,67879,68753,68858,68894,68948,69112,69165,69243,69354,69377,69704,69807,69974,70028,70082,70956,71061,
+    71100,71157,71324,71377,71455,71566,71589,71646,71770,71937,71991,
+};
+
+static const unsigned char pcb_expanded_data[] = {
+    66,67,86,1,0,9,0,0,26,138,162,40,142,226,0,66,67,86,1,0,25,
+    0,0,2,40,142,226,40,146,98,41,150,99,57,154,164,1,66,67,86,1,0,
+    64,0,0,2,0,0,40,146,33,41,146,98,41,150,163,89,154,167,137,158,40,
+    138,166,168,202,170,108,154,178,44,203,178,236,186,174,11,0,66,67,86,1,0,
+    9,0,0,42,138,162,24,142,226,0,66,67,86,1,0,25,0,0,2,24,138,
+    226,40,142,35,57,150,100,105,150,231,1,66,67,86,1,0,64,0,0,2,0,
+    0,40,134,163,88,138,166,120,146,103,121,158,231,121,158,231,121,158,231,121,158,
+    231,121,158,231,121,158,231,121,158,6,0,66,67,86,1,0,64,0,0,24,66,
+    16,42,5,173,99,142,58,200,21,33,140,25,162,160,66,202,41,199,29,66,208,
+    33,163,36,67,136,58,198,53,199,24,99,71,185,100,138,66,201,1,66,67,86,
+    1,0,0,1,0,144,114,92,65,201,37,181,156,115,206,141,98,92,49,199,161,
+    131,156,115,206,149,131,156,49,199,37,148,156,115,206,57,230,156,75,202,57,198,
+    156,115,206,141,98,92,57,200,165,180,156,115,206,5,82,28,41,198,157,98,156,
+    115,206,145,114,28,41,198,161,98,156,115,206,181,197,220,74,202,57,231,156,115,
+    206,153,131,28,74,201,185,214,156,115,206,145,98,156,57,200,45,148,156,115,206,
+    25,131,156,49,199,173,131,156,115,206,49,214,220,82,203,57,231,156,115,206,57,
+    231,156,115,206,57,231,156,115,206,49,198,156,115,206,57,231,156,115,206,185,197,
+    156,91,204,185,230,156,115,206,57,231,156,115,204,57,231,156,115,206,1,66,67,
+    86,1,0,128,0,0,12,66,8,33,132,16,66,8,33,132,144,66,74,41,133,
+    148,98,138,41,166,152,114,204,49,199,28,115,12,50,200,32,131,14,58,233,164,
+    147,76,42,233,164,163,76,50,234,40,181,150,82,75,49,197,20,91,110,49,214,
+    90,107,205,57,247,26,148,50,198,24,99,140,49,198,24,99,140,49,198,24,99,
+    140,49,2,66,67,86,1,0,32,0,0,132,65,6,25,100,16,66,8,33,133,
+    20,82,138,41,166,28,115,204,49,199,0,66,67,86,1,0,128,0,0,2,0,
+    0,0,28,69,82,36,71,114,36,71,146,36,201,146,44,73,147,60,203,179,60,
+    203,179,60,77,212,68,77,21,85,213,85,109,215,246,109,95,246,109,223,213,101,
+    223,246,101,219,213,101,93,150,101,221,181,109,93,214,93,93,215,117,93,215,117,
+    93,215,117,93,215,117,93,215,117,93,215,1,66,67,86,1,0,18,0,0,58,
+    146,227,56,146,227,56,146,35,57,146,34,41,0,66,67,86,1,0,50,0,0,
+    2,0,112,20,71,113,28,201,145,28,203,177,36,75,210,36,205,242,44,207,242,
+    52,79,19,53,209,3,66,67,86,1,0,128,0,0,2,0,0,0,0,0,80,
+    20,69,113,20,199,145,36,203,210,52,205,243,84,79,20,69,83,85,85,209,52,
+    85,85,85,77,211,52,77,211,52,77,211,52,77,211,52,77,211,52,77,211,52,
+    77,211,52,77,211,52,77,211,52,77,211,52,77,211,52,77,0,66,67,86,1,
+    0,18,0,0,58,142,227,56,142,226,56,142,227,72,142,36,73,0,66,67,86,
+    1,0,50,0,0,2,0,48,20,197,81,36,199,114,44,73,179,52,203,179,60,
+    77,244,76,207,21,101,83,55,117,213,6,66,67,86,1,0,128,0,0,2,0,
+    0,0,0,0,112,60,199,115,60,199,147,60,201,179,60,199,115,60,201,147,52,
+    77,211,52,77,211,52,77,211,52,77,211,52,77,211,52,77,211,52,77,211,52,
+    77,211,52,77,211,52,77,211,52,77,211,52,77,211,52,77,211,52,77,211,52,
+    0,66,67,86,1,0,8,0,0,128,32,10,25,198,0,66,67,86,1,0,64,
+    0,0,8,33,26,25,67,157,82,18,92,10,22,66,28,17,67,29,66,206,67,
+    169,165,131,224,41,133,37,99,210,83,172,65,8,33,124,239,61,247,222,123,239,
+    1,66,67,86,1,0,64,0,0,132,81,224,32,6,30,147,32,132,16,138,81,
+    156,16,197,153,130,32,132,16,150,147,96,41,231,161,147,32,116,15,66,8,225,
+    114,238,45,231,222,123,239,1,66,67,86,1,0,0,1,0,24,99,84,41,70,
+    153,82,210,74,137,25,115,148,49,70,153,98,146,74,137,165,132,22,66,72,157,
+    115,20,83,169,57,215,156,107,172,185,181,32,132,16,26,83,80,41,5,153,82,
+    142,82,105,25,99,144,41,5,153,82,16,75,73,37,116,18,58,39,157,99,16,
+    91,73,193,214,152,107,139,65,182,28,132,13,154,82,76,41,196,148,82,138,66,
+    8,25,83,140,41,197,148,82,74,66,7,37,116,14,58,230,28,83,142,74,40,
+    65,184,156,115,171,181,150,150,99,139,169,116,146,74,231,36,100,76,66,72,41,
+    133,146,74,7,165,83,78,66,72,53,150,214,82,41,29,115,82,82,106,65,232,
+    32,132,16,66,182,32,132,13,2,66,67,86,1,0,4,0,0,1,0,2,0,
+    66,67,86,1,0,10,0,0,66,49,20,67,81,0,66,67,86,1,0,25,0,
+    0,2,80,20,71,113,20,199,145,28,201,177,36,11,0,66,67,86,1,0,64,
+    0,0,2,0,0,24,142,34,41,146,34,57,150,100,73,154,101,105,154,40,170,
+    170,175,218,166,170,202,190,174,235,186,174,235,186,14,0,66,67,86,1,0,0,
+    1,0,20,99,86,41,102,153,82,146,91,138,25,115,152,49,103,25,99,212,90,
+    138,37,132,20,66,40,165,115,86,91,171,41,181,154,90,202,185,197,156,115,206,
+    149,98,82,41,69,153,82,80,91,138,25,99,82,41,6,25,83,18,91,105,33,
+    132,20,66,7,161,115,18,91,105,173,165,216,90,106,57,182,156,115,173,149,82,
+    78,41,164,24,83,136,74,232,152,82,76,41,164,24,83,138,74,232,156,115,208,
+    57,230,156,83,140,74,8,53,149,90,83,201,49,133,148,91,75,41,116,78,66,
+    7,169,132,206,82,75,177,116,144,74,7,37,116,80,58,107,57,149,18,83,41,
+    157,99,86,66,106,185,165,28,83,202,173,166,152,115,140,1,66,67,86,1,0,
+    4,0,0,1,0,2,0,66,67,86,1,0,10,0,0,194,48,20,69,81,0,
+    66,67,86,1,0,25,0,0,2,112,20,71,113,20,73,145,28,201,177,28,11,
+    0,66,67,86,1,0,64,0,0,2,0,0,24,142,34,41,146,98,57,154,163,
+    73,154,165,89,154,103,202,178,44,203,178,44,203,178,44,203,178,235,186,174,11,
+    0,66,67,86,1,0,64,0,0,36,115,24,42,70,165,115,22,132,16,26,66,
+    80,25,227,28,66,206,107,236,25,66,76,17,130,28,50,76,91,203,37,115,144,
+    33,164,160,66,136,91,40,1,66,67,86,1,0,0,1,0,28,6,225,81,16,
+    42,6,33,132,16,150,244,96,73,14,158,244,32,132,16,34,230,224,81,16,166,
+    5,33,132,16,66,8,33,132,16,66,8,33,132,16,22,229,160,73,14,158,4,
+    33,116,16,142,195,224,48,12,150,227,224,115,16,22,229,96,65,12,158,4,161,
+    131,16,62,8,225,106,14,178,230,32,132,16,146,212,32,65,13,26,228,160,115,
+    16,10,179,160,40,10,18,195,224,90,16,18,212,160,48,10,146,195,32,83,15,
+    46,8,33,106,14,38,213,224,107,16,158,5,225,89,16,166,5,33,132,16,146,
+    4,33,65,14,26,4,33,99,16,26,5,97,73,14,26,228,224,82,16,46,7,
+    161,106,16,170,228,32,124,16,2,66,67,86,1,0,9,0,0,42,138,162,40,
+    138,162,0,66,67,86,1,0,25,0,0,2,40,138,226,56,142,35,57,146,35,
+    57,150,99,1,66,67,86,1,0,64,0,0,2,0,0,40,146,34,41,146,35,
+    57,146,36,73,150,100,73,150,100,73,150,164,121,162,42,203,178,44,203,178,44,
+    203,178,12,0,66,67,86,1,0,9,0,0,42,138,161,40,142,226,0,66,67,
+    86,1,0,25,0,0,2,40,142,98,41,150,98,41,154,226,57,162,35,2,66,
+    67,86,1,0,64,0,0,2,0,0,8,154,161,41,158,35,74,162,103,170,170,
+    107,219,182,109,219,182,109,219,182,109,219,182,109,219,182,45,203,178,12,0,66,
+    67,86,1,0,8,0,0,128,34,76,24,196,0,66,67,86,1,0,64,0,0,
+    128,178,222,88,238,33,247,222,123,239,5,162,30,81,236,33,246,222,123,239,141,
+    179,30,65,235,33,230,222,123,239,185,247,158,106,236,45,247,222,123,207,1,66,
+    67,86,1,0,64,0,0,152,130,160,41,7,46,164,222,123,239,145,97,30,17,
+    165,161,114,220,123,239,145,81,152,8,67,153,81,216,83,169,173,181,30,50,201,
+    45,164,222,115,238,1,66,67,86,1,0,128,0,0,16,66,8,33,133,20,82,
+    72,33,133,20,82,72,33,133,20,82,74,41,166,152,98,138,41,166,152,114,202,
+    41,199,28,115,204,49,200,160,131,14,58,233,36,148,80,66,10,41,148,146,74,
+    42,41,165,148,82,139,181,214,156,123,239,65,247,220,123,16,62,8,33,132,16,
+    66,8,33,132,16,66,8,33,132,16,2,66,67,86,1,0,32,0,0,4,66,
+    8,33,100,16,66,8,33,132,20,82,72,33,166,152,98,202,41,167,0,66,67,
+    86,1,0,128,0,0,2,0,0,0,36,69,82,44,199,114,52,71,115,52,199,
+    115,60,71,148,68,73,148,68,203,180,76,75,213,76,205,244,84,81,21,85,83,
+    85,93,85,117,117,221,181,85,219,181,85,91,182,93,91,181,85,219,181,85,91,
+    181,101,217,182,109,219,182,109,219,182,109,219,182,109,219,182,109,219,182,1,66,
+    67,86,1,0,18,0,0,58,146,35,57,146,34,41,146,34,57,142,35,73,0,
+    66,67,86,1,0,50,0,0,2,0,80,20,197,113,28,71,114,36,199,146,52,
+    73,179,60,203,179,68,77,212,76,77,244,84,79,5,66,67,86,1,0,128,0,
+    0,2,0,0,0,0,0,112,60,197,115,60,199,179,60,201,115,60,199,179,60,
+    205,211,52,77,211,52,77,211,52,77,211,52,77,211,52,77,211,52,77,211,52,
+    77,211,52,77,211,52,77,211,52,77,211,52,77,211,52,77,211,52,77,211,52,
+    77,211,52,0,66,67,86,1,0,18,0,0,58,142,227,56,142,227,56,142,227,
+    56,146,35,57,0,66,67,86,1,0,50,0,0,2,0,144,20,201,177,28,203,
+    209,28,205,241,28,207,17,29,209,49,29,83,50,37,85,114,45,215,2,66,67,
+    86,1,0,128,0,0,2,0,0,0,0,0,208,4,75,209,20,207,241,36,207,
+    243,68,205,243,52,77,243,68,83,20,77,211,52,77,211,52,77,211,52,77,211,
+    52,77,211,52,77,211,52,77,211,52,77,211,52,77,211,52,77,211,52,77,211,
+    52,77,211,52,77,211,20,69,0,66,67,86,1,0,8,0,0,0,49,76,32,
+    197,0,66,67,86,1,0,64,0,0,128,145,164,56,76,154,37,165,148,82,134,
+    162,228,97,82,34,37,165,148,82,22,195,36,98,82,38,22,99,140,49,198,24,
+    99,140,49,198,24,99,140,49,2,66,67,86,1,0,64,0,0,136,146,224,56,
+    106,158,164,230,156,115,134,113,226,40,7,154,147,230,132,115,10,114,160,24,5,
+    158,147,32,92,111,50,230,102,74,107,186,230,230,156,82,2,66,67,86,1,0,
+    128,0,0,16,82,72,33,133,20,82,72,33,133,24,98,136,33,134,24,98,200,
+    33,135,28,114,200,41,167,156,130,10,42,168,160,130,12,50,200,32,147,76,58,
+    233,164,147,78,58,234,168,163,142,58,10,45,180,208,66,11,173,180,18,83,76,
+    181,213,152,107,175,65,23,223,156,115,206,57,231,156,115,206,57,231,156,115,2,
+    66,67,86,1,0,32,0,0,4,66,6,25,100,16,66,8,33,133,20,82,136,
+    41,166,152,114,10,50,200,0,66,67,86,1,0,128,0,0,2,0,0,0,28,
+    69,82,36,197,82,44,199,114,52,71,147,60,201,179,68,77,212,68,207,20,77,
+    81,53,85,85,85,85,213,117,93,217,149,93,219,213,93,219,245,101,97,22,110,
+    225,246,101,225,22,110,97,23,118,221,23,134,97,24,134,97,24,134,97,24,134,
+    225,247,125,223,247,125,223,247,1,66,67,86,1,0,18,0,0,58,146,99,57,
+    158,34,42,162,33,42,158,35,58,0,66,67,86,1,0,50,0,0,2,0,144,
+    4,73,145,20,201,209,36,83,51,53,215,180,77,91,180,85,219,182,101,89,150,
+    101,89,6,66,67,86,1,0,128,0,0,2,0,0,0,0,0,208,52,77,211,
+    52,77,211,52,77,211,52,77,211,52,77,211,52,77,211,52,77,179,44,203,178,
+    44,203,178,44,203,178,44,203,178,44,203,178,44,203,178,44,203,178,44,203,178,
+    44,203,178,44,203,178,44,203,178,44,203,178,44,0,66,67,86,1,0,18,0,
+    0,58,142,227,56,142,35,41,146,34,57,150,99,57,0,66,67,86,1,0,50,
+    0,0,2,0,144,20,75,177,28,205,209,28,205,241,28,207,241,28,207,17,29,
+    81,50,37,83,51,61,211,3,66,67,86,1,0,128,0,0,2,0,0,0,0,
+    0,80,12,71,113,28,71,114,52,201,147,84,203,180,92,205,213,92,207,245,92,
+    211,117,93,215,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,
+    85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,0,66,67,
+    86,1,0,16,0,0,132,116,154,89,170,1,34,204,64,134,1,66,67,86,1,
+    0,8,0,0,128,17,138,48,196,0,66,67,86,1,0,0,1,0,0,98,40,
+    57,136,38,180,230,124,115,142,131,102,57,104,42,197,230,116,112,34,213,230,73,
+    110,42,230,230,156,115,206,57,39,155,115,198,56,231,156,115,138,114,102,49,104,
+    38,180,230,156,115,18,131,102,41,104,38,180,230,156,115,158,196,230,65,107,170,
+    180,230,156,115,198,57,167,131,113,70,24,231,156,115,154,180,230,65,106,54,214,
+    230,156,115,22,180,166,57,106,46,197,230,156,115,34,229,230,73,109,46,213,230,
+    156,115,206,57,231,156,115,206,57,231,156,115,170,23,167,115,112,78,56,231,156,
+    115,162,246,230,90,110,66,23,231,156,115,62,25,167,123,115,66,56,231,156,115,
+    206,57,231,156,115,206,57,231,156,115,2,66,67,86,1,0,64,0,0,4,97,
+    216,24,198,157,130,32,125,142,6,98,20,33,166,33,147,30,116,143,14,147,160,
+    49,200,41,164,30,141,142,70,74,169,131,80,82,25,39,165,116,2,66,67,86,
+    1,0,128,0,0,16,66,72,33,133,20,82,72,33,133,20,82,72,33,133,24,
+    98,136,33,134,156,114,202,41,168,160,146,74,42,170,40,163,204,50,203,44,179,
+    204,50,203,44,179,14,59,235,172,195,14,67,12,49,196,208,74,43,177,212,84,
+    91,141,53,214,154,123,206,185,230,32,173,149,214,90,107,173,148,82,74,41,165,
+    148,2,66,67,86,1,0,32,0,0,4,66,6,25,100,144,81,72,33,133,20,
+    98,136,41,167,156,114,10,42,168,0,66,67,86,1,0,128,0,0,2,0,0,
+    0,60,201,115,68,71,116,68,71,116,68,71,116,68,71,116,68,199,115,60,71,
+    148,68,73,148,68,73,180,76,203,212,76,79,21,85,213,149,93,91,214,101,221,
+    246,109,97,23,118,221,247,117,223,247,117,227,215,133,97,89,150,101,89,150,101,
+    89,150,101,89,150,101,89,150,101,89,2,66,67,86,1,0,32,0,0,0,66,
+    8,33,132,20,82,72,33,133,148,98,140,49,199,156,131,78,66,9,1,66,67,
+    86,1,0,128,0,0,2,0,0,0,28,197,81,28,71,114,36,71,146,44,201,
+    146,52,73,179,52,203,211,60,205,211,68,79,20,69,209,52,77,85,116,69,87,
+    212,77,91,148,77,217,116,77,215,148,77,87,149,85,219,149,101,219,150,109,221,
+    246,101,217,246,125,223,247,125,223,247,125,223,247,125,223,247,125,95,215,1,66,
+    67,86,1,0,18,0,0,58,146,35,41,146,34,41,146,227,56,142,36,73,0,
+    66,67,86,1,0,50,0,0,2,0,80,20,71,113,28,199,145,36,73,146,44,
+    73,147,60,203,179,68,205,212,76,207,244,84,81,5,66,67,86,1,0,128,0,
+    0,2,0,0,0,0,0,80,52,197,83,76,197,83,68,197,115,68,71,148,68,
+    203,180,68,77,213,92,81,54,101,215,117,93,215,117,93,215,117,93,215,117,93,
+    215,117,93,215,117,93,215,117,93,215,117,93,215,117,93,215,117,93,215,117,93,
+    215,117,93,0,66,67,86,1,0,18,0,0,58,146,35,57,146,35,41,146,34,
+    41,146,35,57,0,66,67,86,1,0,50,0,0,2,0,112,12,199,144,20,201,
+    177,44,75,211,60,205,211,60,77,244,68,79,244,76,79,21,93,209,5,66,67,
+    86,1,0,128,0,0,2,0,0,0,0,0,48,36,195,82,44,71,115,52,73,
+    148,84,75,181,84,77,181,84,75,21,85,79,85,85,85,85,85,85,85,85,85,
+    85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,
+    85,85,85,53,77,211,52,77,0,66,67,86,1,0,16,0,0,132,114,144,81,
+    140,1,65,72,41,43,1,66,67,86,1,0,8,0,0,128,32,202,48,196,0,
+    66,67,86,1,0,0,1,0,8,81,30,33,230,161,163,222,123,239,17,114,30,
+    33,230,29,131,222,123,239,33,180,94,57,234,161,164,222,123,239,189,247,30,123,
+    239,185,247,222,123,239,145,97,94,33,231,161,147,222,123,239,17,98,28,25,197,
+    153,114,222,123,239,33,164,156,49,232,157,131,222,123,239,189,247,158,115,238,57,
+    215,222,123,239,157,163,222,65,233,169,212,222,123,239,149,147,94,49,233,157,163,
+    94,123,239,37,213,30,66,234,165,164,222,123,239,189,247,222,123,239,189,247,222,
+    123,239,189,247,158,123,239,189,247,222,123,239,173,231,222,106,239,189,247,222,123,
+    239,189,247,222,123,239,189,247,222,123,239,189,247,222,123,239,189,247,222,123,239,
+    1,66,67,86,1,0,64,0,0,132,97,216,32,198,29,147,222,107,239,133,97,
+    158,24,166,157,147,222,123,238,149,163,158,49,232,41,196,222,123,238,189,247,94,
+    123,239,189,247,222,123,239,1,66,67,86,1,0,128,0,0,16,66,8,33,133,
+    20,82,72,33,133,20,98,136,33,134,28,114,200,33,136,160,146,74,42,170,168,
+    162,138,42,170,168,162,202,50,202,40,163,140,50,201,40,163,204,50,234,168,163,
+    142,58,236,44,164,144,66,42,173,180,208,74,75,181,245,214,82,237,65,8,33,
+    132,16,66,8,33,132,16,66,8,225,123,239,1,66,67,86,1,0,32,0,0,
+    140,49,198,24,99,16,66,8,33,132,16,82,74,41,165,152,98,138,41,166,0,
+    66,67,86,1,0,128,0,0,2,0,0,0,44,73,147,52,71,115,60,199,115,
+    60,199,83,60,71,116,68,71,116,68,71,148,68,73,180,68,77,244,68,81,52,
+    69,85,180,69,221,212,77,221,212,77,93,213,77,219,181,85,91,182,101,93,215,
+    93,93,215,101,93,214,101,93,215,117,93,215,117,93,215,117,93,215,117,93,183,
+    1,66,67,86,1,0,32,0,0,132,65,6,25,100,16,66,8,33,133,20,82,
+    74,41,198,24,99,204,57,231,0,66,67,86,1,0,128,0,0,2,0,0,0,
+    20,71,113,20,199,145,28,73,146,44,203,210,44,207,242,44,81,51,53,83,51,
+    53,87,115,53,87,116,85,215,116,77,87,117,93,215,116,77,215,116,69,87,117,
+    93,215,117,85,87,117,93,215,117,93,215,117,77,211,117,93,215,53,93,215,117,
+    93,215,117,93,215,117,93,215,117,1,66,67,86,1,0,18,0,0,58,142,227,
+    56,142,227,56,142,227,56,142,35,73,0,66,67,86,1,0,50,0,0,2,0,
+    80,20,197,113,28,199,113,36,73,146,44,75,179,52,203,179,68,77,212,68,81,
+    21,93,211,5,66,67,86,1,0,128,0,0,2,0,0,0,0,0,80,44,69,
+    83,52,73,211,52,77,179,52,77,211,52,77,211,52,77,211,52,77,211,52,77,
+    211,52,77,211,52,77,211,52,77,211,52,77,211,52,77,211,52,77,211,52,77,
+    211,52,77,211,52,77,211,52,77,211,52,77,211,52,0,66,67,86,1,0,18,
+    0,0,42,142,227,56,142,227,56,146,35,57,146,227,72,0,66,67,86,1,0,
+    50,0,0,2,0,80,12,71,113,28,71,146,44,201,146,52,203,178,52,77,243,
+    68,81,116,77,213,52,93,211,4,66,67,86,1,0,128,0,0,2,0,0,0,
+    0,0,80,44,73,147,52,77,211,52,73,147,52,73,147,52,77,211,52,71,211,
+    52,77,211,52,77,211,52,77,211,52,77,211,52,77,211,52,77,211,52,77,211,
+    52,77,211,52,77,211,52,77,211,52,77,211,44,203,178,44,203,178,44,0,66,
+    67,86,1,0,0,1,0,12,82,20,33,37,25,83,74,99,8,149,82,82,41,
+    5,29,99,80,91,71,29,99,212,57,70,33,100,16,83,136,73,25,165,123,79,
+    42,149,88,74,200,17,82,88,41,69,29,83,76,83,73,149,82,150,41,69,29,
+    99,20,83,72,33,83,214,49,101,161,115,20,75,134,73,9,37,108,77,174,116,
+    22,75,232,153,99,150,49,70,29,99,206,90,74,157,99,214,49,69,29,99,82,
+    82,73,161,115,24,58,102,37,100,20,58,70,197,232,98,124,48,58,149,162,66,
+    40,190,199,222,82,233,45,133,138,91,138,189,215,26,83,235,45,132,24,75,105,
+    193,8,97,115,237,181,213,220,74,106,197,24,99,140,49,198,197,226,83,40,2,
+    66,67,86,1,0,4,0,0,0,17,4,0,66,67,86,1,0,10,0,0,194,
+    80,12,69,81,0,66,67,86,1,0,25,0,0,2,80,20,197,81,28,199,113,
+    28,73,146,44,11,0,66,67,86,1,0,64,0,0,2,0,0,40,142,225,40,
+    146,35,73,146,100,89,150,101,89,150,166,121,150,168,185,170,47,251,174,46,235,
+    174,237,234,186,14,0,66,67,86,4,0,81,0,0,128,49,136,49,196,28,114,
+    206,73,233,36,69,206,57,41,157,148,6,66,104,169,163,212,89,42,173,150,24,
+    51,74,165,182,84,107,3,161,163,20,82,203,40,149,88,75,171,29,181,82,107,
+    137,173,0,0,128,0,7,0,128,0,11,33,66,67,86,4,0,81,0,0,132,
+    49,72,41,164,20,98,140,57,200,28,68,140,49,232,24,100,134,49,6,33,115,
+    78,65,199,28,133,84,42,7,29,117,80,82,195,24,115,142,65,168,160,131,84,
+    58,71,149,131,80,82,71,157,0,0,128,0,7,0,128,0,11,33,66,67,86,
+    4,0,113,2,0,6,73,210,52,75,211,60,207,210,60,207,243,68,81,85,61,
+    81,84,85,75,244,76,211,51,77,85,245,76,83,85,77,213,148,93,81,53,101,
+    217,242,68,211,244,76,83,85,61,211,84,85,209,84,101,215,52,85,215,245,84,
+    213,150,77,87,213,101,209,85,117,219,181,101,223,118,101,89,184,61,85,149,109,
+    81,117,109,221,84,93,89,87,101,217,246,93,217,182,125,73,20,85,85,84,85,
+    215,245,84,213,117,85,215,213,109,211,117,117,221,83,85,217,53,93,87,150,77,
+    215,181,101,215,149,109,93,149,101,225,215,84,85,150,77,215,181,101,211,117,101,
+    219,149,93,221,86,101,89,183,69,215,245,117,85,150,133,223,148,101,223,151,109,
+    93,247,101,221,86,134,209,117,109,95,149,101,221,55,101,89,248,101,91,22,118,
+    87,215,125,97,18,69,85,245,84,85,118,69,85,117,93,211,117,109,93,117,93,
+    219,214,84,83,118,77,215,181,101,83,117,101,89,149,101,221,119,93,89,215,53,
+    85,149,101,83,150,109,219,116,93,89,86,101,217,215,93,89,214,109,209,117,117,
+    221,148,101,225,87,93,89,215,93,221,54,142,217,182,125,97,116,93,221,55,101,
+    89,247,85,89,214,125,89,215,133,97,214,109,95,215,84,85,247,77,217,245,133,
+    211,149,117,97,247,125,99,152,117,93,56,62,215,245,125,85,182,133,99,149,101,
+    227,215,133,95,88,110,93,23,126,207,117,125,93,181,101,99,88,101,219,24,118,
+    223,55,134,217,247,141,99,213,109,99,152,109,221,232,234,58,97,248,133,225,184,
+    125,227,168,218,182,208,213,109,97,121,117,219,168,27,63,225,54,126,163,166,170,
+    190,110,186,174,241,155,178,236,235,178,110,11,195,237,251,202,241,185,174,239,171,
+    178,108,252,170,108,11,191,173,235,202,177,251,62,229,115,93,95,88,101,89,24,
+    86,91,22,134,89,215,133,101,23,134,165,106,235,202,240,234,190,113,188,182,174,
+    12,183,47,52,126,95,25,170,182,109,44,175,110,11,195,236,219,194,111,11,191,
+    113,236,198,206,24,0,0,48,224,0,0,16,96,66,25,8,66,67,86,4,0,
+    113,2,0,22,73,242,60,203,178,68,209,178,44,81,20,77,81,85,69,81,84,
+    85,75,211,76,83,211,60,211,212,52,207,52,77,211,84,93,209,52,85,215,210,
+    52,211,212,60,205,52,53,79,51,77,83,53,93,213,52,77,217,20,77,211,117,
+    77,213,180,93,81,85,101,89,117,101,89,86,93,87,151,69,211,116,101,81,53,
+    93,217,52,85,87,86,93,215,149,85,215,149,101,73,211,76,83,243,60,211,212,
+    60,207,52,77,213,116,101,211,84,93,215,242,60,213,212,60,209,116,61,81,84,
+    85,213,84,85,215,84,85,217,213,60,207,84,61,209,83,77,79,20,85,213,116,
+    77,89,53,85,85,150,77,213,180,101,211,84,101,217,116,85,91,118,85,217,149,
+    101,87,182,109,83,85,101,217,84,77,87,54,93,215,181,93,215,181,93,87,118,
+    133,93,210,52,211,212,60,207,52,53,207,83,77,211,84,93,215,84,85,87,182,
+    60,79,53,61,81,84,85,205,19,77,85,85,85,215,53,77,213,149,45,207,51,
+    85,79,20,85,85,19,53,213,52,93,87,150,85,213,148,85,81,53,109,89,85,
+    85,93,54,77,85,150,93,89,182,109,87,117,93,217,84,85,87,54,85,87,150,
+    77,213,148,93,215,149,109,174,172,202,170,103,154,178,108,170,170,45,155,170,42,
+    187,178,109,219,186,235,186,186,45,170,166,236,154,166,42,219,170,170,234,174,236,
+    218,186,47,203,178,45,139,170,234,186,166,171,202,178,169,170,178,45,203,178,174,
+    203,178,45,236,170,235,218,182,169,186,178,238,202,50,93,86,109,215,183,125,155,
+    174,186,174,237,171,178,235,235,174,44,219,186,107,187,186,172,219,182,239,123,166,
+    41,203,166,106,202,182,169,170,178,44,203,174,109,219,178,236,11,163,105,186,182,
+    233,170,182,108,170,174,108,187,174,171,235,178,44,219,182,104,154,178,108,170,174,
+    107,155,170,41,203,178,44,219,190,44,203,182,173,186,178,46,187,182,108,251,174,
+    43,203,182,108,219,194,46,187,194,236,171,174,108,235,174,108,219,194,234,170,182,
+    45,251,182,207,214,85,93,21,0,0,48,224,0,0,16,96,66,25,8,66,67,
+    86,2,0,81,0,0,128,49,140,49,6,161,81,202,57,231,32,52,74,57,231,
+    28,132,204,57,8,33,164,146,57,7,33,132,146,50,231,32,148,146,82,230,28,
+    132,82,82,10,33,148,146,82,107,33,132,82,82,106,173,0,0,128,2,7,0,
+    128,0,27,52,37,22,7,8,66,67,86,2,0,169,0,0,6,199,209,52,211,
+    116,93,89,54,134,197,178,68,81,85,101,217,182,141,97,177,44,81,84,85,89,
+    182,109,225,216,68,81,85,101,217,182,117,29,77,20,85,85,150,109,91,247,149,
+    227,84,85,89,182,109,95,23,142,76,85,149,101,219,214,117,223,72,149,101,219,
+    214,117,97,168,164,202,178,109,219,186,111,84,146,109,91,215,141,225,56,42,201,
+    182,173,251,190,111,28,75,124,97,40,44,75,37,124,229,23,142,74,32,0,0,
+    60,193,1,0,168,192,134,213,17,78,138,198,2,3,66,67,86,2,0,25,0,
+    0,128,65,74,25,165,148,50,74,41,165,148,98,76,41,197,152,0,0,128,1,
+    7,0,128,0,19,202,64,66,67,86,4,0,81,0,0,128,115,206,57,231,156,
+    115,206,57,231,156,115,206,57,231,156,115,206,57,231,28,99,140,49,198,24,99,
+    140,49,198,24,99,140,49,198,24,99,140,49,198,24,99,140,49,198,24,99,140,
+    49,198,152,0,128,157,8,7,128,157,8,11,33,66,67,86,2,0,225,0,0,
+    0,66,10,65,73,169,148,82,74,137,156,115,82,74,41,165,148,82,74,228,32,
+    132,82,74,41,165,148,82,34,233,164,148,82,74,41,165,148,210,56,40,165,148,
+    82,74,41,165,148,80,74,41,165,148,82,74,41,165,132,82,74,41,165,148,82,
+    74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,
+    41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,
+    165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,
+    148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,0,0,147,7,7,0,
+    168,4,27,103,88,73,58,43,28,13,14,66,67,86,2,0,185,1,0,128,82,
+    204,49,38,161,132,84,66,42,33,132,80,42,199,32,116,78,74,72,169,181,18,
+    82,104,37,84,208,65,235,28,133,148,90,106,173,164,84,74,202,36,132,16,66,
+    9,37,148,210,74,41,169,149,146,65,8,37,132,82,66,8,41,149,82,74,8,
+    45,131,18,82,40,161,164,148,74,106,161,165,82,74,6,33,132,210,74,72,173,
+    164,214,82,40,169,164,12,74,73,37,148,148,82,105,173,165,84,82,106,29,148,
+    150,74,105,173,181,86,82,10,169,180,148,58,40,37,181,148,74,41,173,181,80,
+    90,107,173,117,146,74,105,33,181,150,90,107,173,180,82,74,233,44,165,84,74,
+    106,173,181,212,90,75,41,181,18,74,105,165,149,214,74,41,169,181,150,90,107,
+    169,164,214,90,106,45,181,150,90,107,45,181,86,74,41,41,181,212,90,107,173,
+    181,212,82,73,169,165,20,74,41,173,148,20,82,75,45,181,86,82,105,33,132,
+    150,74,42,173,180,210,90,75,41,165,84,66,41,169,164,212,82,73,173,181,148,
+    66,43,45,148,86,74,42,41,181,84,82,73,41,165,150,82,9,165,148,144,82,
+    9,173,164,150,90,75,45,181,84,82,105,169,165,150,90,73,165,180,84,82,74,
+    165,0,0,160,3,7,0,128,0,35,42,45,196,78,51,174,60,2,71,20,50,
+    76,64,1,66,67,86,2,0,64,0,0,8,114,76,59,72,146,64,8,42,72,
+    158,65,204,65,76,154,81,8,42,72,174,99,80,82,76,30,114,10,42,70,158,
+    147,140,25,68,46,40,93,100,42,2,66,67,86,2,0,100,0,0,136,146,206,
+    58,237,52,73,4,33,166,40,243,164,33,197,24,164,150,148,101,24,98,74,50,
+    49,158,98,140,49,7,197,104,200,33,134,156,18,227,66,9,33,116,80,140,199,
+    164,114,72,25,42,42,247,150,58,167,160,216,98,140,239,61,246,34,0,66,67,
+    86,4,0,81,0,0,128,49,136,49,196,24,114,140,73,201,160,68,204,49,9,
+    153,148,200,57,39,165,147,146,73,41,169,149,22,51,41,33,166,210,98,228,156,
+    147,210,73,201,164,148,214,66,106,153,164,210,90,137,169,0,0,128,0,7,0,
+    128,0,11,33,66,67,86,4,0,81,0,0,136,49,72,41,164,20,82,74,49,
+    167,152,67,74,41,199,148,99,72,41,229,156,114,78,57,199,152,116,16,42,231,
+    24,116,14,74,164,148,114,142,57,167,156,115,18,50,7,149,115,14,66,38,157,
+    0,0,128,0,7,0,128,0,11,33,66,67,86,4,0,113,2,0,0,66,206,
+    41,198,32,68,140,65,8,37,164,20,66,73,169,114,78,74,7,37,165,14,74,
+    74,37,165,22,75,74,49,86,206,73,233,36,164,212,73,72,169,164,20,99,73,
+    41,182,144,82,141,165,181,92,75,75,53,182,24,115,110,49,246,26,82,138,181,
+    164,86,107,105,173,230,22,99,205,45,214,220,35,231,40,117,82,90,235,164,180,
+    150,90,171,53,181,86,107,39,165,181,144,90,139,165,181,24,91,139,53,167,24,
+    115,206,164,180,22,90,138,173,164,22,99,139,45,215,212,98,206,165,181,92,83,
+    140,61,167,24,123,174,177,230,30,115,14,194,180,86,115,106,45,231,20,99,238,
+    49,199,158,99,206,61,72,206,81,234,164,180,214,73,105,45,181,86,107,106,173,
+    214,76,74,107,165,181,26,67,106,45,182,24,115,110,45,198,156,73,105,177,164,
+    22,99,105,41,198,20,99,206,45,182,92,67,107,185,166,24,115,78,45,230,28,
+    107,13,74,198,218,123,105,173,230,20,99,238,41,182,158,99,206,193,216,28,123,
+    238,40,229,90,90,235,185,180,214,123,205,185,8,89,115,47,162,181,156,83,171,
+    61,168,24,123,206,57,7,99,115,15,66,180,150,115,170,177,247,20,99,239,185,
+    231,96,108,207,193,183,90,131,111,53,23,33,115,14,66,231,226,155,238,193,24,
+    85,107,15,50,215,34,100,206,65,232,160,139,208,193,39,227,81,170,185,180,150,
+    115,105,173,247,88,107,240,53,231,32,68,107,185,167,24,123,79,45,246,94,123,
+    110,194,246,30,132,104,45,247,20,99,15,42,198,224,107,206,193,232,156,139,81,
+    181,6,31,115,14,66,214,90,132,238,189,40,157,131,80,170,214,30,100,174,65,
+    201,92,139,208,193,23,163,131,46,190,0,0,128,1,7,0,128,0,19,202,64,
+    66,67,86,4,0,113,2,0,12,66,206,41,197,32,84,74,65,8,37,164,20,
+    66,73,169,98,76,66,198,28,148,140,57,41,165,148,210,66,40,169,85,140,65,
+    200,28,147,146,57,38,37,148,208,82,41,161,149,80,74,75,165,148,214,66,41,
+    173,181,212,98,76,169,181,24,74,73,45,148,210,90,41,165,181,212,82,141,169,
+    181,26,35,198,164,100,206,73,201,28,147,82,74,105,173,148,210,90,229,152,148,
+    140,65,73,29,132,84,74,73,41,150,146,90,172,156,147,146,65,71,165,131,80,
+    82,73,37,166,146,74,107,37,149,150,74,41,45,150,148,98,75,41,166,218,90,
+    172,53,148,210,98,73,37,182,146,82,139,169,165,218,90,140,185,70,140,73,201,
+    152,147,146,57,39,165,148,146,90,41,165,181,204,57,41,29,116,84,50,7,37,
+    149,148,90,43,37,165,152,49,39,165,115,80,82,6,25,149,146,82,108,41,149,
+    152,66,41,173,149,148,98,43,37,181,214,98,172,53,165,214,106,41,169,181,146,
+    82,139,165,148,216,90,140,185,182,88,106,234,164,180,86,82,137,49,148,210,90,
+    139,49,215,212,90,140,161,148,216,74,73,49,150,84,98,107,45,214,220,98,203,
+    49,148,210,98,73,37,182,82,82,139,173,182,28,91,139,53,167,150,106,76,169,
+    213,220,98,203,53,166,156,122,172,181,231,212,90,173,169,165,26,91,139,53,199,
+    218,122,171,181,230,220,73,105,45,148,210,90,41,41,198,212,90,140,45,198,154,
+    67,41,177,149,148,98,43,37,197,216,98,203,181,181,24,123,8,165,197,82,82,
+    139,37,149,24,91,139,49,199,216,114,76,173,213,218,98,203,53,165,22,107,173,
+    181,231,216,114,235,41,181,88,91,140,53,151,150,106,172,185,246,30,107,202,169,
+    0,0,128,1,7,0,128,0,19,202,64,66,67,86,2,0,81,0,0,128,49,
+    140,49,6,161,81,202,57,231,164,52,72,57,231,156,148,204,57,8,33,164,148,
+    57,7,33,132,148,50,231,36,164,212,82,230,28,132,148,90,11,165,164,212,90,
+    108,161,148,148,90,107,177,0,0,128,2,7,0,128,0,27,52,37,22,7,8,
+    66,67,86,2,0,81,0,0,136,49,74,49,6,161,49,70,41,231,32,52,198,
+    40,197,24,132,74,41,198,156,147,80,41,197,152,115,80,50,199,156,131,80,74,
+    230,156,115,16,74,9,33,148,82,74,74,33,132,82,74,73,169,0,0,128,2,
+    7,0,128,0,27,52,37,22,7,8,66,67,86,4,0,81,0,0,128,49,198,
+    57,227,28,162,208,89,234,44,69,146,58,106,29,181,134,82,170,177,196,216,105,
+    108,181,183,158,59,173,177,215,150,123,67,169,212,152,106,237,184,182,156,91,237,
+    157,214,212,115,203,177,0,0,176,3,7,0,176,3,11,33,66,67,86,2,0,
+    121,0,0,132,49,74,49,230,156,115,70,33,198,156,115,206,57,131,20,99,206,
+    57,231,156,98,204,57,231,32,132,80,49,230,156,115,16,66,200,156,115,14,66,
+    40,161,100,206,57,7,33,132,18,58,231,32,148,82,74,41,157,115,16,66,40,
+    165,148,206,57,8,161,148,82,74,231,28,132,82,74,41,165,0,0,160,2,7,
+    0,128,0,27,69,54,39,24,9,10,66,67,86,2,0,121,0,0,128,49,8,
+    57,39,165,181,134,49,231,32,180,84,99,195,24,115,80,82,138,45,114,14,66,
+    74,45,230,26,49,7,33,165,24,131,238,160,164,212,98,176,193,119,18,82,106,
+    45,230,28,76,74,45,214,156,123,15,34,165,214,106,14,58,247,84,91,205,61,
+    247,222,115,138,177,214,156,123,207,189,0,0,220,5,7,0,176,3,27,69,54,
+    39,24,9,10,66,67,86,2,0,121,0,0,4,66,74,49,230,156,115,70,41,
+    198,28,115,206,57,163,20,99,140,57,231,156,98,140,49,231,156,115,80,49,198,
+    152,115,206,65,200,24,115,206,57,8,33,100,140,57,231,28,132,16,58,231,156,
+    131,16,66,8,157,115,206,65,8,33,132,206,57,232,32,132,16,66,231,28,132,
+    16,66,8,161,0,0,160,2,7,0,128,0,27,69,54,39,24,9,10,66,67,
+    86,2,0,225,0,0,0,132,16,66,8,33,132,16,66,8,33,132,16,66,8,
+    33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,
+    132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,
+    16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,
+    66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,
+    8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,
+    161,115,206,57,231,156,115,206,57,231,156,115,206,57,231,156,115,206,57,231,156,
+    0,32,223,10,7,0,255,7,27,103,88,73,58,43,28,13,14,66,67,86,2,
+    0,225,0,0,128,66,16,74,169,24,132,82,74,137,164,147,78,74,231,36,148,
+    82,74,228,160,148,82,58,41,165,148,82,66,41,165,148,18,66,41,165,148,18,
+    66,7,165,148,80,74,41,165,148,82,74,41,165,148,82,74,41,165,148,78,74,
+    41,165,148,82,74,41,165,114,78,74,233,164,148,82,74,41,145,115,82,74,8,
+    165,148,82,74,41,161,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,
+    148,82,74,41,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,
+    16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,161,0,0,
+    238,6,7,0,136,4,27,103,88,73,58,43,28,13,14,66,67,86,2,0,33,
+    1,0,128,82,204,57,42,33,164,80,66,74,161,98,138,58,10,165,164,144,74,
+    41,41,68,140,57,39,169,115,20,66,73,161,164,14,42,231,32,148,146,82,10,
+    169,132,212,57,7,29,148,20,66,74,37,132,84,58,234,160,163,80,66,73,169,
+    148,80,74,231,160,148,18,82,40,41,165,84,66,10,33,165,210,81,74,161,148,
+    84,82,10,169,132,84,74,41,33,149,84,66,40,41,116,146,82,41,41,164,146,
+    82,73,33,116,210,65,10,157,148,144,74,42,41,164,78,82,74,169,148,148,82,
+    42,41,149,208,73,9,169,164,148,66,8,41,165,82,66,40,33,165,148,58,73,
+    37,165,146,82,8,161,132,20,82,74,41,149,148,74,42,41,133,84,82,9,37,
+    148,146,82,74,161,132,146,82,73,41,165,148,74,74,165,0,0,128,3,7,0,
+    128,0,35,232,36,163,202,34,108,52,225,194,3,16,66,67,86,2,0,100,0,
+    0,16,147,144,74,78,177,87,70,41,198,36,180,94,42,164,20,147,212,123,168,
+    152,98,76,58,237,169,66,6,41,7,185,135,74,33,165,160,211,222,50,165,144,
+    82,12,123,167,152,66,200,24,234,161,131,144,49,133,176,215,218,115,207,189,247,
+    30,0,66,67,86,2,0,100,0,0,144,147,82,82,106,181,104,8,41,7,165,
+    213,32,34,131,148,147,20,147,136,140,65,10,74,11,158,66,198,32,38,41,119,
+    140,41,132,20,164,218,65,199,20,82,140,106,72,41,100,74,41,168,169,230,24,
+    58,198,160,198,156,132,75,37,148,26,0,66,67,86,4,0,81,0,0,0,66,
+    136,49,196,24,98,140,65,200,32,68,140,49,8,29,132,136,49,7,33,131,144,
+    65,8,37,133,82,50,8,161,132,80,82,228,24,131,208,65,200,32,132,84,66,
+    40,25,132,80,74,72,165,0,0,128,0,7,0,128,0,11,33,66,67,86,4,
+    0,113,2,0,8,66,206,33,198,32,68,140,65,8,37,164,20,66,72,41,98,
+    12,66,230,156,148,204,57,41,165,148,214,66,41,169,69,140,65,200,156,147,146,
+    57,39,37,148,210,82,41,165,181,80,74,107,165,148,214,66,41,173,181,214,106,
+    77,173,197,26,74,105,45,148,210,90,41,165,181,212,90,141,173,181,26,35,198,
+    32,100,206,73,201,156,147,82,74,105,173,148,210,90,230,28,149,14,66,74,29,
+    132,148,74,74,45,150,148,90,204,156,147,210,65,71,165,131,144,82,73,37,182,
+    146,82,140,37,149,216,74,74,49,150,148,98,108,45,198,218,98,172,53,148,210,
+    90,73,37,182,146,82,140,45,182,26,91,140,53,71,140,65,201,156,147,146,57,
+    39,165,148,210,90,41,169,181,204,57,41,29,132,148,58,7,37,149,148,98,44,
+    37,181,152,57,39,165,131,144,82,7,33,165,146,82,108,37,165,216,66,41,173,
+    149,148,98,44,37,181,216,98,204,181,181,216,106,40,169,197,146,82,140,37,165,
+    24,91,140,181,182,216,106,236,164,180,22,82,137,45,148,210,98,139,177,214,214,
+    90,173,161,148,24,75,74,49,150,148,98,140,49,214,220,98,172,57,148,210,98,
+    73,37,198,146,82,139,45,182,92,91,140,53,167,214,114,109,45,214,220,98,204,
+    53,198,92,123,173,181,231,212,90,173,169,181,90,91,140,53,199,26,115,172,181,
+    230,222,65,105,45,148,18,91,40,169,197,214,90,173,45,198,90,67,41,177,149,
+    148,98,44,37,197,216,98,204,181,181,88,115,40,37,198,146,82,140,37,165,24,
+    91,140,181,198,24,115,78,173,213,216,98,204,53,181,86,107,173,181,231,24,107,
+    236,169,181,90,91,140,53,183,216,106,173,181,246,94,115,236,181,0,0,128,1,
+    7,0,128,0,19,202,64,66,67,86,2,0,81,0,0,132,49,74,49,6,161,
+    65,72,41,199,32,52,8,41,197,28,132,74,41,198,156,147,82,41,197,152,115,
+    82,50,199,156,131,144,74,198,156,115,16,74,10,33,148,146,74,74,33,132,82,
+    74,74,169,0,0,128,2,7,0,128,0,27,52,37,22,7,8,66,67,86,2,
+    0,33,1,0,4,66,74,49,230,28,132,82,82,74,41,66,136,41,199,32,132,
+    80,74,74,173,69,8,41,197,156,131,16,74,73,169,181,138,41,198,156,131,16,
+    66,41,41,181,86,41,198,152,115,16,66,40,37,165,214,50,231,156,131,16,66,
+    41,41,165,212,90,198,156,115,16,66,40,37,165,148,90,235,32,132,16,66,41,
+    165,164,212,90,107,29,132,16,66,40,165,148,148,90,107,45,132,16,66,41,165,
+    148,148,82,107,49,134,16,66,40,165,148,84,82,106,45,198,82,74,41,41,165,
+    148,82,106,173,197,88,74,41,37,165,148,82,106,169,181,24,83,74,41,165,212,
+    90,107,173,197,24,99,74,41,165,148,90,107,45,182,24,99,76,173,181,214,90,
+    107,49,198,24,99,173,169,181,214,90,107,49,198,24,99,172,181,0,0,128,3,
+    7,0,128,0,35,232,36,163,202,34,108,52,225,194,3,16,66,67,86,4,0,
+    81,0,0,128,49,136,49,196,24,114,142,65,200,160,68,206,49,9,153,132,200,
+    57,71,165,147,146,73,9,161,149,214,50,41,161,149,146,90,228,156,147,210,81,
+    202,168,148,150,66,105,153,164,210,90,104,161,0,0,176,3,7,0,176,3,11,
+    33,66,67,86,2,0,121,0,0,4,66,74,49,230,156,115,72,41,198,24,115,
+    206,57,164,148,98,140,57,231,156,98,140,49,231,156,115,78,49,198,152,115,206,
+    57,199,24,115,206,57,231,156,99,140,57,231,156,115,206,57,231,156,115,206,57,
+    8,157,115,206,57,231,28,132,206,57,231,156,131,16,66,231,156,115,206,65,8,
+    161,0,0,160,2,7,0,128,0,27,69,54,39,24,9,10,66,67,86,2,0,
+    169,0,0,0,50,140,57,231,156,148,148,26,165,24,131,16,66,41,41,53,74,
+    49,6,33,132,82,82,202,156,131,16,66,41,41,181,150,49,6,157,132,82,82,
+    106,173,131,16,74,41,41,181,22,99,7,161,132,82,82,106,45,198,14,66,41,
+    41,165,212,90,140,29,132,82,82,106,169,181,24,75,41,41,181,214,90,140,181,
+    150,82,82,106,173,181,24,107,77,41,181,22,99,140,181,214,154,82,106,45,198,
+    24,107,173,181,0,0,240,4,7,0,160,2,27,86,71,56,41,26,11,12,66,
+    67,86,2,0,25,0,0,129,0,0,0,0,0,0,0,0,0,0,0,66,8,
+    0,0,0,66,67,86,2,0,169,0,0,128,49,140,57,231,28,132,82,26,165,
+    156,131,16,66,41,169,52,74,57,7,33,132,82,82,202,156,147,80,74,41,41,
+    181,150,57,39,165,148,82,82,106,173,131,80,74,74,41,181,22,99,7,161,148,
+    148,82,106,45,198,14,66,42,41,181,22,99,141,29,132,82,82,106,45,198,24,
+    67,41,41,181,22,99,140,181,134,82,82,106,45,198,24,107,45,41,181,22,99,
+    141,181,230,90,82,106,45,198,26,107,205,181,0,0,132,6,7,0,176,3,27,
+    86,71,56,41,26,11,12,66,67,86,2,0,121,0,0,4,66,140,49,198,152,
+    115,72,41,198,24,115,206,57,164,20,99,140,57,231,28,99,140,49,231,156,115,
+    142,49,198,152,115,206,57,199,24,115,206,57,231,156,99,140,57,231,156,115,206,
+    49,231,156,115,206,57,231,152,115,206,57,231,156,115,206,57,231,156,115,206,57,
+    231,156,115,206,57,231,156,0,0,160,2,7,0,128,0,27,69,54,39,24,9,
+    10,66,67,86,2,0,225,0,0,128,49,140,57,199,24,116,18,82,106,152,130,
+    14,66,8,37,164,208,66,163,152,115,16,66,40,165,164,212,50,232,164,164,84,
+    74,74,173,197,150,57,39,165,164,82,82,74,173,197,14,66,74,41,165,212,90,
+    140,49,118,16,82,74,41,165,214,98,140,181,131,80,74,74,45,197,88,99,173,
+    29,132,82,82,106,173,181,24,107,13,165,164,212,90,108,49,214,154,115,40,37,
+    165,214,90,140,177,214,154,75,74,173,197,88,99,173,185,230,92,82,106,45,182,
+    88,107,173,53,231,212,90,140,49,214,154,107,206,189,167,214,98,140,177,214,154,
+    115,238,189,0,0,147,7,7,0,168,4,27,103,88,73,58,43,28,13,14,66,
+    67,86,2,0,185,1,0,8,66,140,57,231,28,132,16,66,8,33,132,16,34,
+    165,24,115,14,66,8,33,132,16,66,41,165,68,74,49,230,28,132,16,66,8,
+    33,132,16,66,200,24,115,14,58,8,33,132,80,74,41,165,148,146,49,230,28,
+    132,16,66,8,161,132,82,74,40,161,115,14,58,8,33,148,80,74,41,165,148,
+    82,74,231,156,131,16,66,8,161,148,82,74,41,165,148,14,66,8,33,132,80,
+    74,41,165,148,82,74,41,29,132,16,66,8,165,148,82,74,41,165,148,82,66,
+    8,33,132,80,74,41,165,148,82,74,41,165,132,16,66,8,161,148,82,74,41,
+    165,148,82,74,9,33,132,80,74,41,165,148,82,74,41,165,148,18,66,8,161,
+    148,82,74,41,165,148,82,74,41,37,132,80,74,41,165,148,82,74,41,165,148,
+    82,74,8,161,148,82,74,41,165,148,82,74,41,165,148,16,74,41,165,148,82,
+    74,41,165,148,82,74,41,161,148,82,74,41,165,148,82,74,41,165,148,82,66,
+    41,165,148,82,74,41,165,148,82,74,41,165,132,82,74,41,165,148,82,74,41,
+    165,148,82,74,9,165,148,82,74,41,165,148,82,74,41,165,148,18,74,41,165,
+    148,82,74,41,165,148,82,74,41,165,0,0,160,3,7,0,128,0,35,42,45,
+    196,78,51,174,60,2,71,20,50,76,64,1,66,67,86,2,0,225,0,0,0,
+    34,208,65,8,33,132,16,66,136,152,131,16,66,8,33,132,16,66,196,28,132,
+    16,66,8,33,132,16,66,8,33,132,16,66,40,165,148,82,74,41,165,148,82,
+    74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,
+    41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,
+    165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,
+    148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,
+    82,74,41,165,148,82,74,41,165,148,82,74,41,165,0,168,203,12,7,192,232,
+    9,27,103,88,73,58,43,28,13,14,66,67,86,2,0,105,1,0,128,49,140,
+    49,198,20,100,210,89,139,177,214,134,49,8,161,131,78,66,10,53,212,18,83,
+    195,24,132,16,58,40,37,165,22,91,172,57,131,80,82,41,165,164,22,99,172,
+    193,230,158,65,40,165,148,82,82,139,177,214,156,139,241,32,164,146,82,106,177,
+    213,218,115,14,70,119,16,74,73,41,165,24,107,205,57,247,94,52,232,164,164,
+    212,90,173,57,247,158,131,47,30,132,82,82,107,45,198,158,131,15,70,24,81,
+    74,75,49,214,88,107,14,190,8,35,140,40,165,165,22,99,205,189,230,94,140,
+    49,66,165,20,99,173,61,231,220,115,46,198,8,159,82,139,49,215,220,123,15,
+    62,23,97,124,113,49,230,156,123,241,193,7,31,132,48,70,200,24,115,236,57,
+    248,222,139,49,198,7,97,100,174,57,23,97,140,241,69,24,97,124,16,182,214,
+    220,131,47,198,8,35,140,49,190,247,26,124,208,189,24,97,132,17,198,24,97,
+    132,238,185,232,34,124,49,198,24,35,140,47,194,0,128,220,8,7,0,196,5,
+    35,9,169,179,12,43,141,184,241,4,12,17,72,66,67,86,1,0,49,0,0,
+    4,49,198,32,164,144,82,74,41,197,24,99,140,49,198,24,99,140,49,198,24,
+    99,140,49,198,156,99,206,57,231,156,0,0,192,4,7,0,128,0,43,216,149,
+    89,90,181,81,220,212,73,94,244,65,224,19,58,98,51,50,228,82,42,102,114,
+    34,232,145,26,106,177,18,236,208,10,110,240,2,48,66,67,86,2,0,100,0,
+    0,28,197,152,123,82,74,169,206,65,72,49,39,103,59,198,28,180,152,155,14,
+    21,66,76,90,45,54,100,136,24,38,173,199,210,41,66,144,163,154,74,200,144,
+    49,138,106,41,165,83,8,41,169,165,148,208,49,198,164,166,214,90,42,165,180,
+    30,0,66,67,86,4,0,81,0,0,128,49,136,49,196,24,114,206,73,201,164,
+    68,206,49,41,157,148,6,58,71,169,163,148,81,42,41,150,24,51,74,37,182,
+    18,99,4,157,163,212,81,202,40,133,24,75,139,25,165,18,99,137,169,0,0,
+    128,0,7,0,128,0,11,33,66,67,86,4,0,81,0,0,132,49,72,41,164,
+    20,98,76,49,167,152,67,140,41,231,24,100,136,49,6,33,115,78,65,199,152,
+    116,82,42,231,156,116,78,74,196,24,115,142,57,168,156,115,82,58,39,149,131,
+    78,74,38,157,0,0,128,0,7,0,128,0,11,33,66,67,86,4,0,113,2,
+    0,6,73,210,52,75,211,68,209,210,52,81,244,76,81,85,61,81,84,85,203,
+    243,76,211,51,77,85,245,76,83,85,77,85,117,93,83,85,93,217,242,60,211,
+    244,76,83,85,61,211,84,85,209,84,93,215,84,85,215,245,84,213,150,77,87,
+    213,101,211,85,109,219,149,93,223,118,109,215,215,61,85,149,109,83,117,101,221,
+    84,93,89,87,93,217,214,93,215,182,125,201,243,84,85,84,85,215,245,76,213,
+    117,85,215,213,109,213,117,109,91,83,77,217,53,85,87,182,77,215,181,101,87,
+    150,109,221,149,101,93,215,76,213,149,77,87,181,101,211,149,101,221,149,93,219,
+    86,101,89,247,69,215,213,109,85,150,117,95,149,101,223,151,109,93,215,93,91,
+    23,126,209,117,109,93,149,101,221,87,101,217,55,102,219,22,126,89,215,133,99,
+    242,68,85,245,84,213,117,61,83,117,93,213,117,109,91,117,93,91,215,84,211,
+    149,77,215,181,101,83,117,101,91,149,101,221,118,101,217,214,53,83,149,101,211,
+    117,101,219,116,93,89,86,101,217,247,93,89,214,109,209,117,125,221,148,101,93,
+    87,101,89,216,93,93,55,134,217,182,117,95,116,93,93,87,101,89,247,85,89,
+    214,117,87,215,125,95,214,109,97,215,84,85,215,77,89,246,117,83,150,117,223,
+    214,117,97,153,117,91,55,70,215,245,125,85,182,133,95,149,101,225,215,117,95,
+    88,102,221,103,140,174,235,235,170,45,11,195,42,219,190,175,251,190,114,204,186,
+    46,44,171,109,43,191,107,235,140,215,215,141,97,215,141,95,185,117,97,89,86,
+    219,54,150,89,183,149,229,245,117,99,216,133,157,111,11,191,82,83,85,219,54,
+    93,87,215,77,89,246,117,89,215,133,182,174,251,202,232,186,190,175,218,182,239,
+    171,178,236,251,182,240,43,109,99,24,150,209,117,117,95,149,101,93,120,109,89,
+    249,101,93,23,150,93,248,133,101,181,109,229,119,117,93,25,102,91,23,150,219,
+    23,150,229,215,125,97,89,117,219,247,93,93,87,186,182,174,44,183,239,51,118,
+    229,54,126,1,0,0,3,14,0,0,1,38,148,129,66,67,86,4,0,113,2,
+    0,8,66,206,33,197,32,84,76,65,8,33,148,20,66,72,165,98,76,74,198,
+    156,148,204,57,41,165,148,146,66,41,169,85,140,73,201,156,147,146,57,38,37,
+    148,210,82,41,37,149,80,74,75,165,148,152,66,41,173,165,212,90,76,41,181,
+    24,74,105,173,148,212,90,41,169,181,148,82,140,169,181,24,35,198,164,100,206,
+    73,201,156,147,82,82,106,173,164,210,90,230,28,165,204,65,73,29,132,148,82,
+    73,165,149,148,90,204,156,147,212,65,103,165,131,144,90,73,37,166,146,82,108,
+    33,149,216,74,73,173,149,148,98,108,37,166,154,90,203,49,164,20,99,73,41,
+    182,146,82,171,45,166,218,90,107,181,70,140,73,201,156,147,146,57,71,165,164,
+    212,90,73,165,181,204,57,73,29,132,150,58,7,37,149,148,90,76,37,165,88,
+    57,39,169,131,144,82,6,25,149,146,82,107,37,149,88,66,42,177,149,150,98,
+    44,37,181,152,90,204,53,165,216,98,40,169,197,146,82,139,37,149,216,90,140,
+    177,182,150,106,234,164,180,88,82,138,177,164,18,99,139,53,215,214,90,141,161,
+    148,216,74,105,49,150,148,114,107,45,230,218,98,204,49,148,212,98,105,37,182,
+    146,82,139,173,182,28,91,107,185,166,150,106,76,169,213,218,98,172,49,166,156,
+    114,173,181,231,212,90,172,41,166,90,91,139,53,183,218,114,139,185,246,220,73,
+    105,173,148,210,98,73,41,198,214,90,172,49,198,156,67,41,173,149,148,98,43,
+    37,197,216,90,171,181,181,152,107,40,37,182,82,90,139,37,149,24,91,140,181,
+    182,216,106,76,173,213,216,98,171,181,180,86,107,173,181,215,216,106,203,165,181,
+    154,91,140,181,167,150,114,141,181,214,28,107,170,173,0,0,128,1,7,0,128,
+    0,19,202,64,66,67,86,2,0,81,0,0,128,49,140,49,6,161,81,202,49,
+    231,164,52,74,57,231,156,148,202,57,8,33,164,148,57,7,33,132,148,50,231,
+    32,148,210,82,230,28,132,82,82,10,165,164,148,90,107,161,148,148,90,107,173,
+    0,0,128,2,7,0,128,0,27,52,37,22,7,8,66,67,86,2,0,169,0,
+    0,6,199,209,52,81,84,85,215,245,125,197,178,68,81,85,93,87,182,141,95,
+    177,52,81,84,85,217,181,109,225,215,68,81,85,93,215,182,109,91,248,53,81,
+    84,85,217,149,101,219,22,138,170,234,202,182,109,203,186,45,12,163,170,186,174,
+    109,203,182,173,163,186,174,110,235,182,110,235,190,80,117,101,89,182,109,221,214,
+    117,92,219,214,117,219,215,117,225,103,204,182,173,219,186,173,251,194,143,48,28,
+    125,227,135,144,143,239,211,9,33,0,0,60,193,1,0,168,192,134,213,17,78,
+    138,198,2,3,66,67,86,2,0,25,0,0,128,49,74,25,133,24,51,72,49,
+    166,24,99,76,49,198,152,0,0,128,1,7,0,128,0,19,202,64,66,67,86,
+    4,0,81,0,0,128,115,206,57,231,156,115,206,57,231,156,115,206,57,231,156,
+    115,206,57,231,28,99,140,49,198,24,99,140,49,198,24,99,140,49,198,24,99,
+    140,49,198,24,99,140,49,198,24,99,140,49,198,152,0,128,157,8,7,128,157,
+    8,11,33,66,67,86,2,0,225,0,0,0,66,8,73,73,41,165,148,82,138,
+    152,114,14,74,74,41,165,148,82,165,24,100,84,82,74,41,165,148,34,165,168,
+    163,148,82,74,41,165,20,41,5,37,149,148,82,74,41,165,76,74,74,41,165,
+    148,82,74,41,101,212,81,74,41,165,148,82,74,41,165,148,82,74,41,165,148,
+    82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,
+    74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,
+    41,165,148,82,74,41,165,148,82,74,41,165,82,74,41,165,148,82,74,41,165,
+    148,82,74,41,165,0,0,147,7,7,0,168,4,27,103,88,73,58,43,28,13,
+    14,66,67,86,2,0,185,1,0,128,66,140,65,8,161,180,86,82,42,41,165,
+    146,42,231,32,148,18,74,74,37,165,148,74,74,41,85,204,65,8,37,149,212,
+    82,73,41,165,148,90,233,32,148,80,74,40,165,148,18,74,41,37,148,18,66,
+    8,165,132,80,74,42,161,149,84,66,41,165,131,80,66,9,161,148,80,66,42,
+    165,148,18,74,231,32,148,144,66,7,161,164,82,74,106,33,164,14,58,42,169,
+    148,144,74,41,165,148,146,82,74,29,132,80,74,73,169,165,150,74,41,45,165,
+    84,58,9,169,148,212,74,106,41,181,212,90,73,169,132,80,82,43,165,164,146,
+    82,105,173,164,146,90,9,165,164,146,82,74,169,165,148,66,42,169,164,18,66,
+    73,41,149,146,90,75,45,165,212,90,107,41,164,212,74,74,41,165,212,82,106,
+    41,165,146,82,72,37,165,84,74,73,41,181,146,74,74,41,181,144,74,74,165,
+    164,20,82,106,165,148,82,82,42,161,164,212,82,41,45,165,150,90,74,165,164,
+    84,90,42,169,164,82,74,74,165,164,148,82,41,165,165,148,82,9,37,165,212,
+    82,74,173,164,148,66,73,41,165,148,74,73,169,165,146,90,42,37,133,146,82,
+    74,169,164,84,90,74,169,165,148,74,73,169,0,0,160,3,7,0,128,0,35,
+    42,45,196,78,51,174,60,2,71,20,50,76,64,1,66,67,86,2,0,64,0,
+    0,12,163,208,58,38,149,65,136,33,229,33,66,138,49,232,153,81,136,33,6,
+    38,99,142,49,39,26,82,6,25,196,153,98,72,25,196,45,22,23,84,8,2,
+    66,67,86,4,0,81,0,0,128,49,136,49,196,24,114,142,65,201,32,68,206,
+    49,9,25,132,200,57,39,165,147,146,73,9,165,149,214,50,41,161,165,210,90,
+    228,156,147,210,73,201,164,148,214,66,106,153,148,210,90,104,165,0,0,128,0,
+    7,0,128,0,11,33,66,67,86,4,0,81,0,0,136,65,72,41,164,20,98,
+    74,49,167,152,67,74,41,199,148,99,72,41,230,156,98,76,57,198,24,116,16,
+    42,230,24,100,14,66,164,148,98,140,57,167,28,115,16,50,6,21,115,14,66,
+    6,153,0,0,128,0,7,0,128,0,11,33,66,67,86,4,0,113,2,0,6,
+    73,210,52,75,211,68,209,210,52,81,244,76,81,85,69,81,84,85,203,243,76,
+    211,51,77,85,245,68,83,85,77,85,117,93,83,85,93,217,242,60,211,244,76,
+    81,85,61,83,84,85,83,85,93,215,84,85,215,21,85,213,150,77,87,181,109,
+    211,85,109,217,149,101,221,118,101,89,183,61,85,149,109,83,117,101,221,84,93,
+    219,118,101,217,214,93,89,182,117,201,243,84,213,51,77,215,245,76,211,117,85,
+    215,181,101,213,117,101,219,51,77,215,21,85,87,182,77,215,149,101,215,149,109,
+    91,149,101,93,215,76,211,117,69,87,181,93,83,117,101,219,149,93,219,118,101,
+    89,247,77,215,213,109,213,149,117,93,149,101,221,183,109,93,247,101,91,23,118,
+    209,117,109,93,149,93,93,87,101,89,215,101,91,214,109,217,182,133,146,231,169,
+    170,103,154,174,235,153,166,235,170,174,107,219,170,235,218,182,102,154,174,107,186,
+    174,44,139,170,235,202,170,43,235,186,234,202,182,238,153,166,235,154,174,42,203,
+    166,171,202,178,42,203,186,237,202,174,46,139,174,107,219,170,44,251,186,234,202,
+    190,46,219,186,239,203,178,174,251,166,235,234,182,42,203,182,175,202,178,238,203,
+    186,238,11,179,110,251,186,167,170,182,110,186,174,174,155,174,171,251,182,174,251,
+    194,108,219,190,47,186,174,174,171,178,173,11,171,44,235,190,173,251,202,48,235,
+    58,97,116,93,93,87,109,217,215,85,89,214,125,93,215,141,97,214,117,97,88,
+    117,219,248,93,91,23,134,87,215,141,99,215,125,93,185,125,31,213,182,125,225,
+    213,109,99,120,117,221,56,118,97,55,126,219,247,141,99,83,85,219,54,93,87,
+    215,77,87,214,117,217,214,125,223,214,117,227,24,93,87,215,85,89,246,117,213,
+    149,125,223,214,117,225,215,125,95,24,70,215,213,117,85,150,117,97,181,101,95,
+    151,117,93,24,118,93,55,134,213,182,133,221,181,117,225,152,101,93,24,110,223,
+    87,142,95,23,134,170,109,11,195,171,235,70,87,183,141,223,22,134,165,111,236,
+    124,1,0,0,3,14,0,0,1,38,148,129,66,67,86,4,0,113,2,0,12,
+    66,16,42,198,32,84,140,65,8,33,164,20,66,72,169,98,12,66,198,28,148,
+    140,57,40,33,148,146,66,40,165,85,140,65,200,28,147,144,57,38,33,148,208,
+    82,41,161,149,80,74,75,161,148,150,66,41,173,165,212,90,76,169,181,24,66,
+    105,41,148,210,90,41,165,181,212,82,108,169,165,216,42,198,32,100,206,73,201,
+    28,147,80,74,105,173,148,210,82,230,152,148,140,65,73,29,132,84,74,73,165,
+    149,146,90,203,156,147,146,65,71,165,115,144,82,73,165,165,146,82,107,161,148,
+    214,66,41,173,149,148,98,75,165,149,218,90,139,53,148,210,90,72,165,181,146,
+    82,107,169,165,218,90,107,181,70,140,65,200,24,131,146,57,39,165,148,146,82,
+    41,165,181,204,57,41,29,116,84,50,7,37,149,82,82,43,37,165,88,49,39,
+    165,131,80,74,6,25,149,146,74,107,37,149,86,66,41,173,149,148,98,11,165,
+    180,214,90,171,49,165,150,106,40,37,181,146,82,139,161,148,214,90,107,53,166,
+    86,106,10,161,164,22,74,105,45,148,210,90,107,173,214,212,90,108,161,132,214,
+    66,73,45,150,84,98,106,45,198,218,90,139,49,148,210,90,73,37,182,82,82,
+    139,45,182,26,91,107,177,166,150,106,44,37,197,216,90,171,177,149,90,114,172,
+    181,214,148,90,172,165,165,24,91,107,49,183,152,114,139,177,214,26,74,104,45,
+    148,210,90,41,165,181,148,90,139,173,181,90,67,41,173,149,84,98,43,37,181,
+    216,90,171,177,181,24,107,40,165,197,82,82,106,33,149,216,90,107,177,182,216,
+    106,76,45,197,216,98,171,177,164,22,99,140,177,230,150,106,171,41,181,22,91,
+    107,177,150,86,106,140,49,214,220,106,202,165,0,0,128,1,7,0,128,0,19,
+    202,64,66,67,86,2,0,81,0,0,128,49,140,49,6,161,81,200,49,231,164,
+    52,74,57,231,156,148,204,57,8,33,164,148,57,7,33,132,148,58,231,32,148,
+    210,82,231,28,132,82,82,10,165,164,148,82,108,161,148,148,90,107,177,0,0,
+    128,2,7,0,128,0,27,52,37,22,7,8,66,67,86,2,0,81,0,0,136,
+    49,74,49,6,161,49,72,41,198,32,52,198,40,197,24,132,74,41,198,156,131,
+    80,41,197,152,115,16,50,198,156,115,80,74,198,152,115,208,73,9,33,132,80,
+    74,41,33,132,16,74,41,165,0,0,128,2,7,0,128,0,27,52,37,22,7,
+    8,66,67,86,4,0,81,0,0,128,49,136,49,196,24,130,208,73,233,164,68,
+    16,50,41,157,148,70,74,104,45,164,148,89,42,41,150,24,51,107,37,182,18,
+    99,35,37,180,22,90,203,172,149,24,75,139,25,181,18,99,137,169,0,0,176,
+    3,7,0,176,3,11,33,66,67,86,2,0,121,0,0,132,49,74,49,230,156,
+    115,6,33,198,156,131,16,66,131,16,99,206,65,8,161,98,204,57,231,32,132,
+    80,49,230,156,115,16,66,232,156,115,14,66,8,33,116,206,57,7,33,132,16,
+    58,8,33,132,80,74,41,29,132,16,66,40,165,148,14,66,8,33,148,82,74,
+    7,33,132,16,74,41,165,0,0,160,2,7,0,128,0,27,69,54,39,24,9,
+    10,66,67,86,2,0,121,0,0,128,49,74,57,39,37,165,70,41,198,32,164,
+    20,91,163,20,99,16,82,106,173,98,12,66,74,173,197,88,49,6,33,165,214,
+    98,236,32,164,212,90,140,181,118,16,82,106,45,198,90,67,74,173,197,88,107,
+    206,33,165,214,98,172,53,215,212,90,140,181,230,220,123,106,45,198,90,115,206,
+    185,0,0,220,5,7,0,176,3,27,69,54,39,24,9,10,66,67,86,2,0,
+    121,0,0,4,66,74,49,198,152,115,72,41,198,24,115,206,57,164,20,99,140,
+    57,231,156,98,140,49,231,156,115,78,49,198,152,115,206,57,199,24,115,206,57,
+    231,156,99,140,57,231,156,115,206,57,231,156,115,14,58,8,153,115,206,57,7,
+    29,132,206,57,231,156,131,16,66,231,156,115,206,65,8,161,0,0,160,2,7,
+    0,128,0,27,69,54,39,24,9,10,66,67,86,2,0,225,0,0,128,49,148,
+    82,74,41,165,148,82,74,168,163,148,82,74,41,165,148,82,2,33,165,148,82,
+    74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,
+    41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,
+    165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,
+    148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,
+    82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,149,82,74,
+    41,165,148,82,74,41,165,148,82,74,41,165,0,32,223,10,7,0,255,7,27,
+    103,88,73,58,43,28,13,14,66,67,86,2,0,225,0,0,128,49,140,65,200,
+    152,115,82,82,106,24,131,80,74,231,164,148,84,82,195,24,132,82,58,39,33,
+    165,148,50,8,173,165,86,74,42,45,165,148,65,72,41,182,16,82,73,169,165,
+    80,74,107,181,150,146,90,75,41,133,146,82,172,177,164,148,90,106,45,115,78,
+    66,42,169,181,212,106,139,153,115,80,74,106,173,165,214,90,12,33,164,20,91,
+    107,45,181,22,91,39,37,149,212,90,107,173,213,214,66,74,169,181,214,98,108,
+    45,198,86,82,106,169,181,150,90,108,173,197,148,90,107,177,181,212,98,108,45,
+    182,212,90,140,45,182,24,99,172,177,0,0,238,6,7,0,136,4,27,103,88,
+    73,58,43,28,13,14,66,67,86,2,0,33,1,0,4,50,74,57,231,156,131,
+    16,66,8,33,82,138,49,231,160,131,16,66,8,33,68,74,49,230,156,131,16,
+    66,8,33,132,140,49,231,32,132,16,66,8,161,148,144,49,230,28,132,16,66,
+    8,33,132,82,58,231,32,132,80,74,9,165,148,82,74,231,28,132,16,66,8,
+    165,148,82,74,9,33,132,16,66,40,165,148,82,74,41,33,132,16,74,41,165,
+    148,82,74,41,37,132,16,66,40,165,148,82,74,41,165,132,16,66,40,165,148,
+    82,74,41,165,148,16,66,40,165,148,82,74,41,165,148,18,66,8,161,148,82,
+    74,41,165,148,82,66,8,165,148,82,74,41,165,148,82,74,40,33,132,82,74,
+    41,165,148,82,74,9,37,148,82,74,41,165,148,82,74,41,33,148,82,74,41,
+    165,148,82,74,41,165,0,0,128,3,7,0,128,0,35,232,36,163,202,34,108,
+    52,225,194,3,16,66,67,86,2,0,100,0,0,12,195,144,67,239,36,102,200,
+    41,200,36,147,148,42,230,28,132,208,122,135,156,114,10,50,105,41,99,76,49,
+    198,40,103,200,41,134,152,130,24,67,232,148,66,8,106,167,156,82,6,17,132,
+    33,164,78,50,103,144,165,30,116,112,177,115,28,0,66,67,86,2,0,64,0,
+    0,144,195,18,84,202,153,48,200,49,232,177,33,72,57,106,166,65,136,41,39,
+    58,83,204,73,109,166,98,10,50,7,162,147,78,34,67,45,40,219,75,102,1,
+    66,67,86,4,0,81,0,0,128,49,200,49,196,28,114,206,81,234,164,68,206,
+    57,42,29,165,198,57,71,169,163,212,89,74,49,166,88,51,74,37,182,20,107,
+    227,156,163,212,81,235,40,165,24,75,139,29,165,84,99,170,177,0,0,128,0,
+    7,0,128,0,11,33,66,67,86,4,0,81,0,0,132,49,72,41,164,20,98,
+    140,57,167,156,67,140,41,231,152,115,134,49,230,28,115,142,57,231,160,116,82,
+    42,231,156,116,78,74,196,24,115,142,57,167,156,115,82,58,39,149,115,78,74,
+    39,161,0,0,128,0,7,0,128,0,11,33,66,67,86,4,0,113,2,0,6,
+    73,242,60,201,211,68,81,210,60,81,20,77,209,117,69,209,116,93,203,243,84,
+    211,51,77,85,245,68,83,85,77,85,181,101,83,85,101,89,242,60,211,244,76,
+    83,85,61,211,84,85,83,85,101,217,84,85,89,22,85,85,183,77,215,213,109,
+    211,85,117,91,182,109,223,119,109,89,216,69,85,181,117,83,117,109,223,84,93,
+    219,119,101,219,247,101,89,215,141,201,243,84,213,51,77,215,245,76,211,149,85,
+    215,181,109,213,117,117,221,51,77,89,54,93,87,150,77,215,181,109,87,150,117,
+    221,149,101,223,215,76,211,117,77,87,149,101,211,117,101,219,149,93,221,118,101,
+    217,247,77,215,21,126,87,150,125,93,149,101,97,216,117,221,23,110,93,87,150,
+    211,117,117,95,149,93,221,88,101,217,247,109,93,23,134,91,215,133,101,242,60,
+    85,245,76,211,117,61,211,116,93,213,117,125,93,117,93,91,215,76,83,150,77,
+    215,181,101,83,117,101,217,149,101,223,119,93,89,215,61,211,148,101,211,117,109,
+    219,116,93,89,118,101,217,247,93,89,214,117,211,117,125,93,149,101,225,87,93,
+    217,215,101,93,87,134,91,183,133,223,116,93,223,87,101,217,23,94,89,214,133,
+    91,215,133,229,214,117,97,248,84,213,247,77,217,21,134,211,149,125,95,23,126,
+    103,185,117,225,88,70,215,245,133,85,182,133,99,149,101,229,248,133,99,89,118,
+    223,87,150,209,117,125,97,181,101,99,88,101,89,24,126,225,119,150,219,247,141,
+    227,213,117,101,184,117,159,51,235,190,51,28,191,147,238,43,79,87,183,141,101,
+    246,117,103,153,125,221,57,134,99,232,252,194,143,167,170,190,110,186,174,48,156,
+    178,44,252,182,175,27,207,238,251,202,50,186,174,239,171,178,44,252,170,108,11,
+    199,174,251,206,243,251,194,178,140,178,235,11,171,45,11,195,106,219,198,112,251,
+    186,177,252,194,113,44,175,173,43,199,172,251,70,217,214,241,125,225,41,12,207,
+    211,213,117,229,153,117,29,219,215,209,141,31,225,248,41,3,0,0,6,28,0,
+    0,2,76,40,3,1,66,67,86,4,0,113,2,0,30,73,18,69,201,178,68,
+    81,178,44,81,20,77,209,117,69,209,116,93,73,211,76,83,211,60,211,180,52,
+    207,52,77,211,84,101,83,52,93,89,210,52,211,180,60,205,52,53,79,51,77,
+    209,52,93,215,52,77,89,21,77,83,150,77,213,148,101,211,52,101,217,117,101,
+    219,118,93,217,182,69,211,148,101,211,52,101,217,52,77,89,118,101,87,183,93,
+    217,213,117,73,179,76,83,243,60,211,212,60,207,52,77,213,148,101,211,52,93,
+    87,243,60,213,244,60,209,84,61,81,84,85,213,84,85,91,85,85,89,182,60,
+    207,52,53,209,83,77,79,20,85,213,84,77,91,53,85,85,150,77,85,181,101,
+    211,84,109,217,84,85,219,118,85,217,245,101,219,214,117,211,84,101,219,84,77,
+    91,54,85,213,182,93,217,213,101,89,182,117,95,210,52,211,212,60,207,52,53,
+    207,51,77,211,52,101,217,52,85,87,182,60,79,53,61,81,84,85,205,19,77,
+    213,84,85,89,54,77,85,149,45,207,51,85,79,20,85,213,19,61,215,52,85,
+    85,150,77,213,180,85,211,52,109,217,84,85,91,54,77,85,150,93,219,246,125,
+    215,149,101,221,84,85,217,54,85,213,214,77,213,148,101,217,150,125,223,149,85,
+    221,21,77,83,150,77,85,181,101,211,84,101,91,182,101,223,151,101,89,247,69,
+    211,148,101,211,84,101,219,84,85,93,150,101,219,54,102,217,246,117,209,52,101,
+    219,84,77,91,54,85,85,182,101,91,246,117,89,182,117,223,149,93,223,86,85,
+    89,215,101,91,246,117,221,245,93,225,214,117,97,120,101,217,246,85,89,245,117,
+    87,182,117,223,214,101,182,237,251,136,166,41,203,166,106,218,182,169,170,178,236,
+    202,178,237,203,182,237,251,162,105,218,182,170,170,182,108,154,170,109,203,178,236,
+    251,178,108,219,194,104,154,178,109,170,170,172,155,170,105,219,178,44,219,194,108,
+    203,194,237,202,178,111,203,182,236,235,174,43,235,190,174,251,198,175,203,186,205,
+    117,101,219,151,101,91,247,85,87,245,109,221,247,133,225,214,93,225,21,0,0,
+    48,224,0,0,16,96,66,25,8,66,67,86,2,0,81,0,0,128,49,140,49,
+    6,161,81,202,57,231,32,52,74,57,231,28,132,204,57,8,33,164,146,57,7,
+    33,132,82,50,231,32,148,146,82,230,28,132,82,82,10,33,148,146,82,107,33,
+    132,146,82,106,173,0,0,128,2,7,0,128,0,27,52,37,22,7,8,66,67,
+    86,2,0,169,0,0,6,199,177,44,207,51,69,213,180,101,199,146,60,79,20,
+    85,83,85,109,219,145,44,207,19,69,211,84,85,219,182,60,79,20,77,83,85,
+    93,215,215,53,207,19,69,211,84,85,215,213,117,209,52,77,83,85,93,215,117,
+    117,93,52,69,83,85,85,215,117,101,93,55,77,85,85,93,87,118,101,217,215,
+    77,85,85,85,215,149,93,89,246,133,85,117,93,87,150,101,219,214,133,97,85,
+    93,215,149,101,217,182,109,223,184,117,93,215,125,223,247,133,35,91,215,117,93,
+    248,133,99,24,142,2,0,192,19,28,0,128,10,108,88,29,225,164,104,44,48,
+    66,67,86,2,0,25,0,0,132,49,8,25,132,16,50,8,33,132,148,82,10,
+    41,165,148,0,0,128,1,7,0,128,0,19,202,64,66,67,86,4,0,113,2,
+    0,128,49,148,66,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,
+    41,165,148,82,74,41,165,148,82,74,41,133,148,82,74,41,165,148,82,74,41,
+    165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,
+    148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,74,74,41,165,148,
+    82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,
+    74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,
+    41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,
+    165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,
+    148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,
+    82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,
+    74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,
+    41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,
+    165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,
+    148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,
+    82,74,41,165,148,82,74,41,165,148,82,41,165,148,82,74,41,165,148,82,74,
+    41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,
+    165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,
+    148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,
+    82,74,41,165,148,82,74,41,165,148,82,74,41,165,0,0,169,8,7,0,169,
+    7,19,202,64,66,67,86,2,0,169,0,0,128,49,74,41,197,152,115,16,34,
+    198,28,99,12,58,9,37,69,140,57,199,152,131,82,82,170,156,131,16,66,42,
+    173,229,86,57,7,33,132,148,90,170,45,115,78,74,107,49,198,28,99,230,156,
+    148,148,98,171,57,231,80,74,106,49,214,92,115,205,157,148,214,106,205,181,230,
+    92,75,107,181,230,154,115,174,57,151,214,98,205,53,231,154,115,110,57,230,154,
+    115,206,57,231,28,99,206,57,231,156,115,206,185,0,0,156,6,7,0,208,3,
+    27,86,71,56,41,26,11,12,66,67,86,2,0,169,0,0,4,50,74,49,230,
+    156,115,208,33,164,24,115,206,57,8,33,68,10,49,230,156,115,16,66,168,24,
+    115,206,57,232,32,132,80,49,230,152,115,16,66,8,33,115,206,57,8,33,132,
+    16,66,230,28,116,208,65,8,33,132,14,58,8,33,132,16,66,41,157,131,16,
+    66,8,33,148,80,66,8,33,132,16,66,8,33,116,16,66,8,33,132,16,66,
+    8,33,132,16,66,8,165,148,16,66,8,33,132,18,66,41,161,0,0,192,2,
+    7,0,128,0,27,86,71,56,41,26,11,12,66,67,86,2,0,64,0,0,44,
+    214,24,92,14,18,82,82,82,238,13,33,12,49,233,25,99,18,82,235,21,66,
+    16,41,233,29,99,80,49,232,41,35,202,32,231,45,52,14,49,232,1,66,67,
+    86,2,0,64,0,0,144,195,18,84,202,153,48,200,49,232,177,33,72,57,106,
+    166,65,136,41,39,58,83,204,73,109,166,98,10,50,7,162,147,78,34,67,45,
+    40,219,75,102,1,66,67,86,4,0,81,0,0,128,49,200,49,196,28,114,206,
+    81,234,164,68,206,57,42,29,165,198,57,71,169,163,212,89,74,49,166,88,51,
+    74,37,182,20,107,227,156,163,212,81,235,40,165,24,75,139,29,165,84,99,170,
+    177,0,0,128,0,7,0,128,0,11,33,66,67,86,4,0,81,0,0,132,49,
+    72,41,164,20,98,140,57,167,156,67,140,41,231,152,115,134,49,230,28,115,142,
+    57,231,160,116,82,42,231,156,116,78,74,196,24,115,142,57,167,156,115,82,58,
+    39,149,115,78,74,39,161,0,0,128,0,7,0,128,0,11,33,66,67,86,4,
+    0,113,2,0,6,73,242,60,201,211,68,81,210,60,81,20,77,209,117,69,209,
+    116,93,203,243,84,211,51,77,85,245,68,83,85,77,85,181,101,83,85,101,89,
+    242,60,211,244,76,83,85,61,211,84,85,83,85,101,217,84,85,89,22,85,85,
+    183,77,215,213,109,211,85,117,91,182,109,223,119,109,89,216,69,85,181,117,83,
+    117,109,223,84,93,219,119,101,219,247,101,89,215,141,201,243,84,213,51,77,215,
+    245,76,211,149,85,215,181,109,213,117,117,221,51,77,89,54,93,87,150,77,215,
+    181,109,87,150,117,221,149,101,223,215,76,211,117,77,87,149,101,211,117,101,219,
+    149,93,221,118,101,217,247,77,215,21,126,87,150,125,93,149,101,97,216,117,221,
+    23,110,93,87,150,211,117,117,95,149,93,221,88,101,217,247,109,93,23,134,91,
+    215,133,101,242,60,85,245,76,211,117,61,211,116,93,213,117,125,93,117,93,91,
+    215,76,83,150,77,215,181,101,83,117,101,217,149,101,223,119,93,89,215,61,211,
+    148,101,211,117,109,219,116,93,89,118,101,217,247,93,89,214,117,211,117,125,93,
+    149,101,225,87,93,217,215,101,93,87,134,91,183,133,223,116,93,223,87,101,217,
+    23,94,89,214,133,91,215,133,229,214,117,97,248,84,213,247,77,217,21,134,211,
+    149,125,95,23,126,103,185,117,225,88,70,215,245,133,85,182,133,99,149,101,229,
+    248,133,99,89,118,223,87,150,209,117,125,97,181,101,99,88,101,89,24,126,225,
+    119,150,219,247,141,227,213,117,101,184,117,159,51,235,190,51,28,191,147,238,43,
+    79,87,183,141,101,246,117,103,153,125,221,57,134,99,232,252,194,143,167,170,190,
+    110,186,174,48,156,178,44,252,182,175,27,207,238,251,202,50,186,174,239,171,178,
+    44,252,170,108,11,199,174,251,206,243,251,194,178,140,178,235,11,171,45,11,195,
+    106,219,198,112,251,186,177,252,194,113,44,175,173,43,199,172,251,70,217,214,241,
+    125,225,41,12,207,211,213,117,229,153,117,29,219,215,209,141,31,225,248,41,3,
+    0,0,6,28,0,0,2,76,40,3,1,66,67,86,4,0,113,2,0,30,73,
+    18,69,201,178,68,81,178,44,81,20,77,209,117,69,209,116,93,73,211,76,83,
+    211,60,211,180,52,207,52,77,211,84,101,83,52,93,89,210,52,211,180,60,205,
+    52,53,79,51,77,209,52,93,215,52,77,89,21,77,83,150,77,213,148,101,211,
+    52,101,217,117,101,219,118,93,217,182,69,211,148,101,211,52,101,217,52,77,89,
+    118,101,87,183,93,217,213,117,73,179,76,83,243,60,211,212,60,207,52,77,213,
+    148,101,211,52,93,87,243,60,213,244,60,209,84,61,81,84,85,213,84,85,91,
+    85,85,89,182,60,207,52,53,209,83,77,79,20,85,213,84,77,91,53,85,85,
+    150,77,85,181,101,211,84,109,217,84,85,219,118,85,217,245,101,219,214,117,211,
+    84,101,219,84,77,91,54,85,213,182,93,217,213,101,89,182,117,95,210,52,211,
+    212,60,207,52,53,207,51,77,211,52,101,217,52,85,87,182,60,79,53,61,81,
+    84,85,205,19,77,213,84,85,89,54,77,85,149,45,207,51,85,79,20,85,213,
+    19,61,215,52,85,85,150,77,213,180,85,211,52,109,217,84,85,91,54,77,85,
+    150,93,219,246,125,215,149,101,221,84,85,217,54,85,213,214,77,213,148,101,217,
+    150,125,223,149,85,221,21,77,83,150,77,85,181,101,211,84,101,91,182,101,223,
+    151,101,89,247,69,211,148,101,211,84,101,219,84,85,93,150,101,219,54,102,217,
+    246,117,209,52,101,219,84,77,91,54,85,85,182,101,91,246,117,89,182,117,223,
+    149,93,223,86,85,89,215,101,91,246,117,221,245,93,225,214,117,97,120,101,217,
+    246,85,89,245,117,87,182,117,223,214,101,182,237,251,136,166,41,203,166,106,218,
+    182,169,170,178,236,202,178,237,203,182,237,251,162,105,218,182,170,170,182,108,154,
+    170,109,203,178,236,251,178,108,219,194,104,154,178,109,170,170,172,155,170,105,219,
+    178,44,219,194,108,203,194,237,202,178,111,203,182,236,235,174,43,235,190,174,251,
+    198,175,203,186,205,117,101,219,151,101,91,247,85,87,245,109,221,247,133,225,214,
+    93,225,21,0,0,48,224,0,0,16,96,66,25,8,66,67,86,2,0,81,0,
+    0,128,49,140,49,6,161,81,202,57,231,32,52,74,57,231,28,132,204,57,8,
+    33,164,146,57,7,33,132,82,50,231,32,148,146,82,230,28,132,82,82,10,33,
+    148,146,82,107,33,132,146,82,106,173,0,0,128,2,7,0,128,0,27,52,37,
+    22,7,8,66,67,86,2,0,169,0,0,6,199,177,44,207,51,69,213,180,101,
+    199,146,60,79,20,85,83,85,109,219,145,44,207,19,69,211,84,85,219,182,60,
+    79,20,77,83,85,93,215,215,53,207,19,69,211,84,85,215,213,117,209,52,77,
+    83,85,93,215,117,117,93,52,69,83,85,85,215,117,101,93,55,77,85,85,93,
+    87,118,101,217,215,77,85,85,85,215,149,93,89,246,133,85,117,93,87,150,101,
+    219,214,133,97,85,93,215,149,101,217,182,109,223,184,117,93,215,125,223,247,133,
+    35,91,215,117,93,248,133,99,24,142,2,0,192,19,28,0,128,10,108,88,29,
+    225,164,104,44,48,66,67,86,2,0,25,0,0,132,49,8,25,132,16,50,8,
+    33,132,148,82,10,41,165,148,0,0,128,1,7,0,128,0,19,202,64,66,67,
+    86,2,0,49,0,0,0,17,16,50,8,33,132,16,66,8,33,132,16,66,8,
+    33,132,16,66,8,33,116,206,57,231,156,115,206,57,231,156,0,128,253,8,7,
+    0,169,7,19,19,83,24,66,67,86,2,0,169,0,0,128,49,74,41,197,152,
+    115,16,34,198,28,99,12,58,9,37,69,140,57,199,152,131,82,82,170,156,131,
+    16,66,42,173,229,86,57,7,33,132,148,90,170,45,115,78,74,107,49,198,28,
+    99,230,156,148,148,98,171,57,231,80,74,106,49,214,92,115,205,157,148,214,106,
+    205,181,230,92,75,107,181,230,154,115,174,57,151,214,98,205,53,231,154,115,110,
+    57,230,154,115,206,57,231,28,99,206,57,231,156,115,206,185,0,0,156,6,7,
+    0,208,3,27,86,71,56,41,26,11,12,66,67,86,2,0,169,0,0,4,50,
+    74,49,230,156,115,208,33,164,24,115,206,57,8,33,68,10,49,230,156,115,16,
+    66,168,24,115,206,57,232,32,132,80,49,230,152,115,16,66,8,33,115,206,57,
+    8,33,132,16,66,230,28,116,208,65,8,33,132,14,58,8,33,132,16,66,41,
+    157,131,16,66,8,33,148,80,66,8,33,132,16,66,8,33,116,16,66,8,33,
+    132,16,66,8,33,132,16,66,8,165,148,16,66,8,33,132,18,66,41,161,0,
+    0,192,2,7,0,128,0,27,86,71,56,41,26,11,12,66,67,86,2,0,64,
+    0,0,44,214,24,92,14,18,82,82,82,238,13,33,12,49,233,25,99,18,82,
+    235,21,66,16,41,233,29,99,80,49,232,41,35,202,32,231,45,52,14,49,232,
+    1,66,67,86,2,0,64,0,0,16,212,150,99,137,153,65,202,49,103,177,33,
+    8,41,200,173,66,74,41,166,53,51,202,40,199,173,82,8,33,165,33,115,138,
+    33,35,37,214,154,75,229,0,66,67,86,4,0,81,0,0,128,49,200,49,196,
+    28,114,206,81,234,36,69,206,57,42,29,165,198,57,71,169,163,212,81,74,177,
+    166,24,51,74,37,182,84,107,227,156,163,212,81,234,40,165,26,75,139,29,165,
+    20,99,138,177,0,0,128,0,7,0,128,0,11,33,66,67,86,4,0,81,0,
+    0,4,66,72,41,164,20,82,138,57,167,156,67,74,41,199,152,115,72,41,230,
+    156,114,78,57,231,160,116,82,42,231,152,116,78,74,164,148,114,142,57,167,156,
+    115,82,58,39,149,115,78,74,39,161,0,0,128,0,7,0,128,0,11,33,66,
+    67,86,4,0,113,2,0,14,199,209,60,73,211,68,81,210,52,81,244,68,209,
+    85,61,81,84,93,73,211,76,83,19,69,85,213,68,209,84,77,85,149,101,209,
+    84,93,89,210,52,211,212,68,81,53,53,81,84,85,81,53,101,217,84,85,89,
+    246,76,211,150,77,85,213,109,81,85,117,91,182,101,223,118,101,89,247,61,211,
+    148,109,81,85,109,221,84,85,91,119,101,89,215,93,217,214,125,73,211,76,83,
+    19,69,85,213,68,81,117,77,85,181,101,83,85,109,91,19,69,215,21,85,85,
+    150,69,85,149,101,87,118,109,91,117,101,93,215,68,209,117,61,213,148,93,81,
+    85,101,89,149,93,93,86,101,89,247,69,87,213,117,213,117,125,93,117,101,223,
+    151,109,221,215,101,93,23,134,81,85,109,221,116,93,93,87,101,87,247,101,221,
+    246,125,89,215,133,101,210,52,211,212,68,209,85,53,81,84,85,83,85,109,219,
+    84,85,217,214,68,209,117,69,85,149,101,209,84,93,89,149,93,95,87,93,215,
+    214,53,81,116,93,81,85,101,89,84,85,217,85,101,87,247,93,89,214,109,81,
+    85,117,91,149,93,95,55,85,87,215,101,219,54,134,217,182,117,225,84,85,91,
+    87,101,87,23,86,217,213,125,89,183,141,225,214,117,223,216,76,211,182,77,215,
+    213,117,211,117,117,221,214,117,99,152,117,221,247,69,85,245,117,85,150,125,99,
+    149,101,223,215,125,31,91,247,141,97,84,85,93,55,101,87,248,85,87,246,133,
+    91,247,149,229,214,117,206,107,219,200,182,175,28,179,238,59,195,111,68,247,133,
+    99,89,109,155,242,234,182,48,204,186,142,47,236,206,178,11,191,210,51,77,91,
+    55,93,85,215,77,213,245,117,217,182,149,225,214,117,68,85,245,117,85,150,133,
+    223,116,101,95,184,117,221,56,110,221,119,150,209,117,233,170,44,251,194,42,203,
+    202,112,251,190,49,236,190,47,44,171,109,27,199,108,235,184,182,174,28,187,175,
+    84,118,95,89,134,215,182,125,101,214,117,194,172,219,198,177,251,58,227,23,134,
+    4,0,0,12,56,0,0,4,152,80,6,2,66,67,86,4,0,113,2,0,12,
+    66,206,33,166,32,68,138,65,8,33,164,20,66,72,41,98,12,66,230,156,148,
+    140,57,41,165,148,212,66,41,169,69,140,65,168,28,147,146,57,39,37,148,210,
+    82,40,165,165,80,74,107,165,148,216,66,41,45,182,214,106,77,173,197,26,74,
+    105,45,148,210,98,41,165,197,212,90,141,173,181,26,35,198,36,100,206,73,201,
+    156,147,82,74,105,173,148,210,90,230,28,149,206,65,74,29,132,148,74,74,45,
+    150,148,98,172,156,147,146,65,71,165,131,144,82,73,37,166,146,82,140,161,148,
+    24,75,74,49,150,148,106,108,41,182,220,98,204,57,148,210,98,73,37,198,146,
+    82,140,45,166,28,91,140,57,71,140,65,201,156,147,146,57,39,165,148,210,90,
+    41,169,181,202,57,41,29,132,148,50,7,37,149,148,98,44,37,165,152,57,39,
+    169,131,144,82,7,29,165,146,82,140,37,165,216,66,41,177,149,148,106,44,37,
+    197,216,98,204,185,165,216,106,40,165,197,146,82,172,37,165,24,91,140,57,183,
+    216,114,235,32,180,22,82,137,49,148,18,99,139,49,231,214,90,173,161,148,24,
+    75,74,177,150,148,106,139,177,214,222,98,204,53,148,18,99,73,165,198,146,82,
+    172,173,198,94,99,140,53,167,216,114,77,45,214,220,98,236,185,182,220,122,205,
+    57,248,212,90,205,41,166,92,91,140,185,199,220,130,172,57,247,222,65,104,45,
+    148,18,99,40,37,198,22,91,173,45,198,156,67,41,49,150,148,106,44,37,197,
+    218,98,204,181,181,90,123,40,37,198,146,82,172,37,165,26,99,140,57,199,26,
+    123,77,173,213,218,98,236,57,181,88,115,205,185,247,26,115,12,170,181,154,91,
+    140,185,167,216,114,174,185,246,94,115,11,178,0,0,128,1,7,0,128,0,19,
+    202,64,66,67,86,2,0,81,0,0,128,49,140,57,7,161,81,200,57,231,164,
+    52,72,57,231,156,148,204,57,8,33,164,148,57,7,33,132,148,58,231,32,148,
+    212,90,231,28,132,82,90,43,165,164,212,90,140,165,148,148,90,139,177,0,0,
+    128,2,7,0,128,0,27,52,37,22,7,8,66,67,86,2,0,169,0,0,6,
+    199,177,44,207,51,77,85,181,101,199,146,60,79,20,85,211,85,117,219,145,44,
+    207,19,69,85,85,85,219,182,60,207,20,85,85,85,93,87,215,45,207,19,69,
+    85,85,93,215,213,117,207,52,85,85,85,93,87,150,117,223,51,77,85,85,85,
+    215,149,101,223,55,85,213,117,93,87,150,101,89,248,77,85,117,93,215,149,101,
+    217,246,133,213,117,101,89,150,109,91,183,141,97,117,93,89,150,101,219,182,117,
+    229,184,117,93,215,125,223,88,142,35,91,215,125,93,24,126,99,56,18,0,0,
+    158,224,0,0,84,96,195,234,8,39,69,99,129,1,66,67,86,2,0,25,0,
+    0,132,49,8,25,132,20,50,8,33,133,20,82,10,33,165,148,0,0,128,1,
+    7,0,128,0,19,202,64,66,67,86,2,0,81,0,0,0,17,214,90,107,173,
+    177,214,90,107,173,69,214,90,107,173,181,214,82,74,41,165,148,82,74,41,165,
+    148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,
+    82,74,169,0,0,169,9,7,0,169,7,27,52,37,22,7,8,66,67,86,2,
+    0,169,0,0,128,49,76,49,229,24,100,208,25,166,156,131,78,66,41,41,53,
+    140,57,231,28,148,148,82,170,156,147,82,74,74,173,181,150,57,39,165,148,148,
+    90,139,49,131,144,74,107,49,214,88,107,6,161,164,212,98,140,177,215,80,74,
+    107,49,214,154,123,238,161,148,214,90,172,181,230,158,75,107,49,230,216,123,14,
+    66,152,148,90,173,53,231,32,116,80,173,213,90,115,206,193,7,97,90,139,181,
+    214,160,131,16,194,0,0,156,6,7,0,208,3,27,86,71,56,41,26,11,12,
+    66,67,86,2,0,169,0,0,4,66,74,49,230,152,115,206,33,165,24,115,206,
+    57,231,156,67,74,49,230,152,115,206,57,167,24,99,206,57,231,32,132,80,49,
+    230,152,115,16,66,8,33,115,206,57,231,32,132,16,66,230,156,115,206,65,8,
+    33,132,206,57,7,33,132,16,66,8,157,115,16,66,8,33,132,16,58,7,33,
+    132,16,66,8,33,116,16,66,8,33,132,16,66,232,32,132,16,66,8,33,132,
+    208,65,8,33,132,16,66,8,161,0,0,192,2,7,0,128,0,27,86,71,56,
+    41,26,11,12,66,67,86,2,0,64,0,0,48,7,161,115,11,42,100,82,66,
+    11,166,34,10,49,9,186,84,208,65,10,186,51,140,32,232,189,68,206,32,231,
+    49,69,142,16,164,177,101,18,33,166,1,66,67,86,2,0,64,0,0,20,196,
+    86,83,137,157,65,204,49,103,169,33,8,49,168,169,66,74,41,134,49,67,202,
+    32,166,41,83,10,33,133,33,115,138,33,2,161,197,86,75,197,0,66,67,86,
+    4,0,81,0,0,128,49,200,49,196,28,114,206,73,234,36,69,206,57,42,29,
+    165,198,57,71,169,163,212,81,74,177,166,90,59,74,165,182,84,107,227,156,163,
+    212,81,202,40,165,90,75,171,29,165,84,107,170,177,0,0,128,0,7,0,128,
+    0,11,33,66,67,86,4,0,81,0,0,4,50,72,41,164,20,82,138,57,167,
+    156,67,74,41,231,152,115,136,41,230,156,114,142,57,231,160,116,82,42,231,156,
+    116,78,74,164,148,114,142,57,167,156,115,82,58,39,153,115,78,74,39,161,0,
+    0,128,0,7,0,128,0,11,33,66,67,86,4,0,113,2,0,14,199,209,52,
+    73,211,68,81,210,52,81,244,68,209,117,61,81,84,93,73,211,76,83,19,69,
+    85,213,68,209,84,77,85,149,101,209,84,101,89,210,52,211,212,68,81,53,53,
+    81,84,85,81,53,101,217,84,85,91,246,76,211,150,77,85,213,109,81,85,109,
+    91,182,101,223,119,101,89,215,61,211,148,109,81,85,109,219,84,85,91,119,101,
+    89,215,101,219,214,125,73,211,76,83,19,69,85,213,68,81,117,77,85,181,109,
+    83,85,109,91,19,69,215,21,85,85,150,69,85,149,101,215,149,117,93,117,101,
+    221,215,68,81,85,61,213,148,93,81,85,101,89,149,93,93,86,101,89,247,69,
+    87,213,109,213,149,125,93,149,101,221,183,109,93,248,101,221,39,140,170,170,235,
+    166,236,234,186,42,203,186,47,235,178,175,219,190,78,153,52,205,52,53,81,84,
+    85,77,20,85,213,116,85,219,54,85,215,182,53,81,116,93,81,85,109,89,52,
+    85,87,86,101,217,247,85,87,150,125,77,20,93,87,84,85,89,22,85,85,150,
+    85,89,214,117,87,118,117,91,84,85,221,86,101,215,247,77,215,213,117,89,215,
+    133,101,182,117,95,56,93,87,215,85,89,246,125,85,150,117,95,214,117,108,93,
+    247,125,207,52,109,219,116,93,93,55,93,85,247,109,93,87,158,217,182,141,95,
+    84,85,93,87,101,89,248,85,89,246,125,93,24,158,231,214,125,225,25,85,85,
+    215,77,217,245,117,85,150,117,225,246,117,163,237,235,198,243,218,54,182,237,35,
+    251,58,194,112,228,11,203,210,181,109,163,235,219,132,89,215,141,190,49,20,126,
+    99,72,51,77,219,54,93,85,215,77,215,245,117,89,215,141,182,174,11,69,85,
+    213,117,85,150,125,95,117,101,223,183,117,95,24,110,223,247,141,81,117,125,95,
+    149,101,97,88,109,217,25,118,223,87,234,190,80,89,101,91,248,109,93,119,142,
+    217,214,133,229,55,142,206,239,43,67,87,183,133,182,174,27,203,236,235,202,179,
+    27,71,103,232,35,0,0,96,192,1,0,32,192,132,50,16,66,67,86,4,0,
+    113,2,0,12,66,206,33,166,32,68,138,65,8,33,164,20,66,72,41,98,12,
+    66,230,156,148,140,57,41,161,148,212,66,41,169,69,140,65,200,28,147,146,57,
+    39,37,148,208,82,40,165,165,80,66,107,161,148,216,66,41,45,182,214,106,77,
+    173,197,26,66,105,45,148,210,90,40,165,197,212,82,141,173,181,26,35,198,32,
+    100,206,73,201,156,147,82,74,105,45,148,210,90,230,28,149,206,65,74,29,132,
+    148,82,74,45,150,148,98,172,156,147,146,65,71,165,131,144,82,73,37,166,146,
+    82,140,33,149,216,74,74,49,150,148,98,108,45,182,220,98,204,57,148,210,98,
+    73,37,182,146,82,172,45,166,28,91,140,57,71,140,65,200,156,147,146,57,39,
+    37,148,210,90,41,169,181,202,57,41,29,132,148,50,7,37,149,148,98,44,37,
+    165,152,57,39,165,131,144,82,7,33,165,146,82,140,41,165,216,66,41,177,149,
+    148,106,44,37,181,216,98,204,185,165,24,107,40,169,197,146,82,140,37,165,24,
+    91,140,57,183,216,114,235,32,180,22,82,137,49,148,18,99,139,49,215,214,90,
+    141,161,148,216,74,74,49,150,148,106,139,177,214,222,98,204,57,148,18,99,73,
+    165,198,146,82,172,173,198,92,99,140,57,167,216,114,77,45,214,220,98,236,181,
+    182,220,122,205,57,232,212,90,173,41,166,92,91,140,57,199,220,130,172,57,247,
+    222,65,104,45,148,210,98,40,37,198,214,90,173,45,198,156,67,41,177,149,148,
+    106,44,37,197,218,98,204,185,181,88,123,40,37,198,146,82,172,37,165,26,91,
+    140,53,199,26,123,77,173,213,218,98,204,53,181,88,115,205,185,247,24,115,236,
+    169,181,154,91,140,53,167,216,114,173,57,247,94,115,235,177,0,0,128,1,7,
+    0,128,0,19,202,64,66,67,86,2,0,81,0,0,4,33,74,49,6,161,65,
+    136,49,231,164,52,8,49,230,156,148,138,49,231,32,164,82,49,230,28,132,82,
+    50,231,32,148,146,82,230,28,132,82,82,10,165,164,146,82,107,161,148,82,82,
+    106,173,0,0,128,2,7,0,128,0,27,52,37,22,7,8,66,67,86,2,0,
+    169,0,0,6,199,177,44,207,19,69,83,149,109,199,146,60,79,20,77,83,85,
+    109,219,177,44,207,19,69,211,84,85,219,182,60,79,20,77,83,85,93,87,215,
+    45,207,19,69,83,85,85,215,213,117,79,20,85,83,85,93,87,150,117,223,19,
+    69,83,85,85,215,149,101,223,55,77,85,85,93,87,150,101,91,248,69,83,117,
+    85,215,149,101,89,246,141,213,85,93,87,150,101,91,183,133,97,85,93,215,149,
+    101,217,182,117,99,184,117,93,215,125,95,24,150,163,115,235,182,174,251,190,47,
+    28,191,115,12,0,0,79,112,0,0,42,176,97,117,132,147,162,177,192,66,67,
+    86,2,0,25,0,0,132,49,8,25,132,20,50,8,33,133,20,82,10,33,165,
+    148,0,0,128,1,7,0,128,0,19,202,64,66,67,86,2,0,81,0,0,0,
+    33,82,74,41,165,145,82,74,41,165,52,82,74,41,165,148,82,66,8,33,132,
+    16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,
+    66,8,33,132,16,66,8,161,0,0,255,9,7,0,255,7,27,52,37,22,7,
+    8,66,67,86,2,0,225,0,0,128,49,74,49,229,24,116,18,82,106,24,115,
+    12,66,41,41,165,212,90,195,24,99,16,74,73,169,181,150,42,231,32,148,146,
+    82,107,177,197,88,57,7,161,164,148,90,139,53,198,14,66,74,173,181,88,99,
+    173,53,119,16,82,74,45,214,88,115,176,57,148,210,90,140,177,230,156,123,239,
+    33,165,214,98,172,181,230,222,123,47,173,197,88,107,206,185,7,33,132,105,41,
+    198,92,115,237,193,247,222,83,108,181,214,154,123,240,65,8,161,98,171,181,230,
+    224,131,16,66,8,23,99,238,185,7,225,123,16,66,184,24,115,206,61,8,225,
+    131,15,194,0,0,238,6,7,0,136,4,27,103,88,73,58,43,28,13,14,66,
+    67,86,2,0,33,1,0,4,66,76,49,230,156,115,16,66,8,33,82,138,49,
+    231,156,131,16,66,8,165,68,74,49,230,156,115,208,65,8,161,132,140,49,231,
+    156,131,16,66,8,165,148,146,49,230,156,115,16,66,40,161,148,82,50,231,156,
+    131,16,66,8,165,148,82,74,230,28,116,16,66,40,161,148,82,74,233,156,131,
+    16,66,8,161,148,82,74,41,29,116,16,66,40,161,148,82,74,41,37,132,16,
+    66,40,161,148,82,74,41,165,132,16,66,40,161,148,82,74,41,165,148,16,66,
+    9,165,148,82,74,41,165,148,18,66,40,165,148,82,74,41,165,148,82,66,8,
+    165,148,82,74,41,165,148,82,82,40,165,148,82,74,41,165,148,82,74,10,165,
+    148,82,74,41,165,148,82,74,41,161,148,82,74,41,165,148,146,82,42,169,0,
+    0,128,3,7,0,128,0,35,232,36,163,202,34,108,52,225,194,3,16,66,67,
+    86,2,0,64,0,0,180,214,28,115,235,165,99,16,58,235,37,50,10,41,232,
+    181,83,142,57,233,53,51,138,32,231,57,68,204,24,230,177,84,204,16,131,177,
+    101,16,33,101,1,66,67,86,2,0,64,0,0,136,179,22,91,138,145,81,204,
+    57,136,33,50,8,49,136,161,66,74,49,103,45,67,202,32,135,41,83,10,33,
+    101,165,115,140,33,226,164,197,214,66,197,0,66,67,86,4,0,81,0,0,128,
+    49,200,49,196,28,114,206,73,234,36,69,206,57,42,29,165,198,57,71,169,163,
+    212,81,74,177,166,92,59,74,37,182,84,107,227,156,163,212,81,202,40,165,92,
+    75,171,29,165,84,107,170,177,0,0,128,0,7,0,128,0,11,33,66,67,86,
+    4,0,81,0,0,4,66,72,41,164,20,82,138,57,167,156,67,74,41,231,152,
+    115,136,41,229,156,114,78,57,231,160,116,82,42,231,156,116,78,74,164,148,114,
+    78,57,167,156,115,82,58,39,149,115,78,74,39,161,0,0,128,0,7,0,128,
+    0,11,33,66,67,86,4,0,113,2,0,14,199,241,60,73,211,68,81,210,52,
+    81,244,76,209,117,61,209,116,93,73,211,76,83,19,69,85,213,68,81,85,77,
+    87,181,109,209,84,101,91,210,52,211,212,68,81,85,53,81,84,85,81,53,109,
+    217,84,85,219,246,76,211,150,77,215,213,109,81,85,117,91,182,109,97,120,109,
+    219,247,61,211,180,109,81,85,109,221,116,93,91,119,109,217,247,101,91,215,141,
+    71,211,76,83,19,69,87,213,68,81,117,77,87,213,109,83,117,109,93,19,69,
+    215,21,85,87,150,69,213,149,101,87,150,117,95,149,101,221,215,68,209,117,69,
+    213,148,93,81,117,101,91,149,93,223,118,101,89,247,77,215,245,117,85,150,133,
+    95,149,101,225,183,117,93,24,110,223,55,158,81,85,117,95,149,93,223,87,101,
+    217,23,110,221,54,126,219,247,133,103,210,52,211,212,68,209,85,53,209,84,93,
+    211,85,117,221,116,93,219,214,68,209,117,69,87,181,101,209,84,93,217,149,109,
+    223,87,93,217,246,53,81,116,93,209,85,101,89,116,85,89,86,101,217,247,93,
+    89,246,117,81,85,125,91,149,101,223,87,93,217,247,109,223,23,134,217,214,125,
+    225,116,93,93,87,101,217,23,86,89,246,125,219,215,149,229,214,117,225,248,76,
+    211,182,77,215,213,117,211,117,125,223,246,117,103,153,117,93,248,69,215,245,125,
+    85,150,125,99,181,101,95,248,133,223,169,251,198,241,140,170,170,235,170,237,10,
+    191,42,203,194,176,11,187,243,220,190,47,148,117,219,248,109,221,103,220,190,143,
+    241,227,252,198,145,107,219,194,49,235,182,115,220,190,174,44,191,243,51,126,101,
+    88,122,166,105,219,166,235,250,186,233,186,190,47,235,186,49,220,190,175,20,85,
+    213,215,85,91,54,134,213,149,133,227,22,126,227,216,125,225,56,70,215,245,125,
+    85,150,125,99,181,101,97,216,125,223,120,126,97,120,158,215,182,141,225,246,125,
+    202,108,235,70,31,124,159,242,204,186,141,237,251,198,114,251,58,231,119,142,206,
+    240,12,9,0,0,24,112,0,0,8,48,161,12,4,66,67,86,4,0,113,2,
+    0,12,66,206,33,166,32,68,138,65,8,33,164,212,65,72,41,98,12,66,230,
+    156,148,140,57,41,161,148,212,66,41,169,69,140,65,200,28,147,146,57,39,37,
+    148,210,82,40,165,165,80,66,107,161,148,216,66,41,173,181,214,106,77,173,197,
+    26,66,105,45,148,18,99,40,165,197,212,90,141,169,181,90,35,198,32,100,206,
+    73,201,156,147,82,74,105,45,148,210,90,230,28,149,206,65,74,29,132,148,82,
+    74,45,150,148,98,172,156,147,146,65,71,165,131,144,82,73,37,166,146,82,140,
+    33,149,216,74,74,177,150,148,106,108,45,182,220,98,204,57,148,210,98,73,37,
+    182,146,82,172,45,166,28,99,140,57,71,140,65,200,156,147,146,57,39,37,148,
+    210,90,41,169,197,202,57,41,29,132,148,50,7,37,149,148,98,44,37,165,152,
+    57,39,169,131,144,82,7,29,165,146,82,140,169,165,216,66,41,177,149,148,106,
+    44,37,181,216,98,204,185,165,24,107,40,169,197,146,82,172,37,165,24,91,140,
+    57,183,216,114,235,32,180,22,82,137,49,148,18,99,139,49,231,214,90,173,161,
+    148,24,75,74,177,150,148,106,140,177,214,30,99,204,57,148,18,99,73,165,198,
+    146,82,172,173,198,94,91,140,53,167,214,114,77,45,214,220,98,236,185,182,220,
+    122,205,185,247,212,90,173,41,182,92,91,140,185,199,28,131,172,57,247,224,65,
+    104,45,148,210,98,40,37,198,214,90,173,45,198,156,67,41,177,149,148,106,44,
+    37,197,26,99,204,185,197,90,123,40,37,198,146,82,172,37,165,90,99,140,57,
+    199,26,123,77,173,229,218,98,236,57,181,88,115,205,57,248,24,115,236,169,197,
+    154,99,140,185,167,216,114,173,57,247,94,115,11,178,0,0,128,1,7,0,128,
+    0,19,202,64,66,67,86,2,0,81,0,0,4,33,74,49,6,161,65,136,49,
+    231,36,52,8,49,230,156,148,138,49,231,32,164,82,49,230,28,132,146,50,231,
+    32,148,146,82,230,28,132,82,82,10,165,164,146,82,107,161,148,146,82,106,173,
+    0,0,128,2,7,0,128,0,27,52,37,22,7,8,66,67,86,2,0,169,0,
+    0,6,199,177,44,207,19,69,213,148,101,199,146,60,79,20,77,83,85,109,219,
+    177,44,207,19,69,211,84,85,219,182,60,79,20,77,83,85,93,87,215,45,207,
+    19,69,83,85,85,215,213,117,79,20,85,83,85,93,87,150,125,223,19,69,211,
+    84,85,215,149,101,223,55,77,211,85,93,87,150,109,219,247,77,211,84,93,215,
+    149,101,217,246,133,213,85,93,87,150,109,91,183,141,97,85,93,215,149,101,219,
+    182,117,229,184,117,91,215,133,95,24,134,97,106,235,186,239,251,190,48,28,195,
+    51,13,0,0,79,112,0,0,42,176,97,117,132,147,162,177,192,66,67,86,2,
+    0,25,0,0,132,49,8,25,132,20,50,8,33,133,20,82,10,33,165,148,0,
+    0,128,1,7,0,128,0,19,202,64,66,67,86,2,0,169,0,0,0,33,214,
+    90,107,173,181,214,18,75,173,181,214,90,107,173,53,84,90,107,173,181,214,90,
+    107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,
+    173,181,214,90,107,173,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,
+    165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,
+    148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,169,0,64,
+    191,10,7,0,255,7,27,86,71,56,41,26,11,12,66,67,86,2,0,225,0,
+    0,128,49,74,49,6,157,116,18,82,106,152,114,12,66,41,169,164,210,74,163,
+    152,115,16,74,73,41,165,214,42,231,36,164,210,82,107,173,197,88,57,39,165,
+    164,148,90,139,45,198,14,66,74,45,181,22,99,140,49,118,16,82,74,173,181,
+    24,99,140,49,148,210,82,140,49,214,24,107,173,161,164,212,90,140,49,198,154,
+    107,45,41,181,22,99,173,181,214,220,123,73,169,197,24,99,174,53,247,220,75,
+    107,49,214,90,115,206,57,231,158,90,139,177,214,154,115,238,57,248,212,90,140,
+    49,231,218,123,239,61,168,214,98,172,53,215,156,131,240,189,0,0,238,6,7,
+    0,136,4,27,103,88,73,58,43,28,13,14,66,67,86,2,0,33,1,0,4,
+    66,140,49,230,156,115,16,66,8,33,82,138,49,231,156,131,16,66,8,33,68,
+    74,49,230,156,115,16,66,8,33,132,140,49,231,156,131,16,66,8,165,148,146,
+    49,230,156,115,16,66,40,161,132,82,50,231,156,131,16,66,8,165,148,82,74,
+    230,156,115,16,66,8,161,148,82,74,233,160,131,16,66,8,165,148,82,74,41,
+    157,115,16,66,8,165,148,82,74,41,37,132,16,66,41,165,148,82,74,41,165,
+    132,16,66,40,165,148,82,74,41,165,148,16,66,40,165,148,82,74,41,165,148,
+    18,66,8,165,148,82,74,41,37,149,82,66,8,165,148,82,74,41,165,148,82,
+    74,8,161,148,82,74,41,165,148,82,74,9,37,148,82,74,41,165,148,82,74,
+    41,161,132,82,74,41,165,148,82,82,41,165,0,0,128,3,7,0,128,0,35,
+    232,36,163,202,34,108,52,225,194,3,16,66,67,86,2,0,64,0,0,52,232,
+    224,107,236,37,99,18,75,238,161,49,10,49,232,173,99,206,57,234,53,51,138,
+    32,199,177,67,204,32,230,45,84,142,16,228,53,102,18,33,198,1,66,67,86,
+    2,0,100,0,0,136,195,86,91,79,177,70,6,41,230,36,180,92,34,132,148,
+    131,16,115,137,144,82,204,57,138,45,67,202,40,198,168,166,140,41,165,152,146,
+    90,67,231,20,99,140,122,234,28,83,138,25,102,165,180,82,66,137,20,148,150,
+    99,173,181,99,14,0,66,67,86,4,0,81,0,0,128,49,200,49,196,24,114,
+    206,73,201,160,68,206,49,9,157,148,200,57,39,165,147,210,73,41,45,150,24,
+    51,41,37,166,18,99,227,156,163,210,73,201,164,148,24,75,138,157,164,18,99,
+    137,173,0,0,128,0,7,0,128,0,11,33,66,67,86,4,0,81,0,0,136,
+    49,72,41,164,20,82,74,57,167,152,67,74,41,199,148,115,72,41,229,156,114,
+    78,57,231,32,116,16,42,199,24,116,14,66,164,148,114,76,57,167,28,115,16,
+    50,7,149,115,14,66,7,161,0,0,128,0,7,0,128,0,11,33,66,67,86,
+    4,0,113,2,0,14,71,242,60,73,179,68,81,178,52,81,244,76,81,118,61,
+    209,116,93,73,211,76,83,19,69,85,181,60,81,85,77,85,181,109,209,84,101,
+    91,210,52,209,212,68,79,85,53,81,84,85,81,53,109,217,84,85,219,246,76,
+    83,150,77,85,213,109,81,85,109,91,182,109,225,119,101,89,247,61,211,148,101,
+    81,85,109,221,84,85,91,119,109,217,247,101,221,214,133,73,211,76,83,19,69,
+    85,213,68,81,85,77,85,181,109,83,117,109,91,19,69,87,21,85,85,150,69,
+    85,149,101,87,150,117,95,117,101,221,183,68,81,85,61,213,148,93,81,85,101,
+    91,149,93,223,86,101,217,23,78,87,213,117,85,150,125,95,149,101,225,183,117,
+    93,24,110,223,23,142,81,85,109,221,116,93,93,87,101,217,23,102,93,22,118,
+    91,247,141,146,166,153,166,38,138,170,170,137,162,170,154,170,106,219,166,234,218,
+    186,37,138,174,42,170,170,44,123,166,234,202,170,44,251,186,234,202,182,174,137,
+    162,234,138,170,42,203,162,170,202,178,42,203,186,175,202,178,110,139,170,170,219,
+    170,44,11,187,233,186,186,110,251,190,48,204,178,174,11,167,234,234,186,42,203,
+    190,175,202,178,174,219,186,110,28,183,174,11,195,103,154,178,108,186,170,174,155,
+    170,171,235,182,174,27,199,108,219,198,49,170,170,238,171,178,44,12,171,44,251,
+    190,174,251,66,91,23,18,85,85,215,77,217,53,126,85,150,117,223,246,117,231,
+    185,117,95,40,219,182,243,219,186,175,28,183,174,43,141,159,243,252,198,145,107,
+    219,198,49,235,182,241,219,186,111,60,191,242,19,134,227,88,122,166,105,219,166,
+    170,218,186,169,186,186,46,235,182,50,204,186,46,20,85,213,215,85,89,246,125,
+    211,149,117,225,246,125,227,184,117,221,40,170,170,174,171,178,236,11,171,44,27,
+    195,109,252,198,177,11,195,209,181,109,227,184,117,221,41,219,186,208,55,134,124,
+    159,240,188,182,109,28,183,175,51,110,95,55,250,202,144,112,252,8,0,0,24,
+    112,0,0,8,48,161,12,4,66,67,86,4,0,113,2,0,12,66,206,41,166,
+    32,84,138,65,232,32,164,212,65,72,169,98,12,66,230,156,148,138,57,40,161,
+    148,212,66,40,169,85,140,65,168,28,147,144,57,39,37,148,208,82,40,165,165,
+    14,66,75,161,148,214,66,41,173,165,214,98,77,169,197,218,65,72,45,148,210,
+    90,40,165,181,212,82,141,169,181,24,35,198,32,100,206,73,201,156,147,18,74,
+    105,45,148,210,90,230,156,148,206,65,73,29,132,148,74,73,41,150,148,90,172,
+    152,147,146,65,71,165,131,144,82,73,37,166,146,82,107,161,148,214,74,73,45,
+    150,148,98,108,41,182,220,98,172,57,148,210,90,72,37,182,146,82,140,41,166,
+    218,90,140,53,71,140,65,200,156,147,146,57,39,37,148,210,90,40,165,181,202,
+    49,41,29,132,148,50,7,37,149,148,90,43,37,165,152,57,39,165,131,144,82,
+    7,29,149,146,82,108,37,149,152,66,41,173,149,148,98,11,165,180,216,98,172,
+    57,165,216,106,40,165,181,146,82,140,37,149,216,90,140,181,182,152,106,235,32,
+    180,22,74,105,45,148,210,90,107,173,214,212,90,141,161,148,214,74,74,49,150,
+    148,98,107,45,214,220,98,204,53,148,210,90,73,37,182,146,82,139,45,182,28,
+    91,140,53,167,214,106,76,173,213,220,98,204,53,182,218,122,172,53,231,148,90,
+    173,169,165,26,91,140,53,199,218,122,171,53,247,222,65,72,45,148,210,90,40,
+    165,197,212,90,140,173,197,90,67,41,173,149,84,98,43,37,181,216,98,204,181,
+    181,24,115,40,165,197,146,82,139,37,165,24,91,140,53,183,216,114,77,45,213,
+    216,98,204,53,165,22,107,205,181,231,216,106,236,169,181,88,91,140,53,167,150,
+    106,173,181,230,30,115,235,173,0,0,128,1,7,0,128,0,19,202,64,66,67,
+    86,2,0,81,0,0,4,33,74,57,39,165,65,200,49,231,168,36,8,49,231,
+    156,164,202,49,9,165,164,84,49,7,33,148,212,58,231,164,164,20,91,231,32,
+    148,148,90,44,169,180,20,91,173,165,164,212,90,172,181,0,0,128,2,7,0,
+    128,0,27,52,37,22,7,8,66,67,86,2,0,81,0,0,136,49,8,49,6,
+    161,65,70,41,198,32,52,6,41,197,24,132,72,41,198,156,147,82,41,197,152,
+    115,82,50,198,156,131,144,74,198,152,115,16,74,10,33,148,146,74,74,33,132,
+    82,82,73,169,0,0,128,2,7,0,128,0,27,52,37,22,7,8,66,67,86,
+    4,0,81,0,0,128,49,136,49,196,24,130,208,81,201,168,68,16,50,41,157,
+    164,6,66,104,45,180,214,89,75,173,149,22,51,107,169,181,210,98,3,33,180,
+    22,90,203,44,149,24,83,107,153,181,18,99,106,173,0,0,176,3,7,0,176,
+    3,11,33,66,67,86,2,0,121,0,0,132,49,74,49,230,156,115,6,33,198,
+    156,131,206,65,131,16,99,206,65,232,160,98,204,57,232,32,132,80,49,230,28,
+    132,16,66,200,156,131,16,66,8,33,100,206,65,8,33,132,16,58,8,33,132,
+    80,74,41,29,132,16,66,40,165,148,14,66,8,33,148,82,74,7,33,132,16,
+    74,41,165,0,0,160,2,7,0,128,0,27,69,54,39,24,9,10,66,67,86,
+    2,0,121,0,0,128,49,74,57,7,161,148,70,41,198,32,148,146,82,163,20,
+    99,16,74,73,169,114,12,66,41,41,197,86,57,7,161,148,148,90,236,32,148,
+    210,90,108,53,118,16,74,105,45,198,90,67,74,173,197,88,107,174,33,165,214,
+    98,172,53,215,212,90,140,181,230,154,107,74,45,198,90,107,205,185,0,0,220,
+    5,7,0,176,3,27,69,54,39,24,9,10,66,67,86,2,0,121,0,0,8,
+    66,74,49,198,24,99,72,33,166,24,115,206,57,132,144,82,140,57,231,156,98,
+    138,49,231,156,115,78,41,198,152,115,206,57,199,24,115,206,57,231,156,99,140,
+    57,231,156,115,206,49,231,156,115,206,57,231,152,115,206,57,231,156,115,206,57,
+    231,156,115,206,57,231,156,115,206,57,231,156,0,0,160,2,7,0,128,0,27,
+    69,54,39,24,9,10,66,67,86,2,0,169,0,0,0,17,86,98,140,49,198,
+    24,27,8,49,198,24,99,140,49,70,18,98,140,49,198,24,99,108,49,198,24,
+    99,140,49,198,152,98,140,49,198,24,99,140,49,198,24,99,140,49,198,24,99,
+    140,49,198,24,99,140,49,198,24,99,140,49,198,24,99,140,49,198,24,99,140,
+    49,198,24,99,140,49,198,24,99,140,49,198,24,99,140,49,198,24,91,107,173,
+    181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,0,64,191,10,7,0,
+    255,7,27,86,71,56,41,26,11,12,66,67,86,2,0,225,0,0,128,49,140,
+    57,231,152,99,208,65,104,152,130,78,74,232,32,132,16,58,164,148,131,82,66,
+    8,165,148,146,50,231,164,164,84,74,74,169,165,148,57,39,37,165,82,82,106,
+    41,165,14,66,74,173,165,212,82,107,173,117,80,82,106,45,165,214,90,107,173,
+    131,80,74,75,173,181,214,90,139,29,132,148,82,106,173,181,216,98,12,165,164,
+    212,90,139,45,198,88,99,40,37,165,214,90,140,45,198,26,67,42,45,197,214,
+    98,140,49,198,26,74,105,173,181,22,99,140,177,214,146,82,107,45,198,88,107,
+    172,181,150,148,90,107,45,182,88,99,173,181,0,0,238,6,7,0,136,4,27,
+    103,88,73,58,43,28,13,14,66,67,86,2,0,33,1,0,4,66,140,57,231,
+    156,115,16,66,8,33,82,138,49,231,160,131,16,66,8,33,68,74,49,230,28,
+    116,16,66,8,33,132,140,49,231,160,131,16,66,8,33,132,144,49,230,28,116,
+    16,66,8,33,132,16,58,231,28,132,16,66,8,161,132,82,74,231,28,116,16,
+    66,8,33,148,80,66,233,32,132,16,66,8,161,132,82,74,41,29,132,16,66,
+    40,161,132,82,74,41,37,132,16,66,9,165,148,82,74,41,165,132,16,66,8,
+    161,132,18,74,41,165,148,16,66,8,165,148,82,74,41,165,148,18,66,8,33,
+    148,82,74,41,165,148,82,66,8,161,148,80,74,41,165,148,82,74,8,33,132,
+    82,74,41,165,148,82,74,9,33,132,80,74,41,165,148,82,74,41,33,132,18,
+    74,41,165,148,82,74,41,165,0,0,128,3,7,0,128,0,35,232,36,163,202,
+    34,108,52,225,194,3,16,66,67,86,2,0,100,0,0,140,4,25,100,16,66,
+    40,202,65,10,185,245,96,33,196,152,147,20,132,230,24,132,18,99,16,158,66,
+    204,48,228,52,136,208,65,6,157,244,224,74,230,12,51,204,131,75,161,84,16,
+    49,13,54,150,220,56,130,52,8,155,114,37,149,227,32,0,66,67,86,2,0,
+    100,0,0,8,212,88,99,111,177,70,70,41,7,169,180,92,34,164,148,147,18,
+    123,169,148,82,14,66,171,49,83,202,40,197,168,150,140,49,165,20,147,152,75,
+    232,144,66,74,106,9,157,83,10,25,69,41,181,84,66,136,16,148,150,99,140,
+    177,99,12,0,66,67,86,4,0,81,0,0,128,49,198,49,196,24,114,206,73,
+    201,160,68,206,49,9,157,148,200,57,39,165,147,210,73,41,45,150,24,51,41,
+    37,166,18,99,228,156,163,210,73,201,164,148,24,75,138,157,164,18,99,137,173,
+    0,0,128,0,7,0,128,0,11,33,66,67,86,4,0,81,0,0,136,49,72,
+    41,164,20,82,74,57,167,152,67,74,41,199,148,115,72,41,229,156,114,78,57,
+    231,32,116,16,42,198,24,116,14,66,164,148,114,76,57,167,156,115,16,50,7,
+    149,115,14,66,7,161,0,0,128,0,7,0,128,0,11,33,66,67,86,4,0,
+    113,2,0,14,201,241,60,73,179,68,81,178,52,81,244,68,81,118,61,209,116,
+    101,73,211,76,81,19,69,85,213,60,81,85,77,85,181,109,209,84,101,91,210,
+    52,209,180,68,79,85,53,81,84,85,81,53,109,217,84,85,91,246,76,83,150,
+    77,85,213,117,81,85,109,91,182,109,225,119,101,219,247,61,211,148,109,81,85,
+    109,221,84,93,91,119,109,217,215,101,219,214,133,73,211,76,83,19,69,85,213,
+    68,81,85,77,87,181,109,83,85,109,91,19,69,87,21,85,85,150,69,85,149,
+    101,85,150,109,93,117,101,221,183,68,81,117,61,213,148,93,81,85,101,91,149,
+    93,223,86,101,89,247,77,87,181,117,85,150,117,97,149,101,225,215,117,95,248,
+    109,221,55,138,170,106,235,166,235,250,186,42,203,190,47,235,182,177,219,190,143,
+    164,105,166,169,137,162,170,106,162,168,170,166,170,218,182,169,186,182,109,137,162,
+    170,138,170,42,203,158,169,186,178,42,203,190,174,186,178,237,107,162,168,186,162,
+    170,202,178,168,170,178,172,202,178,175,171,178,171,235,162,170,234,182,42,203,194,
+    111,186,178,238,219,190,207,184,109,93,23,78,213,213,117,85,150,125,95,149,101,
+    223,183,125,95,25,110,93,23,134,207,52,109,219,116,85,93,55,85,215,215,109,
+    93,55,158,217,246,133,99,84,85,221,87,101,89,24,86,89,22,126,221,247,209,
+    125,31,81,85,117,221,148,93,97,87,101,89,248,117,97,119,150,221,247,149,178,
+    110,19,110,221,231,236,190,79,25,142,248,194,145,107,219,202,49,235,54,225,214,
+    125,101,249,141,159,178,60,195,211,51,77,217,54,85,85,215,77,215,213,125,91,
+    183,149,223,214,117,198,168,170,190,174,202,50,95,117,101,95,184,125,161,178,251,
+    190,81,84,85,221,87,101,217,247,85,91,54,134,221,247,141,103,23,150,92,219,
+    22,134,219,215,145,109,93,233,27,79,190,111,28,93,219,22,158,219,247,149,182,
+    111,115,126,103,72,168,83,6,0,0,12,56,0,0,4,152,80,6,2,66,67,
+    86,4,0,113,2,0,12,66,206,41,166,32,84,138,65,232,32,164,212,65,72,
+    169,98,12,66,230,156,148,140,57,40,161,148,148,66,40,169,85,140,65,200,28,
+    147,144,57,39,37,148,208,82,40,165,165,14,66,74,161,148,214,66,41,173,165,
+    214,106,76,169,197,216,65,72,41,148,210,90,40,165,181,212,82,108,169,181,24,
+    35,198,32,100,142,73,201,152,147,18,74,105,41,148,146,90,230,156,148,206,65,
+    74,29,132,148,74,73,45,150,146,90,171,24,147,146,65,71,165,115,80,82,73,
+    37,166,146,82,107,161,148,214,74,73,49,150,148,90,108,173,197,218,90,172,53,
+    148,210,90,40,37,182,146,82,140,169,165,218,90,140,181,86,140,65,200,28,147,
+    146,57,39,37,148,210,82,40,37,181,138,49,41,29,116,84,50,7,37,149,148,
+    90,43,37,165,152,57,39,165,131,144,82,7,29,165,146,74,108,37,165,216,66,
+    41,173,149,148,98,11,165,180,216,98,171,53,165,214,106,40,165,181,146,82,140,
+    37,149,216,90,107,181,182,216,106,236,32,164,20,74,105,45,148,210,90,106,173,
+    198,212,90,172,161,148,214,74,74,49,150,148,98,108,45,214,220,90,172,53,148,
+    210,90,72,37,182,82,82,139,45,182,26,91,139,53,167,214,106,76,173,213,218,
+    98,172,53,198,90,123,172,53,231,212,82,140,169,165,26,91,139,53,183,218,114,
+    139,53,231,222,65,72,41,148,210,90,40,165,181,212,90,141,169,181,24,67,41,
+    173,149,84,98,11,37,181,216,98,171,181,181,24,107,40,165,181,146,82,140,37,
+    165,24,91,108,181,182,24,107,77,41,197,216,98,171,53,165,22,107,173,181,231,
+    214,106,203,169,181,88,91,140,53,167,214,106,141,181,246,30,107,236,177,0,0,
+    128,1,7,0,128,0,19,202,64,66,67,86,2,0,81,0,0,4,33,74,57,
+    39,165,65,200,49,231,40,37,8,49,231,28,165,202,49,8,37,180,84,49,7,
+    33,148,212,58,231,36,180,20,99,231,32,148,212,98,44,41,181,22,99,173,165,
+    164,212,98,172,181,0,0,128,2,7,0,128,0,27,52,37,22,7,8,66,67,
+    86,2,0,81,0,0,136,49,8,49,6,161,65,70,41,198,32,52,6,41,197,
+    28,132,72,41,198,156,147,18,41,197,152,115,82,50,199,156,147,144,82,198,156,
+    115,80,74,10,33,148,146,82,75,33,132,82,82,74,173,0,0,128,2,7,0,
+    128,0,27,52,37,22,7,8,66,67,86,4,0,81,0,0,128,49,136,49,196,
+    24,130,142,73,233,164,68,14,50,41,153,132,198,57,72,169,163,148,81,42,37,
+    150,24,51,74,37,182,18,99,4,157,163,20,82,202,40,149,24,75,139,25,165,
+    18,99,136,165,0,0,176,3,7,0,176,3,11,33,66,67,86,2,0,121,0,
+    0,136,49,74,49,230,156,115,6,33,166,156,115,206,57,131,144,98,206,57,231,
+    156,98,140,49,231,156,115,78,49,198,152,115,206,57,199,156,115,206,57,8,33,
+    100,206,57,231,28,132,16,58,231,156,131,16,66,8,157,115,206,65,8,33,132,
+    206,57,231,32,132,16,66,231,156,115,16,66,8,161,0,0,160,2,7,0,128,
+    0,27,69,54,39,24,9,10,66,67,86,2,0,121,0,0,128,49,74,57,7,
+    161,148,70,41,198,32,148,146,82,163,20,99,16,74,73,169,114,14,66,41,41,
+    181,86,57,7,161,148,148,90,235,32,148,146,82,107,49,118,16,74,73,169,181,
+    24,75,41,41,197,24,99,174,161,148,150,90,140,177,230,212,90,140,49,230,154,
+    115,74,45,198,90,107,206,185,0,0,220,5,7,0,176,3,27,69,54,39,24,
+    9,10,66,67,86,2,0,121,0,0,8,66,74,49,198,24,99,72,33,198,24,
+    115,204,57,132,148,98,140,49,230,156,98,140,49,199,156,115,78,41,198,24,115,
+    206,57,199,24,115,206,57,231,156,99,140,49,231,156,115,206,49,198,156,115,206,
+    57,231,152,115,206,57,231,156,115,204,57,231,156,115,206,57,230,156,115,206,57,
+    231,156,0,0,160,2,7,0,128,0,27,69,54,39,24,9,10,66,67,86,2,
+    0,225,0,0,0,17,208,113,206,57,231,156,115,110,28,196,90,107,173,181,214,
+    90,107,228,160,214,90,107,173,181,214,90,83,173,181,214,90,107,173,181,214,154,
+    106,173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,
+    173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,
+    181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,
+    214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,214,
+    90,107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,0,32,
+    223,10,7,0,255,7,27,103,88,73,58,43,28,13,14,66,67,86,2,0,225,
+    0,0,128,49,140,57,232,28,116,208,65,104,152,114,14,66,8,33,132,16,66,
+    195,20,132,82,66,40,165,148,148,50,232,164,164,84,74,74,41,165,148,57,40,
+    37,165,82,82,74,41,181,78,74,74,173,165,212,90,107,177,117,82,82,106,41,
+    165,212,90,107,177,131,144,74,74,173,181,22,91,108,29,132,148,82,106,173,181,
+    22,99,12,165,164,214,90,107,49,198,24,99,40,37,165,214,90,139,49,198,26,
+    75,41,45,181,22,99,140,49,198,88,74,74,169,181,24,99,140,49,198,146,82,
+    107,177,181,24,99,140,177,150,148,90,139,45,198,88,99,172,177,0,0,238,6,
+    7,0,136,4,27,103,88,73,58,43,28,13,14,66,67,86,2,0,33,1,0,
+    8,66,140,57,231,156,115,208,57,8,33,82,138,49,231,156,115,14,66,8,33,
+    68,74,49,230,156,115,206,65,8,33,132,140,49,231,156,131,16,66,8,33,132,
+    144,49,230,156,115,16,66,8,33,132,16,58,231,156,131,16,66,8,33,132,16,
+    66,231,156,115,16,66,8,33,132,16,66,232,156,131,16,66,8,33,132,16,66,
+    8,157,115,16,66,8,33,132,16,66,8,161,131,16,66,8,33,132,16,66,8,
+    37,116,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,161,
+    148,16,66,8,33,132,16,66,8,33,132,80,66,8,33,132,16,66,8,37,132,
+    80,66,8,33,132,16,66,40,33,132,18,66,9,33,132,16,66,8,165,148,80,
+    66,41,33,132,16,66,8,161,148,80,74,8,165,0,0,128,3,7,0,128,0,
+    35,232,36,163,202,34,108,52,225,194,3,16,66,67,86,2,0,100,0,0,12,
+    245,24,100,240,65,56,12,66,44,189,245,160,41,196,28,180,214,131,5,25,148,
+    146,115,16,22,67,12,49,38,61,104,208,65,39,41,229,160,49,230,144,115,144,
+    131,199,32,100,142,9,198,53,198,28,73,67,20,8,29,131,70,153,130,30,0,
+    66,67,86,2,0,100,0,0,8,212,152,107,143,177,70,136,49,7,169,180,92,
+    42,164,20,148,18,123,169,148,82,14,66,203,53,83,10,41,229,44,151,142,49,
+    197,24,163,88,75,232,144,50,8,90,9,161,83,10,17,69,45,181,86,66,135,
+    144,147,148,99,140,173,83,12,0,66,67,86,4,0,81,0,0,128,49,134,49,
+    196,24,114,206,73,201,164,68,206,49,41,157,148,200,57,71,165,147,210,73,41,
+    45,150,24,51,41,37,182,18,99,228,156,163,210,73,202,164,148,24,75,139,29,
+    165,18,99,137,173,0,0,128,0,7,0,128,0,11,33,66,67,86,4,0,81,
+    0,0,136,49,72,41,164,20,82,74,57,167,152,67,74,41,199,148,115,72,41,
+    229,152,114,78,57,231,32,116,16,42,199,24,116,14,66,164,148,114,76,57,167,
+    156,115,16,50,7,149,115,14,66,7,161,0,0,128,0,7,0,128,0,11,33,
+    66,67,86,4,0,113,2,0,14,201,241,60,73,179,68,81,178,52,81,244,68,
+    81,118,61,209,116,101,73,211,76,81,19,69,85,181,60,81,85,77,85,181,109,
+    209,84,101,91,210,52,81,212,68,79,85,53,81,84,85,81,53,109,217,84,85,
+    219,246,76,211,150,77,213,213,109,81,85,117,91,182,109,223,119,101,91,248,61,
+    211,148,101,81,85,109,221,84,93,91,119,109,217,247,101,91,215,133,73,211,76,
+    83,19,69,85,213,68,81,85,77,87,213,109,83,117,109,91,19,69,215,21,85,
+    85,150,69,85,149,101,85,150,109,97,149,101,221,183,68,81,85,61,213,148,93,
+    81,85,101,89,149,93,223,86,101,217,247,77,215,213,117,85,150,125,95,149,101,
+    95,183,125,97,88,110,223,55,138,170,106,235,166,236,250,186,42,203,190,111,235,
+    54,223,246,125,163,164,105,166,169,137,162,171,106,162,168,186,166,170,234,182,169,
+    186,182,109,137,162,170,138,170,42,203,158,169,186,178,42,203,194,174,186,178,173,
+    107,162,168,186,162,170,202,178,168,170,178,172,202,174,239,171,178,172,219,162,170,
+    218,186,42,203,190,110,186,178,239,235,190,143,45,235,190,113,170,170,174,171,178,
+    237,27,171,44,251,186,238,251,74,91,215,125,223,51,77,89,54,93,213,215,77,
+    85,245,117,89,247,141,178,173,11,195,168,170,186,174,202,178,111,172,178,236,11,
+    187,239,163,27,63,97,84,85,93,87,101,87,216,85,217,246,133,221,216,9,187,
+    239,27,203,172,219,140,219,247,149,227,246,117,101,249,141,37,95,136,107,219,194,
+    48,251,54,227,246,117,163,111,252,202,112,44,67,158,105,218,182,232,170,186,110,
+    170,174,46,204,186,110,252,182,175,27,195,168,170,190,174,202,50,95,117,101,95,
+    215,125,159,176,235,190,49,140,174,170,11,171,44,251,190,106,203,190,175,235,190,
+    177,252,198,143,107,219,124,219,247,25,179,173,251,132,223,200,247,133,165,108,219,
+    66,91,248,41,183,174,27,203,240,27,233,202,143,0,0,128,1,7,0,128,0,
+    19,202,64,66,67,86,4,0,113,2,0,12,66,206,41,166,32,84,138,65,232,
+    32,164,212,65,40,169,98,12,66,230,156,148,138,57,40,161,148,214,66,40,169,
+    85,140,65,168,28,147,144,57,39,37,148,208,82,40,165,165,14,66,74,161,148,
+    214,66,41,173,165,214,98,77,169,197,216,65,72,41,148,210,82,40,165,181,212,
+    82,140,169,181,24,43,198,32,100,142,73,201,152,147,18,74,105,41,148,210,90,
+    230,156,148,206,65,74,29,132,148,74,74,173,149,146,90,172,24,147,146,65,71,
+    165,115,80,82,73,37,166,146,82,107,161,148,214,74,73,49,150,148,98,107,45,
+    198,218,90,172,53,148,210,90,40,165,181,146,82,140,169,165,218,90,140,181,86,
+    140,65,200,28,147,146,49,39,37,148,210,82,40,37,181,138,49,41,29,116,84,
+    50,7,37,149,148,98,43,37,165,152,57,39,165,131,144,82,7,33,165,146,74,
+    108,37,165,214,66,41,173,149,148,98,11,165,180,216,98,171,53,165,214,106,40,
+    165,181,146,82,140,37,165,24,91,108,181,182,216,106,236,32,164,20,74,105,45,
+    148,210,90,106,173,198,212,90,140,161,148,214,74,74,49,150,148,98,107,49,214,
+    218,90,172,53,148,210,90,72,37,182,82,82,139,41,182,26,91,139,181,166,214,
+    98,76,45,214,218,98,172,53,198,90,123,172,181,247,148,82,140,169,165,26,91,
+    139,53,199,218,122,172,181,230,222,65,72,41,148,210,90,40,165,181,212,90,141,
+    169,181,88,67,41,173,149,84,98,11,37,181,216,98,171,181,181,24,107,40,165,
+    181,146,82,139,37,165,24,91,108,181,182,24,107,77,173,197,216,98,171,53,165,
+    22,107,204,181,231,216,106,236,169,181,24,91,140,181,182,214,106,141,181,230,28,
+    107,236,181,0,0,128,1,7,0,128,0,19,202,64,66,67,86,2,0,81,0,
+    0,4,33,74,49,39,165,65,200,49,231,40,37,8,49,230,32,165,202,49,8,
+    165,180,86,49,7,165,148,214,58,231,164,180,20,99,231,160,148,148,98,44,41,
+    181,22,99,173,37,165,214,98,172,181,0,0,128,2,7,0,128,0,27,52,37,
+    22,7,8,66,67,86,2,0,81,0,0,136,49,8,49,6,161,65,70,41,199,
+    32,52,6,41,197,24,132,72,41,198,156,147,18,41,197,152,115,82,50,199,156,
+    147,144,82,198,156,115,80,82,10,33,148,146,74,75,33,132,82,82,74,173,0,
+    0,128,2,7,0,128,0,27,52,37,22,7,8,66,67,86,4,0,81,0,0,
+    128,49,136,49,196,24,130,206,65,200,164,68,14,50,40,29,132,6,66,72,165,
+    147,146,81,41,165,149,214,50,41,165,165,210,90,4,161,147,18,82,202,168,148,
+    214,74,106,153,164,210,90,105,165,0,0,176,3,7,0,176,3,11,33,66,67,
+    86,2,0,121,0,0,136,49,74,49,230,156,115,6,33,165,28,115,206,57,131,
+    144,82,204,57,231,156,98,138,49,231,32,132,80,41,198,152,115,16,66,200,28,
+    115,14,66,8,33,100,204,57,7,33,132,16,58,231,32,132,80,66,8,157,115,
+    16,66,8,33,148,206,57,8,33,148,80,74,231,28,132,16,66,41,165,0,0,
+    160,2,7,0,128,0,27,69,54,39,24,9,10,66,67,86,2,0,121,0,0,
+    128,49,74,57,39,37,165,70,41,198,32,164,210,90,164,16,99,16,74,106,173,
+    98,204,57,41,41,197,88,49,230,156,148,212,98,236,32,148,146,82,107,181,118,
+    16,74,73,169,181,90,75,41,41,197,86,107,206,165,148,214,98,172,53,231,212,
+    90,140,181,230,218,115,106,45,198,90,115,206,189,0,0,220,5,7,0,176,3,
+    27,69,54,39,24,9,10,66,67,86,2,0,121,0,0,12,66,74,49,198,24,
+    99,72,41,198,24,99,140,49,164,148,98,140,49,198,152,98,140,49,198,24,115,
+    78,49,198,24,99,140,57,199,24,99,204,49,231,156,99,140,49,198,156,115,206,
+    49,198,24,115,206,57,231,24,99,140,57,231,156,115,140,49,231,156,115,206,57,
+    198,152,115,206,57,231,156,0,0,160,2,7,0,128,0,27,69,54,39,24,9,
+    10,66,67,86,2,0,121,0,0,0,33,82,74,41,165,148,70,74,41,165,148,
+    82,74,35,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,
+    74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,
+    41,165,148,82,74,41,165,148,82,74,41,165,148,82,66,8,33,132,16,66,8,
+    161,0,16,199,11,7,64,159,9,27,69,54,39,24,9,10,66,67,86,2,0,
+    169,0,0,128,49,10,57,5,157,132,84,26,165,156,131,144,74,74,41,53,74,
+    57,39,33,165,148,82,171,156,147,146,82,107,177,197,88,57,39,37,165,214,90,
+    172,177,147,146,82,139,181,214,154,115,39,37,181,22,99,173,181,230,144,82,140,
+    181,230,218,115,208,33,165,22,107,205,53,231,220,75,107,177,230,156,115,15,62,
+    152,216,98,173,189,247,158,123,80,49,214,92,131,238,65,8,161,98,172,57,231,
+    28,132,15,190,0,0,147,8,7,0,196,5,27,86,71,56,41,26,11,12,66,
+    67,86,1,0,49,0,0,129,0,0,0,0,0,0,0,0,32,0,0,0,8,
+    0,0,16,64,0,0,4,16,2,0,33,0,0,0,0,0,0,0,66,67,86,
+    2,0,100,0,0,144,5,223,131,16,66,56,140,82,11,193,4,161,49,7,25,
+    164,146,131,6,37,149,86,91,15,154,67,204,48,230,188,87,18,74,38,41,245,
+    96,57,7,17,67,206,131,132,28,83,140,41,165,173,180,148,81,99,4,3,157,
+    115,199,149,67,16,0,66,67,86,2,0,100,0,0,8,196,90,115,173,57,71,
+    70,57,105,173,230,28,34,131,156,164,216,123,201,12,65,12,82,140,37,100,198,
+    40,39,173,198,20,42,132,148,179,26,83,233,152,82,76,106,76,173,116,76,41,
+    136,45,213,150,66,199,32,165,86,99,77,165,115,16,0,66,67,86,2,0,100,
+    0,0,148,22,35,132,16,66,56,12,66,137,57,8,97,49,164,28,245,224,131,
+    196,144,81,82,131,16,150,82,136,73,236,65,104,138,49,230,152,228,222,66,168,
+    20,34,136,114,173,49,66,140,24,199,65,200,140,73,165,36,7,225,75,170,165,
+    228,32,0,66,67,86,4,0,81,0,0,0,66,136,49,196,24,98,204,65,200,
+    32,68,140,49,8,29,132,136,49,6,33,131,144,65,8,37,133,84,50,8,33,
+    149,80,82,196,24,131,144,65,200,32,132,84,66,41,29,132,144,82,72,165,0,
+    0,128,0,7,0,128,0,11,33,66,67,86,4,0,113,2,0,12,66,206,33,
+    166,32,68,138,65,232,32,164,212,65,72,41,98,12,66,230,156,148,204,57,41,
+    161,148,214,66,41,169,69,140,65,200,28,147,146,57,39,37,148,208,82,40,165,
+    181,14,66,75,161,148,214,66,41,173,165,214,106,77,169,197,218,65,72,41,148,
+    210,90,40,165,181,212,82,140,169,181,90,35,198,32,100,206,73,201,156,147,18,
+    74,105,45,148,146,90,230,156,148,14,66,74,29,132,148,74,74,45,150,148,90,
+    172,156,147,210,65,71,165,131,144,82,73,37,182,146,82,140,161,148,214,74,74,
+    49,150,148,98,108,45,198,218,98,172,53,148,210,90,73,37,182,146,82,140,41,
+    182,26,91,140,181,70,140,65,200,156,147,146,57,39,37,148,210,90,40,165,181,
+    204,57,41,29,132,148,58,7,37,149,148,98,44,37,181,152,57,39,165,131,144,
+    82,7,33,165,146,82,140,37,165,216,66,41,173,149,148,98,44,37,181,216,98,
+    172,181,181,24,107,40,165,181,146,82,140,37,165,24,91,140,185,182,24,107,236,
+    32,164,20,74,105,45,148,210,90,107,173,198,212,90,173,161,148,214,74,74,49,
+    150,148,98,108,49,214,220,98,172,57,148,210,90,73,37,182,146,82,140,45,182,
+    92,91,140,53,167,214,106,109,49,214,218,98,204,181,214,90,123,173,185,247,212,
+    90,173,169,181,90,91,140,53,199,26,123,173,181,246,222,65,72,41,148,210,90,
+    40,165,181,212,90,141,169,181,90,67,41,173,149,148,98,44,37,181,216,98,204,
+    181,181,24,107,40,165,181,146,82,140,37,165,24,91,140,181,182,24,115,77,173,
+    213,216,98,204,53,181,22,107,205,181,231,24,107,236,169,181,90,91,140,53,183,
+    216,114,173,181,246,92,115,236,181,0,0,128,1,7,0,128,0,19,202,64,66,
+    67,86,2,0,81,0,0,136,49,8,49,6,161,65,70,41,198,32,52,6,41,
+    197,24,132,72,41,198,156,147,82,41,197,152,115,82,50,198,156,131,144,74,198,
+    152,115,16,74,10,33,148,146,74,75,33,132,80,82,74,173,0,0,128,2,7,
+    0,128,0,27,52,37,22,7,8,66,67,86,2,0,33,1,0,140,49,74,49,
+    230,156,115,82,82,74,169,65,72,41,198,156,131,80,74,74,173,53,8,41,197,
+    152,115,16,74,73,169,181,74,41,198,156,131,16,66,41,41,181,86,41,197,152,
+    115,16,66,40,37,165,214,50,198,156,131,78,66,9,169,180,20,91,198,152,115,
+    14,66,9,165,164,212,90,236,156,131,16,66,41,169,164,212,90,140,157,115,16,
+    66,41,165,164,148,90,107,177,131,16,66,9,169,164,212,82,108,49,118,16,66,
+    8,165,164,148,82,107,49,198,82,74,41,169,164,212,82,108,49,214,88,74,41,
+    165,164,148,82,107,49,198,88,83,74,41,181,212,90,108,49,214,88,107,74,41,
+    165,212,90,107,49,198,88,107,77,173,181,22,91,108,49,214,88,107,173,169,181,
+    214,90,139,49,198,88,107,173,181,0,0,128,3,7,0,128,0,35,232,36,163,
+    202,34,108,52,225,194,3,16,66,67,86,4,0,81,0,0,128,49,136,49,196,
+    24,114,206,65,200,32,68,206,49,8,29,132,200,57,39,165,147,146,73,9,165,
+    133,150,50,41,33,149,144,90,228,156,147,210,73,201,164,132,148,66,73,153,148,
+    144,82,105,165,0,0,176,3,7,0,176,3,11,33,66,67,86,2,0,121,0,
+    0,12,66,74,49,198,152,115,8,33,165,24,115,206,57,132,144,82,140,49,231,
+    156,82,138,49,198,156,115,78,41,197,24,99,206,57,199,24,99,204,57,231,156,
+    99,140,49,230,156,115,206,49,199,156,115,206,57,231,152,115,206,57,231,156,115,
+    206,57,231,156,115,14,66,231,156,115,206,57,7,161,0,0,160,2,7,0,128,
+    0,27,69,54,39,24,9,10,66,67,86,2,0,169,0,0,132,49,74,49,230,
+    28,132,82,26,133,24,115,206,57,8,165,52,74,49,230,156,115,16,74,169,24,
+    99,206,57,7,161,148,82,49,230,156,115,208,73,72,37,115,206,57,7,33,148,
+    146,82,230,156,115,208,65,40,37,165,206,57,8,33,132,82,74,74,157,115,16,
+    66,40,161,148,148,66,8,161,148,82,74,73,169,133,16,74,40,165,148,84,90,
+    42,165,148,146,82,74,169,181,86,74,41,41,165,148,90,106,173,0,0,240,4,
+    7,0,160,2,27,86,71,56,41,26,11,12,66,67,86,2,0,25,0,0,136,
+    49,8,25,132,16,50,8,33,132,16,66,8,33,132,144,0,0,128,1,7,0,
+    128,0,19,202,64,66,67,86,2,0,169,0,0,128,65,74,49,230,156,148,148,
+    34,165,24,115,14,66,42,45,69,74,49,230,28,132,146,82,171,24,115,14,66,
+    41,41,181,86,49,230,28,132,82,82,139,45,115,14,66,41,41,181,22,99,231,
+    28,132,82,82,106,45,198,16,66,41,41,181,22,99,173,33,132,82,82,106,45,
+    198,90,75,74,45,197,22,99,173,57,151,148,82,107,49,214,90,115,78,173,197,
+    88,99,174,57,247,156,82,139,49,214,90,115,206,189,0,0,132,6,7,0,176,
+    3,27,86,71,56,41,26,11,12,66,67,86,2,0,121,0,0,12,66,74,49,
+    198,24,99,72,41,198,24,99,140,49,164,20,99,140,49,198,152,98,140,49,198,
+    24,115,78,49,198,24,99,140,49,199,24,99,140,49,231,156,99,140,49,198,152,
+    115,206,49,198,28,115,206,57,231,24,99,140,57,231,156,115,140,49,231,156,115,
+    206,57,198,152,115,206,57,231,156,0,0,160,2,7,0,128,0,27,69,54,39,
+    24,9,10,66,67,86,2,0,225,0,0,128,49,140,57,231,24,116,18,82,105,
+    148,114,78,66,8,165,164,210,74,163,148,115,82,66,40,37,165,212,50,231,164,
+    164,148,74,75,173,197,148,57,39,37,165,82,82,106,45,198,78,74,74,45,181,
+    20,91,108,53,118,18,82,106,173,181,214,98,172,177,131,144,74,75,177,197,88,
+    99,141,29,132,146,90,107,45,198,154,107,13,165,180,20,91,140,53,214,90,107,
+    40,165,181,214,98,172,181,230,90,75,74,177,197,86,107,173,181,230,92,82,106,
+    45,198,90,107,206,181,231,212,90,108,181,214,152,107,206,57,168,214,98,172,181,
+    230,92,115,174,193,0,0,147,7,7,0,168,4,27,103,88,73,58,43,28,13,
+    14,66,67,86,2,0,185,1,0,140,82,140,57,231,28,132,16,66,8,33,132,
+    16,42,165,24,115,206,57,8,33,132,16,66,8,33,68,74,49,230,28,116,16,
+    66,8,33,132,16,66,200,24,115,206,57,8,33,132,16,66,8,33,132,144,49,
+    230,156,115,16,66,8,33,132,16,66,8,161,115,206,57,8,33,132,16,66,8,
+    33,148,18,74,231,156,115,16,66,8,33,132,16,74,40,37,148,14,58,8,33,
+    132,16,66,9,165,148,82,74,41,29,116,16,66,8,33,132,16,66,41,165,132,
+    82,66,8,33,132,16,66,8,37,148,82,74,41,165,132,16,66,8,33,132,16,
+    74,40,165,148,82,74,9,33,132,16,66,9,165,148,82,74,41,165,148,18,66,
+    8,33,132,16,66,41,165,148,82,74,41,37,132,16,66,40,165,148,82,74,41,
+    165,148,82,74,8,33,132,16,74,41,165,148,82,74,41,165,148,16,66,8,33,
+    148,82,74,41,165,148,82,74,41,33,132,16,74,41,165,148,82,74,41,165,148,
+    82,66,8,37,148,82,74,41,165,148,82,74,41,165,132,16,66,40,161,148,82,
+    74,41,165,148,82,74,9,33,132,16,74,41,165,148,82,74,41,165,148,18,66,
+    40,161,132,82,74,41,165,148,82,74,41,165,0,0,160,3,7,0,128,0,35,
+    42,45,196,78,51,174,60,2,71,20,50,76,64,1,66,67,86,2,0,81,0,
+    0,0,33,16,66,8,161,129,16,66,8,33,68,16,66,8,33,132,16,66,8,
+    33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,
+    132,16,66,8,33,132,16,58,231,156,0,192,232,11,7,192,232,9,27,52,37,
+    22,7,8,66,67,86,2,0,105,1,0,128,49,140,57,230,20,100,210,81,73,
+    41,165,134,41,8,37,132,80,74,42,169,164,20,83,195,24,132,16,66,40,37,
+    149,148,82,75,45,131,142,82,74,165,164,212,90,107,173,213,152,57,40,41,165,
+    82,82,74,169,181,218,98,237,32,164,148,82,74,173,213,150,107,173,185,118,16,
+    82,74,169,165,214,98,140,49,198,90,59,8,169,180,212,90,140,49,230,90,107,
+    239,29,132,146,82,107,45,198,88,107,205,61,231,80,74,106,45,198,88,107,175,
+    181,247,222,115,40,37,165,22,99,205,181,215,220,123,239,185,164,212,98,172,57,
+    231,156,123,238,185,231,92,82,138,177,198,152,107,206,61,231,220,115,47,173,213,
+    90,107,237,61,231,220,123,239,189,167,214,106,173,53,231,158,123,238,185,247,222,
+    91,139,181,230,222,123,239,61,247,222,123,239,45,198,90,107,205,61,247,222,123,
+    239,189,247,22,107,173,61,247,220,123,239,189,247,222,123,171,177,230,156,123,238,
+    61,247,222,123,239,189,0,128,220,8,7,0,196,5,35,9,169,179,12,43,141,
+    184,241,4,12,17,72,66,67,86,1,0,49,0,0,129,0,0,0,32,0,0,
+    0,8,0,0,0,2,8,0,128,16,64,0,0,132,16,66,0,0,0,0,0,
+    0,0,0,0,66,67,86,2,0,100,0,0,8,196,88,115,173,57,71,8,74,
+    107,177,246,92,42,165,28,181,216,115,202,16,65,78,90,206,165,100,134,32,39,
+    173,181,22,50,100,148,147,24,91,10,25,66,10,90,109,173,116,74,41,70,177,
+    213,88,58,198,152,164,212,98,75,165,115,16,0,66,67,86,2,0,100,0,0,
+    160,23,35,132,16,66,72,142,90,106,65,248,94,41,231,160,212,220,123,197,152,
+    81,16,123,239,149,98,6,57,202,193,103,138,41,229,160,212,158,58,199,148,34,
+    70,114,109,173,68,138,16,135,57,232,84,57,165,160,6,157,91,39,33,180,28,
+    0,66,67,86,4,0,81,0,0,0,66,136,49,196,24,98,140,65,200,32,68,
+    140,49,8,25,132,136,49,6,33,131,208,65,8,37,133,148,50,8,33,149,144,
+    82,196,24,131,208,65,201,32,132,148,66,73,25,148,144,82,72,165,0,0,128,
+    0,7,0,128,0,11,33,66,67,86,4,0,113,2,0,8,66,206,33,198,32,
+    84,140,65,232,32,164,210,65,72,169,98,12,66,230,156,148,204,57,40,161,148,
+    148,66,40,41,85,140,65,200,156,147,144,57,39,37,148,144,82,40,37,165,14,
+    66,74,161,148,150,66,41,169,165,148,98,76,41,181,216,65,72,41,148,146,82,
+    40,165,165,212,82,108,41,181,24,43,198,32,100,206,73,201,156,147,18,74,105,
+    41,148,146,90,230,156,148,14,66,74,29,132,82,74,74,173,149,146,90,203,156,
+    147,210,65,39,165,131,80,74,73,165,165,82,82,107,161,148,212,74,74,173,149,
+    84,90,107,173,197,152,90,139,49,148,146,82,40,165,181,146,82,139,169,165,216,
+    90,107,177,86,140,65,200,156,147,146,57,39,37,148,146,82,40,37,181,204,57,
+    41,29,132,84,58,7,165,148,84,90,43,37,165,150,57,39,165,131,80,74,7,
+    161,148,146,74,107,37,149,214,66,41,45,149,148,90,11,165,180,214,90,139,49,
+    165,214,106,40,37,181,146,82,107,37,165,214,82,107,181,182,214,98,236,32,164,
+    20,74,105,41,148,210,90,106,41,198,148,90,140,161,148,214,74,74,173,149,148,
+    90,107,173,213,218,90,139,49,148,210,82,73,165,181,146,82,107,169,181,26,91,
+    107,177,166,150,98,76,173,197,216,90,171,53,198,24,115,140,53,231,148,82,140,
+    169,165,24,83,107,49,182,216,114,140,177,214,220,65,72,41,148,146,90,40,37,
+    181,212,82,140,169,181,24,67,41,169,149,84,90,43,37,181,216,90,171,49,181,
+    22,107,40,165,181,146,82,107,37,165,214,90,107,53,182,214,106,76,41,197,152,
+    90,171,49,165,22,99,140,49,215,214,98,204,169,181,24,91,107,177,166,214,98,
+    140,177,214,28,99,172,181,0,0,128,1,7,0,128,0,19,202,64,66,67,86,
+    2,0,81,0,0,136,49,8,49,230,156,65,72,41,198,32,52,6,41,197,24,
+    132,72,41,198,156,131,16,41,197,152,115,16,50,198,156,131,80,74,198,152,115,
+    16,74,233,32,148,80,74,74,29,132,80,74,73,169,0,0,128,2,7,0,128,
+    0,27,52,37,22,7,8,66,67,86,2,0,33,1,0,12,66,74,49,230,156,
+    115,16,74,73,41,66,72,41,198,156,115,14,66,41,41,69,8,41,197,152,115,
+    206,65,40,37,165,74,41,166,24,115,14,66,41,41,181,84,41,165,24,99,206,
+    65,40,37,165,212,50,198,24,115,14,66,8,165,164,212,90,198,24,99,206,65,
+    8,161,148,148,90,235,156,115,14,58,9,165,164,210,82,108,157,115,206,65,8,
+    165,148,146,82,107,173,115,14,66,8,165,164,210,82,107,177,117,206,65,8,161,
+    148,146,82,106,173,197,16,66,41,165,164,146,82,75,177,197,24,66,41,165,148,
+    146,82,74,173,197,24,75,42,41,165,212,82,107,177,197,88,99,41,37,165,148,
+    82,107,173,197,24,99,77,41,181,212,90,107,49,198,88,99,173,41,165,212,90,
+    107,173,197,24,99,173,181,0,0,128,3,7,0,128,0,35,232,36,163,202,34,
+    108,52,225,194,3,16,66,67,86,4,0,81,0,0,128,49,136,49,196,24,114,
+    206,65,200,32,68,206,49,8,29,132,200,57,39,165,147,146,73,9,165,133,148,
+    50,41,33,149,144,90,228,156,147,210,73,201,164,132,150,66,73,153,148,144,82,
+    105,165,0,0,176,3,7,0,176,3,11,33,66,67,86,2,0,121,0,0,16,
+    66,74,49,198,24,99,72,41,165,24,99,204,49,164,148,82,140,49,198,152,82,
+    138,49,198,24,115,78,41,197,24,99,140,57,199,24,99,204,49,231,156,99,140,
+    49,198,156,115,206,49,198,28,115,206,57,231,24,99,204,57,231,156,115,204,49,
+    231,156,115,206,57,230,156,115,206,57,231,156,0,0,160,2,7,0,128,0,27,
+    69,54,39,24,9,10,66,67,86,2,0,169,0,0,132,49,74,49,230,28,132,
+    82,26,133,24,115,206,57,8,165,52,72,49,230,156,115,16,74,169,24,115,206,
+    57,8,165,148,82,49,230,156,115,16,74,41,37,115,206,57,8,33,148,146,82,
+    230,156,115,16,66,40,37,165,206,57,8,33,132,82,74,74,157,115,16,66,40,
+    161,148,148,66,8,165,148,82,82,74,169,133,16,74,41,165,148,84,90,42,165,
+    148,146,82,74,169,181,86,74,41,37,165,148,90,106,173,0,0,240,4,7,0,
+    160,2,27,86,71,56,41,26,11,12,66,67,86,2,0,25,0,0,140,49,8,
+    25,100,16,50,6,33,132,16,66,8,33,132,144,0,0,128,1,7,0,128,0,
+    19,202,64,66,67,86,2,0,169,0,0,128,65,74,49,230,160,148,148,34,165,
+    24,115,14,66,41,41,69,74,49,230,28,132,82,82,170,24,115,14,66,41,41,
+    181,86,49,230,28,132,82,82,106,173,115,14,66,41,41,181,22,99,231,28,132,
+    82,82,106,45,198,16,66,41,41,181,22,99,140,33,132,82,82,106,45,198,90,
+    75,41,41,181,22,99,141,185,150,82,82,106,45,198,90,107,77,169,181,22,99,
+    173,181,230,156,82,107,45,198,90,107,206,185,0,0,132,6,7,0,176,3,27,
+    86,71,56,41,26,11,12,66,67,86,2,0,121,0,0,144,82,140,49,198,24,
+    99,74,41,198,24,99,140,49,165,20,99,140,49,198,24,99,140,49,198,24,99,
+    76,49,198,24,99,140,49,198,24,99,140,49,198,24,99,140,49,198,24,99,140,
+    49,198,24,99,204,49,198,24,99,140,49,198,152,115,140,49,198,24,115,204,57,
+    198,24,99,140,57,231,156,0,0,160,2,7,0,128,0,27,69,54,39,24,9,
+    10,66,67,86,2,0,225,0,0,128,49,140,57,231,28,132,18,82,105,148,114,
+    14,66,8,165,164,210,74,163,148,115,80,66,40,37,165,214,50,231,164,164,84,
+    74,74,173,197,150,57,39,37,165,82,82,106,173,197,78,66,74,173,165,212,90,
+    140,53,118,16,82,106,45,181,214,98,172,177,131,80,74,75,177,197,88,99,174,
+    29,132,82,82,107,45,198,88,107,13,165,180,20,91,140,53,214,90,115,40,37,
+    181,214,98,172,181,230,156,75,74,173,197,88,107,173,185,246,92,82,106,45,198,
+    88,107,173,53,247,212,90,140,53,214,154,107,238,189,167,214,98,172,177,214,156,
+    115,207,185,0,0,147,7,7,0,168,4,27,103,88,73,58,43,28,13,14,66,
+    67,86,2,0,185,1,0,140,82,140,57,231,28,132,16,66,8,33,132,16,42,
+    165,24,115,206,57,8,33,132,16,66,8,33,84,74,49,230,156,115,16,66,8,
+    33,132,16,66,200,24,115,206,57,232,32,132,16,66,8,33,132,144,49,230,156,
+    115,16,66,8,33,132,16,66,8,161,115,206,57,8,33,132,16,66,8,161,132,
+    82,74,231,156,115,14,66,8,33,132,16,66,8,161,148,206,57,8,33,132,16,
+    66,8,37,148,80,74,41,157,115,16,66,8,33,132,16,74,9,165,148,82,66,
+    8,33,132,16,66,8,37,148,82,74,41,165,116,16,66,8,33,132,16,74,41,
+    165,148,82,74,9,33,132,16,66,8,33,148,82,74,41,165,148,18,66,8,33,
+    132,16,66,40,165,148,82,74,41,37,132,16,66,8,37,148,82,74,41,165,148,
+    82,74,8,33,132,16,66,41,165,148,82,74,41,165,148,16,66,8,165,148,82,
+    74,41,165,148,82,74,41,33,132,80,66,40,165,148,82,74,41,165,148,82,66,
+    8,37,148,80,74,41,165,148,82,74,41,165,132,16,74,40,165,148,82,74,41,
+    165,148,82,74,9,33,132,80,74,41,165,148,82,74,41,165,148,18,66,40,165,
+    148,82,74,41,165,148,82,74,41,165,0,0,160,3,7,0,128,0,35,42,45,
+    196,78,51,174,60,2,71,20,50,76,64,1,66,67,86,2,0,225,0,0,0,
+    33,148,82,74,41,165,148,82,106,36,165,148,82,74,41,165,148,82,35,37,165,
+    148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,
+    82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,
+    74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,
+    41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,
+    165,148,82,74,41,165,148,82,74,41,165,148,82,74,165,148,82,74,41,165,148,
+    82,74,41,165,148,82,74,41,165,148,82,74,41,165,0,168,203,12,7,192,232,
+    9,27,103,88,73,58,43,28,13,14,66,67,86,2,0,105,1,0,128,49,140,
+    57,230,24,116,18,74,73,169,181,134,41,8,37,132,78,74,42,173,196,22,91,
+    163,20,132,16,66,40,37,165,212,90,107,45,131,142,74,41,169,164,212,90,108,
+    49,198,152,57,40,37,165,82,82,74,45,198,24,107,237,32,164,212,82,107,177,
+    181,24,107,174,181,118,16,74,74,169,181,216,98,172,181,230,218,59,8,169,180,
+    214,90,142,49,6,155,115,174,29,132,146,82,139,45,198,88,115,173,181,231,144,
+    74,107,49,198,88,107,207,181,214,156,131,40,37,165,24,99,173,49,215,92,115,
+    207,189,164,212,90,172,185,230,90,115,240,57,7,97,90,138,173,214,88,115,206,
+    185,7,161,131,79,173,213,152,107,238,65,7,29,116,238,65,167,212,106,173,181,
+    230,220,115,16,194,7,159,91,139,181,214,92,115,238,61,248,160,131,240,173,182,
+    90,115,206,181,246,222,115,239,57,232,22,99,205,53,7,29,124,16,194,7,31,
+    132,139,177,246,156,115,207,65,232,160,131,239,193,0,128,220,8,7,0,196,5,
+    35,9,169,179,12,43,141,184,241,4,12,17,72,66,67,86,1,0,49,0,0,
+    132,49,200,32,132,144,82,74,41,165,148,82,76,49,197,24,99,140,49,198,24,
+    99,140,49,198,24,99,140,49,198,152,0,0,192,4,7,0,128,0,43,216,149,
+    89,90,181,81,220,212,73,94,244,65,224,19,58,98,51,50,228,82,42,102,114,
+    34,232,145,26,106,177,18,236,208,10,110,240,2,48,66,67,86,2,0,64,0,
+    0,144,178,80,67,72,22,64,200,49,72,174,49,140,65,42,34,82,202,49,7,
+    182,99,206,73,43,162,114,202,41,39,162,163,142,50,196,189,24,35,116,42,2,
+    66,67,86,4,0,81,0,0,128,49,200,49,196,28,114,206,73,234,36,69,206,
+    57,42,29,149,6,66,71,169,163,212,89,42,173,166,24,51,74,37,166,20,107,
+    227,160,163,212,81,203,40,165,26,75,138,29,181,20,99,169,173,0,0,128,0,
+    7,0,128,0,11,33,66,67,86,4,0,81,0,0,132,49,72,41,164,20,98,
+    140,57,167,24,68,140,41,199,24,116,134,49,6,29,115,142,65,231,156,132,82,
+    42,231,152,116,80,74,196,24,115,142,57,168,156,131,82,50,39,149,131,80,74,
+    39,157,0,0,128,0,7,0,128,0,11,33,66,67,86,4,0,113,2,0,6,
+    73,242,60,201,211,68,81,210,60,81,20,77,209,117,69,209,84,93,203,243,76,
+    211,51,77,85,245,68,83,85,77,85,149,101,83,85,93,217,242,60,211,244,76,
+    81,85,61,211,84,85,83,85,101,215,84,85,217,21,85,85,151,77,87,213,101,
+    83,85,117,219,181,101,95,119,101,89,248,69,85,149,117,83,117,109,221,84,93,
+    91,119,101,89,247,93,89,246,125,201,243,84,213,51,77,215,245,76,211,117,85,
+    215,181,109,213,117,109,219,83,77,217,53,85,215,149,77,215,149,101,215,149,101,
+    93,117,101,221,214,76,211,117,69,87,149,93,211,117,101,219,149,93,93,86,101,
+    215,214,77,215,245,109,213,117,125,93,149,93,225,151,101,93,23,102,93,119,134,
+    211,117,109,95,117,93,93,87,101,89,55,102,91,214,117,89,183,125,95,242,60,
+    85,245,76,211,117,61,211,116,93,213,117,109,91,117,93,91,215,76,83,118,77,
+    215,181,101,209,116,93,89,149,101,93,87,93,89,214,61,211,116,101,211,117,101,
+    217,116,85,89,86,101,87,215,93,217,213,101,211,117,125,91,117,93,95,55,93,
+    215,183,109,221,54,126,89,182,117,223,116,93,219,87,101,217,247,85,217,181,125,
+    89,215,141,99,214,101,223,246,84,213,247,77,89,22,126,211,117,125,221,246,117,
+    103,152,109,91,24,70,215,245,125,85,182,125,97,149,101,223,215,117,229,104,235,
+    186,113,140,174,43,252,170,236,10,191,234,202,186,176,251,58,229,214,109,229,120,
+    109,155,47,219,182,114,204,186,47,252,186,46,28,109,223,87,186,182,237,27,179,
+    46,11,199,172,219,194,177,27,183,113,252,194,79,248,84,85,215,77,215,245,125,
+    83,150,125,95,214,109,97,184,117,97,56,70,215,245,117,85,150,125,95,117,101,
+    97,184,109,93,24,110,221,103,140,174,235,11,171,44,251,194,106,203,198,112,251,
+    182,48,236,194,112,28,175,109,243,101,93,87,186,178,142,45,252,74,95,55,142,
+    174,109,11,101,219,22,202,186,205,216,125,159,177,27,59,97,0,0,192,128,3,
+    0,64,128,9,101,32,66,67,86,4,0,113,2,0,22,73,18,69,201,178,76,
+    81,178,44,209,52,77,211,85,69,211,116,93,73,211,76,83,211,60,83,213,52,
+    207,84,77,83,85,101,211,84,85,217,210,52,211,212,60,77,53,53,79,51,77,
+    83,21,101,213,84,77,89,53,77,211,150,77,85,181,101,211,84,101,219,117,101,
+    93,119,93,89,182,77,211,116,101,83,53,101,217,84,85,89,118,101,215,150,93,
+    89,182,101,73,211,76,83,243,60,213,212,60,207,52,85,85,149,101,83,85,93,
+    87,243,60,85,213,60,209,116,61,81,84,85,213,116,85,91,85,93,89,182,60,
+    207,84,53,81,115,77,79,52,85,215,116,77,91,85,93,85,150,77,85,181,109,
+    211,84,101,91,117,93,93,118,85,219,245,93,217,214,125,211,84,101,219,84,77,
+    219,85,93,87,182,93,89,213,93,219,182,117,93,210,52,211,212,60,207,52,53,
+    207,51,85,83,53,93,215,84,85,87,182,60,79,85,61,81,116,85,77,19,77,
+    87,85,85,87,86,77,87,213,53,207,83,85,79,20,85,85,19,61,215,84,93,
+    85,118,85,215,212,85,83,53,109,87,117,85,91,54,77,85,182,101,89,22,118,
+    87,181,93,221,52,85,217,86,93,215,182,77,213,180,101,217,150,125,225,181,85,
+    223,21,77,211,150,77,213,180,109,83,85,101,89,182,109,95,119,101,217,182,69,
+    213,180,101,211,116,101,91,117,85,91,150,109,219,214,101,219,214,117,209,84,101,
+    219,84,77,93,86,85,215,213,101,219,213,109,89,182,109,221,149,93,223,86,85,
+    87,183,101,93,246,109,217,213,93,97,247,117,223,119,93,89,214,85,89,213,109,
+    89,182,117,97,182,93,178,173,219,58,209,52,101,217,84,85,89,54,85,85,150,
+    93,217,181,109,217,182,117,97,52,77,89,86,93,85,119,77,83,149,125,217,150,
+    117,91,150,109,221,55,77,85,182,85,213,149,109,211,85,109,91,150,101,91,151,
+    117,217,215,93,217,213,101,87,151,117,93,85,101,91,215,117,93,23,102,215,150,
+    133,215,181,109,93,150,109,219,87,101,213,215,109,223,23,218,178,234,187,2,0,
+    0,6,28,0,0,2,76,40,3,1,66,67,86,2,0,81,0,0,128,49,140,
+    57,7,161,81,200,49,231,36,52,74,57,231,156,148,204,49,8,33,164,146,57,
+    7,33,132,146,58,231,32,148,146,82,231,28,132,82,82,10,165,164,146,82,107,
+    161,148,146,82,106,173,0,0,128,2,7,0,128,0,27,52,37,22,7,8,66,
+    67,86,2,0,169,0,0,6,199,177,44,207,51,77,85,213,117,71,146,60,79,
+    20,85,213,117,125,223,145,44,207,19,69,85,117,93,219,214,60,79,20,77,83,
+    117,101,217,23,54,207,19,69,211,116,93,87,214,117,209,52,77,83,85,93,87,
+    150,117,95,20,69,211,84,85,217,149,101,97,56,85,85,117,93,87,150,109,157,
+    113,170,170,235,186,178,45,219,182,240,171,174,43,203,182,109,219,186,47,252,170,
+    235,202,178,109,219,182,174,11,195,173,235,190,239,11,195,79,104,220,186,238,251,
+    116,227,232,35,0,0,60,193,1,0,168,192,134,213,17,78,138,198,2,3,66,
+    67,86,2,0,25,0,0,132,49,8,25,132,16,50,8,41,132,20,82,10,41,
+    165,148,0,0,128,1,7,0,128,0,19,202,64,66,67,86,4,0,113,2,0,
+    0,34,148,82,74,41,117,148,82,74,41,165,148,82,74,169,164,148,82,74,41,
+    165,148,82,74,41,165,148,82,74,41,149,148,82,74,41,165,148,82,74,41,165,
+    148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,
+    82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,58,74,41,165,148,82,
+    74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,
+    41,165,148,82,42,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,
+    165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,
+    148,82,74,41,165,148,82,74,41,101,148,82,74,41,165,148,82,74,41,165,148,
+    82,74,41,165,146,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,
+    74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,
+    41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,
+    165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,
+    148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,
+    82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,
+    74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,
+    41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,
+    165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,
+    148,82,74,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,
+    74,41,165,148,82,74,41,165,148,82,74,41,165,0,0,169,8,7,0,169,7,
+    19,202,64,66,67,86,2,0,169,0,0,128,49,74,41,5,29,116,206,33,198,
+    24,115,206,73,39,29,68,140,57,198,156,148,84,90,202,156,131,16,74,74,41,
+    165,148,57,231,32,132,82,74,74,45,115,14,66,73,169,165,150,82,230,28,132,
+    82,82,74,173,165,78,74,41,41,213,212,90,139,161,148,82,90,170,169,166,22,
+    75,74,41,197,84,107,140,177,166,148,90,106,173,197,90,99,109,169,181,214,98,
+    140,53,214,154,90,171,45,198,22,99,173,181,0,0,156,6,7,0,208,3,27,
+    86,71,56,41,26,11,12,66,67,86,2,0,169,0,0,136,49,74,49,230,28,
+    132,208,25,132,148,114,14,58,8,33,52,8,49,229,156,115,208,65,167,24,99,
+    206,57,8,33,132,80,49,198,152,115,16,66,8,33,115,206,57,232,32,148,16,
+    74,230,156,115,16,66,8,161,148,14,66,8,33,132,80,74,40,29,132,16,66,
+    8,33,132,82,66,8,37,132,18,66,41,165,132,16,66,8,161,132,82,74,9,
+    33,148,16,74,9,165,148,18,66,40,33,132,82,74,41,165,0,0,192,2,7,
+    0,128,0,27,86,71,56,41,26,11,12,66,67,86,2,0,64,0,0,172,213,
+    86,107,173,173,82,14,66,170,173,17,74,49,170,177,66,204,65,170,177,67,78,
+    57,171,45,99,206,57,169,173,34,198,24,166,41,51,74,41,167,1,66,67,86,
+    8,0,161,25,0,6,199,1,36,77,3,36,77,3,0,0,0,0,0,0,0,
+    201,243,0,79,52,1,77,52,1,0,0,0,0,0,0,64,242,60,64,19,69,
+    64,19,69,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,36,207,3,60,211,4,60,211,4,0,0,0,0,
+    0,0,0,205,52,1,81,116,1,211,85,1,0,0,0,0,0,0,64,51,77,
+    64,116,77,192,84,93,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,36,207,3,60,211,4,60,211,4,0,
+    0,0,0,0,0,0,205,52,1,211,85,1,209,116,1,0,0,0,0,0,0,
+    64,51,77,192,84,93,64,116,69,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,14,0,
+    0,1,22,66,66,67,86,4,0,113,2,0,6,199,177,44,0,0,112,44,75,
+    179,0,0,192,177,44,203,2,0,0,203,178,68,17,0,0,44,203,18,69,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,1,0,0,3,14,0,0,1,38,148,129,66,67,86,2,0,81,0,0,6,
+    197,208,60,128,101,1,44,11,160,105,0,77,3,120,30,192,243,0,162,8,0,
+    4,0,0,20,56,0,0,4,216,160,41,177,56,64,66,67,86,2,0,81,0,
+    0,6,69,177,44,203,242,60,104,154,166,121,30,52,77,211,60,15,154,230,121,
+    162,8,77,243,60,81,132,39,122,158,105,194,243,60,207,52,97,154,162,104,154,
+    64,20,77,83,0,0,64,129,3,0,64,128,13,154,18,139,3,4,66,67,86,
+    2,0,33,1,0,6,197,177,44,77,243,60,207,19,69,211,84,85,104,154,231,
+    137,162,40,154,166,169,170,42,44,203,243,68,81,20,77,83,85,85,21,154,230,
+    121,162,40,138,166,169,170,174,11,77,243,60,81,20,69,211,84,85,215,133,231,
+    137,162,105,154,166,170,186,174,235,194,243,68,209,52,77,83,85,93,215,149,33,
+    138,162,104,154,166,169,170,174,43,203,192,52,77,211,52,85,213,117,101,25,136,
+    162,105,170,170,235,202,178,44,3,81,52,77,85,117,93,89,150,109,96,154,166,
+    170,170,174,43,203,178,13,48,77,85,117,93,89,182,109,128,170,186,174,44,203,
+    178,109,3,84,213,117,93,89,182,117,27,224,186,174,43,203,178,109,235,0,92,
+    87,150,109,217,182,5,0,0,28,56,0,0,4,24,65,39,25,85,22,97,163,
+    9,23,30,128,66,67,86,4,0,81,0,0,128,49,74,41,166,148,97,140,74,
+    73,169,52,140,73,41,169,148,74,74,74,41,165,82,65,72,173,165,16,42,40,
+    169,181,20,74,70,41,165,212,98,171,160,164,82,90,140,149,132,84,74,106,177,
+    0,0,176,3,7,0,176,3,11,33,66,67,86,2,0,121,0,0,0,49,74,
+    49,230,156,115,82,74,198,156,115,16,66,41,165,98,206,57,7,157,148,146,49,
+    231,32,132,80,74,201,152,115,16,58,40,165,116,14,66,8,33,164,148,58,7,
+    33,132,80,74,74,33,132,16,66,40,41,165,146,66,8,161,132,148,82,73,165,
+    132,80,74,74,41,165,16,66,40,165,0,0,160,2,7,0,128,0,27,69,54,
+    39,24,9,10,66,67,86,2,0,169,0,0,6,199,209,52,77,211,44,207,51,
+    77,75,178,60,207,243,60,207,19,77,83,179,44,207,243,60,207,243,60,211,228,
+    121,158,39,122,162,40,154,166,73,244,60,79,20,61,79,20,77,147,171,122,158,
+    40,138,162,105,170,38,87,246,60,209,20,69,85,85,93,120,158,231,153,162,43,
+    187,54,60,207,19,77,211,117,101,27,178,44,138,170,138,13,182,109,154,174,234,
+    218,182,13,84,85,150,109,217,182,129,43,203,174,108,219,182,0,0,240,4,7,
+    0,160,2,27,86,71,56,41,26,11,12,66,67,86,2,0,25,0,0,128,33,
+    8,49,198,148,98,140,33,196,24,83,138,49,166,148,0,0,128,1,7,0,128,
+    0,19,202,64,66,67,86,4,0,81,0,0,128,115,206,57,231,156,115,206,57,
+    231,156,115,206,57,231,156,115,206,57,231,28,99,140,49,198,24,99,140,49,198,
+    24,99,140,49,198,24,99,140,49,198,24,99,140,49,198,24,99,140,49,198,152,
+    0,128,157,8,7,128,157,8,11,33,66,67,86,2,0,225,0,0,0,66,8,
+    65,74,165,148,82,74,201,148,82,74,74,41,165,148,82,74,166,148,82,18,74,
+    41,165,148,82,74,198,28,148,82,74,41,165,148,82,58,38,165,132,82,74,41,
+    165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,
+    148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,
+    82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,
+    74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,
+    41,165,148,82,74,41,165,148,82,74,41,165,0,0,147,7,7,0,168,4,27,
+    103,88,73,58,43,28,13,14,66,67,86,2,0,185,1,0,0,66,204,57,6,
+    33,180,150,90,43,37,181,214,82,107,29,116,12,74,73,169,164,86,90,105,173,
+    165,150,66,231,160,132,14,74,107,41,181,84,82,75,173,117,16,66,73,45,181,
+    148,82,106,45,165,214,82,10,161,131,144,66,40,33,165,148,90,74,165,181,22,
+    90,42,41,165,212,90,75,41,181,210,90,43,37,148,80,74,8,161,148,86,82,
+    10,41,149,148,82,41,37,132,82,66,40,41,149,84,82,73,169,164,148,74,40,
+    37,148,16,82,8,169,148,148,74,73,37,117,144,82,9,37,165,146,82,41,37,
+    149,80,74,10,165,132,84,74,41,169,164,20,82,73,165,164,84,74,9,165,164,
+    148,66,41,165,148,84,74,9,165,164,82,74,41,161,164,82,74,73,41,149,82,
+    74,73,37,149,84,74,9,41,149,82,82,42,165,148,82,74,73,41,148,82,82,
+    73,165,148,20,74,42,169,148,80,74,73,37,149,82,74,73,169,164,84,74,74,
+    37,132,82,74,41,33,133,82,74,74,165,148,146,82,42,33,148,146,74,41,165,
+    164,148,74,41,41,165,80,74,41,161,132,146,74,42,37,165,146,82,74,169,164,
+    82,74,72,169,164,148,82,74,41,165,146,74,41,37,149,146,66,41,165,0,0,
+    160,3,7,0,128,0,35,42,45,196,78,51,174,60,2,71,20,50,76,64,1,
+    66,67,86,2,0,100,0,0,136,33,13,50,71,161,53,128,44,198,156,164,88,
+    140,49,198,24,99,140,167,196,131,144,90,45,162,18,145,57,72,173,104,74,60,
+    198,24,164,224,57,17,153,82,142,130,41,197,133,142,65,43,50,23,29,83,73,
+    185,216,98,140,49,190,23,35,0,66,67,86,2,0,100,0,0,4,50,77,50,
+    39,41,53,194,36,167,24,148,210,156,115,74,41,165,148,134,200,146,12,82,12,
+    170,35,147,49,39,41,103,136,52,134,20,164,158,41,242,152,82,12,98,8,73,
+    133,78,49,135,173,38,31,75,232,32,214,160,140,17,46,165,24,0,66,67,86,
+    8,0,161,25,0,6,73,2,36,77,3,36,77,3,0,0,0,0,0,0,0,
+    201,211,0,77,20,1,205,19,1,0,0,0,0,0,0,64,210,60,64,19,61,
+    64,19,69,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,36,79,3,60,81,4,52,81,4,0,0,0,0,
+    0,0,0,77,20,1,81,84,1,81,53,1,0,0,0,0,0,0,64,19,69,
+    192,83,69,64,52,85,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,36,205,3,52,81,4,60,81,4,0,
+    0,0,0,0,0,0,77,20,1,81,53,1,79,84,1,0,0,0,0,0,0,
+    64,19,69,64,52,85,64,84,69,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,14,0,
+    0,1,22,66,66,67,86,4,0,113,2,0,6,199,177,44,0,0,112,36,73,
+    211,0,0,192,145,36,77,3,0,0,77,211,68,17,0,0,44,77,19,69,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,1,0,0,3,14,0,0,1,38,148,129,66,67,86,2,0,81,0,0,6,
+    67,209,52,128,101,1,44,11,160,105,0,77,3,120,30,192,19,1,166,9,0,
+    4,0,0,20,56,0,0,4,216,160,41,177,56,64,66,67,86,2,0,81,0,
+    0,6,69,145,36,203,242,60,104,154,166,137,34,52,77,211,68,17,158,231,121,
+    162,8,207,243,60,211,132,40,122,158,105,66,20,61,207,52,97,154,162,104,154,
+    64,20,77,83,0,0,64,129,3,0,64,128,13,154,18,139,3,4,66,67,86,
+    2,0,33,1,0,6,69,177,44,207,19,69,81,52,77,85,117,93,104,154,231,
+    137,162,40,154,166,170,186,46,52,205,243,68,81,20,77,83,85,93,23,158,231,
+    137,166,104,154,166,169,170,174,11,207,19,69,211,52,77,85,85,93,215,133,231,
+    137,162,105,154,166,170,186,174,235,194,243,68,209,52,77,83,85,93,87,150,33,
+    138,162,104,154,166,169,170,174,43,203,64,20,77,211,52,85,213,117,101,25,136,
+    162,105,170,170,235,186,174,44,3,81,52,77,85,117,93,215,149,101,96,154,170,
+    169,170,174,43,203,178,12,48,77,85,117,93,89,150,101,128,170,186,174,235,202,
+    178,109,3,84,213,117,93,87,150,109,27,224,186,174,43,203,178,108,219,0,92,
+    87,150,101,217,182,5,0,0,28,56,0,0,4,24,65,39,25,85,22,97,163,
+    9,23,30,128,66,67,86,4,0,81,0,0,128,49,74,41,166,148,97,76,66,
+    41,37,52,140,73,41,169,148,74,74,74,41,149,82,73,72,41,165,82,42,41,
+    41,165,84,74,70,41,165,212,90,170,164,164,82,82,74,149,148,146,74,74,169,
+    0,0,176,3,7,0,176,3,11,33,66,67,86,2,0,121,0,0,4,33,72,
+    49,198,152,115,82,74,165,24,115,206,57,41,165,82,140,57,231,156,148,146,49,
+    198,156,115,78,74,201,24,99,206,57,39,165,100,204,57,231,156,147,82,50,230,
+    156,115,206,73,41,157,115,206,57,8,165,148,82,58,231,28,132,82,74,41,33,
+    116,14,66,41,165,148,206,57,7,161,0,0,160,2,7,0,128,0,27,69,54,
+    39,24,9,10,66,67,86,2,0,169,0,0,6,199,177,44,77,211,52,207,19,
+    69,75,146,52,207,19,61,79,20,77,213,146,36,207,19,69,207,19,77,83,229,
+    121,158,40,138,162,104,154,170,74,20,69,79,20,69,209,52,85,149,44,139,162,
+    105,154,166,170,186,46,91,22,69,211,52,77,85,117,93,152,166,40,170,170,235,
+    202,46,76,83,20,77,211,117,101,25,178,173,154,170,234,186,178,13,219,54,77,
+    85,117,93,89,6,174,235,186,178,108,235,192,117,93,87,150,109,93,0,0,120,
+    130,3,0,80,129,13,171,35,156,20,141,5,6,66,67,86,2,0,25,0,0,
+    4,33,8,41,165,16,82,74,33,164,148,66,72,41,133,144,0,0,128,1,7,
+    0,128,0,19,202,64,66,67,86,2,0,169,0,0,0,132,16,66,8,33,132,
+    16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,
+    66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,
+    8,161,115,206,57,231,156,115,206,57,231,156,115,206,57,231,156,115,206,57,231,
+    156,115,206,57,231,156,115,206,57,231,156,115,206,57,231,156,115,206,57,231,156,
+    115,206,57,231,156,115,206,57,231,156,115,206,57,231,156,0,64,236,10,7,128,
+    157,8,27,86,71,56,41,26,11,12,66,67,86,2,0,225,0,0,128,49,198,
+    56,103,177,214,90,107,173,148,82,74,66,173,181,214,90,107,166,144,82,18,90,
+    140,49,198,24,99,198,32,164,212,98,140,49,198,24,51,230,28,181,24,99,140,
+    49,198,216,90,41,177,197,24,99,140,49,198,214,74,137,49,198,24,99,140,49,
+    198,24,91,108,49,198,24,99,140,49,198,216,98,140,49,198,24,99,140,49,198,
+    24,99,140,49,198,24,99,140,49,198,216,98,140,49,198,24,99,140,49,198,24,
+    99,140,49,198,24,99,140,49,198,24,99,140,49,198,24,99,140,177,197,24,99,
+    140,49,198,24,99,140,49,198,24,99,140,177,0,0,147,7,7,0,168,4,27,
+    103,88,73,58,43,28,13,14,66,67,86,2,0,185,1,0,128,49,74,49,230,
+    152,115,16,66,40,165,132,82,82,107,157,115,14,66,8,165,148,82,82,42,45,
+    165,152,50,230,156,115,16,66,41,165,132,82,82,106,41,117,206,57,8,165,148,
+    146,82,74,41,165,150,90,235,28,132,16,66,41,165,148,146,82,74,41,181,20,
+    66,8,165,148,146,74,74,41,165,212,90,107,41,132,16,74,41,37,165,148,82,
+    74,41,181,214,98,40,37,164,82,74,73,41,165,84,82,75,173,165,150,74,40,
+    37,149,148,82,74,41,165,212,90,106,173,149,82,82,73,41,165,148,82,74,41,
+    181,216,90,10,165,164,84,82,74,45,165,148,82,107,49,182,88,74,43,41,165,
+    148,82,74,169,181,20,91,107,45,182,148,82,74,169,165,150,82,74,173,197,150,
+    90,75,41,165,212,82,74,169,165,212,82,139,177,181,214,82,74,41,181,148,90,
+    106,41,165,20,91,107,45,166,148,90,75,41,181,212,90,75,45,182,148,90,75,
+    45,165,212,90,106,41,165,214,90,139,45,182,214,90,74,45,165,148,82,106,173,
+    197,150,98,108,45,181,146,82,74,45,181,150,90,139,173,197,214,90,107,169,181,
+    150,90,74,169,197,22,99,140,177,197,216,90,76,41,165,212,82,106,169,0,0,
+    160,3,7,0,128,0,35,42,45,196,78,51,174,60,2,71,20,50,76,64,1,
+    66,67,86,2,0,100,0,0,144,2,207,66,41,45,70,2,28,136,152,163,216,
+    123,239,189,247,222,123,101,60,146,136,73,237,49,244,212,49,7,177,103,198,35,
+    102,148,163,216,41,207,28,66,12,98,232,60,116,74,49,136,41,245,82,50,198,
+    32,198,216,99,12,33,148,24,0,66,67,86,2,0,100,0,0,12,131,16,58,
+    40,177,71,6,41,198,28,180,94,33,132,24,131,210,114,166,144,65,202,65,137,
+    29,99,8,33,6,165,101,140,41,132,20,147,214,57,199,24,66,10,82,7,161,
+    115,74,33,71,37,181,150,66,232,160,197,154,115,109,45,165,24,0,66,67,86,
+    4,0,81,0,0,6,69,1,28,73,2,28,73,2,0,0,0,0,0,0,0,
+    1,0,0,1,14,0,0,1,22,66,66,67,86,4,0,113,2,0,14,199,209,
+    52,120,30,60,15,158,7,207,115,28,199,211,224,121,240,60,136,34,68,209,113,
+    28,205,131,231,193,243,32,138,16,69,205,243,76,17,174,10,213,133,45,195,182,
+    53,207,19,77,168,46,84,21,182,13,219,6,0,0,0,0,0,0,0,0,128,
+    231,121,170,10,87,133,235,66,118,33,203,158,231,169,42,84,21,174,11,89,134,
+    44,3,0,0,0,0,0,0,0,0,192,19,61,87,133,235,194,85,33,203,144,
+    101,207,243,84,23,170,11,213,133,108,67,150,1,0,0,0,0,0,0,0,0,
+    224,137,162,109,67,150,33,203,144,93,200,178,39,138,182,13,89,134,44,195,149,
+    33,203,0,0,0,0,0,0,0,0,0,240,68,209,182,33,203,144,101,200,50,
+    100,215,19,69,219,134,44,67,150,33,203,112,93,1,0,0,3,14,0,0,1,
+    38,148,129,66,67,86,2,0,81,0,0,6,69,145,36,77,243,60,88,150,231,
+    137,34,44,203,243,68,17,154,230,137,166,9,77,19,69,211,132,231,137,162,170,
+    66,211,68,81,85,1,0,16,0,0,80,224,0,0,16,96,131,166,196,226,0,
+    1,66,67,86,2,0,33,1,0,14,69,145,36,203,178,44,77,243,60,207,19,
+    69,88,150,166,121,158,231,137,162,105,170,38,44,75,211,60,207,243,68,209,52,
+    77,19,150,229,121,162,40,138,166,169,170,170,10,205,242,60,81,20,69,211,84,
+    85,85,133,166,121,158,40,154,166,170,170,170,235,66,211,60,79,20,77,83,85,
+    85,213,117,161,121,158,39,138,166,169,170,174,43,203,192,243,68,209,52,85,213,
+    117,101,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,
+    0,192,129,3,0,64,128,17,116,146,81,101,17,54,154,112,225,1,8,66,67,
+    86,4,0,81,0,0,128,49,136,49,197,152,81,74,82,41,37,53,74,73,73,
+    37,149,72,74,104,169,180,150,73,105,173,181,24,51,42,169,181,22,99,69,165,
+    180,150,90,203,168,180,24,91,107,153,164,22,99,107,173,0,0,176,3,7,0,
+    176,3,11,33,66,67,86,2,0,121,0,0,4,33,74,41,197,24,99,84,74,
+    165,24,115,206,57,41,165,82,140,57,231,28,165,148,49,231,156,131,144,82,170,
+    152,115,206,65,72,41,101,204,57,231,156,163,148,50,230,156,115,16,82,74,157,
+    115,206,57,231,40,165,148,58,231,156,115,150,82,74,157,115,206,57,75,41,165,
+    140,57,231,156,0,0,160,2,7,0,128,0,27,69,54,39,24,9,10,66,67,
+    86,2,0,169,0,0,6,199,177,44,79,243,60,81,52,77,73,146,52,77,20,
+    69,81,85,93,215,146,36,77,19,69,83,84,85,215,165,105,154,38,138,166,169,
+    170,174,75,211,52,77,20,77,83,85,93,151,170,122,158,105,170,170,235,202,50,
+    215,21,69,211,84,85,215,149,101,0,0,0,0,0,0,0,0,0,64,0,0,
+    120,130,3,0,80,129,13,171,35,156,20,141,5,6,66,67,86,2,0,25,0,
+    0,4,33,8,41,165,16,82,74,33,164,148,66,72,41,133,144,0,0,128,1,
+    7,0,128,0,19,202,64,66,67,86,2,0,169,0,0,128,49,140,57,231,156,
+    132,82,34,132,24,131,80,74,42,45,85,8,49,6,161,148,148,90,107,26,99,
+    12,66,41,41,181,214,52,198,24,132,84,90,106,173,169,212,57,41,41,181,22,
+    99,115,173,115,16,82,106,45,198,230,164,41,165,164,212,90,140,81,74,83,74,
+    73,169,181,24,163,148,182,166,212,90,140,177,70,41,125,78,169,165,24,107,141,
+    82,74,41,99,107,49,214,26,165,148,82,198,214,98,172,181,0,0,132,6,7,
+    0,176,3,27,86,71,56,41,26,11,12,66,67,86,2,0,121,0,0,132,49,
+    74,49,198,24,99,16,66,197,24,99,204,57,8,161,82,140,49,230,28,132,144,
+    49,198,156,115,14,66,200,24,99,206,57,7,33,100,140,49,231,156,131,16,50,
+    198,24,99,206,65,8,25,115,142,49,231,32,132,16,58,199,152,115,16,66,8,
+    157,99,204,57,8,33,132,140,49,230,156,0,0,160,2,7,0,128,0,27,69,
+    54,39,24,9,10,66,67,86,2,0,225,0,0,128,49,74,49,198,152,115,16,
+    74,169,148,114,14,66,231,32,148,146,82,133,144,99,16,58,7,161,148,148,154,
+    231,156,131,16,66,41,169,180,212,60,231,28,132,16,74,73,169,181,230,90,8,
+    165,148,146,82,107,177,53,25,67,40,165,148,148,90,139,177,57,39,66,8,165,
+    164,212,90,108,205,57,17,66,39,165,165,214,98,108,206,201,88,74,74,173,197,
+    24,99,115,78,198,82,82,105,41,198,90,155,115,206,169,148,82,107,49,214,218,
+    156,115,78,149,148,98,138,177,214,230,164,148,182,166,22,99,140,181,70,41,165,
+    212,185,165,216,106,204,181,0,0,147,7,7,0,168,4,27,103,88,73,58,43,
+    28,13,14,66,67,86,2,0,185,1,0,132,49,74,49,230,156,115,206,57,231,
+    156,115,206,81,74,25,115,206,57,8,33,132,16,66,8,33,148,84,50,230,156,
+    115,16,66,8,33,132,16,66,72,41,117,206,57,8,33,132,16,66,8,33,132,
+    144,82,234,156,115,16,66,8,33,132,18,74,41,37,165,212,57,8,33,132,16,
+    66,41,165,148,82,74,74,169,115,16,66,8,33,148,82,74,41,165,148,148,82,
+    8,33,132,16,66,41,165,148,82,74,41,41,165,148,66,8,33,132,82,74,41,
+    165,148,82,82,74,41,133,16,66,41,165,148,82,74,41,165,164,148,82,10,33,
+    132,82,74,41,165,148,82,74,73,41,165,84,66,41,165,148,82,74,41,165,148,
+    146,82,74,41,165,82,74,41,165,148,82,74,41,37,165,148,82,74,165,148,82,
+    74,41,165,148,82,74,74,41,165,148,74,41,165,148,82,74,41,165,148,148,82,
+    74,41,149,82,74,41,165,148,82,74,41,41,165,148,82,74,169,148,82,74,41,
+    165,148,82,82,74,41,165,148,82,41,165,148,82,74,41,165,164,148,82,74,41,
+    165,82,74,41,165,148,82,74,73,41,165,148,82,74,165,148,82,74,41,165,148,
+    146,82,74,41,165,148,82,42,165,148,82,74,41,165,0,0,160,3,7,0,128,
+    0,35,42,45,196,78,51,174,60,2,71,20,50,76,64,1,66,67,86,2,0,
+    33,1,0,128,33,210,73,41,165,148,82,74,41,165,146,82,74,41,165,148,82,
+    74,41,165,84,18,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,
+    41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,
+    165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,
+    148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,
+    82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,
+    74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,
+    41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,
+    165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,0,192,232,12,7,
+    192,232,9,35,232,36,163,202,34,108,52,225,194,3,16,66,67,86,2,0,105,
+    1,0,128,49,140,49,198,152,115,18,82,137,169,198,74,41,231,156,115,12,58,
+    10,49,213,86,99,164,148,115,206,57,7,33,165,152,106,204,57,120,206,57,8,
+    161,163,208,74,76,181,213,24,60,231,28,132,16,74,73,41,198,88,123,14,174,
+    117,14,66,41,41,181,20,91,108,53,246,214,58,7,161,148,148,90,139,177,214,
+    156,131,16,34,132,144,82,107,45,198,216,107,173,65,8,209,65,71,165,181,24,
+    107,205,185,247,32,132,107,165,164,214,98,172,49,231,218,115,16,194,181,210,89,
+    136,173,214,92,115,239,61,8,33,132,74,173,213,90,123,238,185,231,32,132,16,
+    66,133,86,98,202,181,247,224,123,14,66,8,161,115,107,181,230,222,115,239,65,
+    8,33,132,176,181,149,154,114,11,62,247,224,131,16,66,8,33,99,173,181,7,
+    225,131,16,66,8,33,132,144,33,182,28,123,15,66,8,33,132,16,66,232,96,
+    107,238,61,248,224,131,16,66,8,33,132,176,49,247,30,124,16,194,0,128,220,
+    8,7,0,196,5,35,9,169,179,12,43,141,184,241,4,12,17,72,66,67,86,
+    1,0,49,0,0,129,0,0,0,0,0,0,0,0,32,0,0,0,8,0,0,
+    0,64,0,0,0,0,64,8,0,0,0,0,0,0,0,0,66,67,86,2,0,
+    100,0,0,152,180,212,98,238,69,151,206,57,40,45,214,96,50,198,152,147,150,
+    139,201,24,66,202,73,204,37,83,200,24,5,45,167,140,33,67,12,163,216,66,
+    199,144,49,72,98,74,41,100,8,33,104,177,197,86,58,199,32,214,90,107,76,
+    169,148,24,0,66,67,86,8,0,161,25,0,6,201,1,36,77,3,36,77,3,
+    0,0,0,0,0,0,0,201,243,0,205,19,1,205,19,1,0,0,0,0,0,
+    0,64,242,60,64,19,69,64,19,61,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,207,3,60,211,4,
+    60,81,4,0,0,0,0,0,0,0,205,20,1,79,84,1,81,85,1,0,0,
+    0,0,0,0,64,19,77,64,84,77,64,84,85,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,207,3,
+    60,81,4,60,209,4,0,0,0,0,0,0,0,77,20,1,81,85,1,209,84,
+    1,0,0,0,0,0,0,64,19,77,64,84,85,192,83,69,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,1,0,0,1,14,0,0,1,22,66,66,67,86,4,0,113,2,0,6,199,
+    177,44,0,0,112,36,75,211,0,0,192,145,36,77,3,0,0,75,211,60,15,
+    0,0,44,77,243,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,1,0,0,3,14,0,0,1,38,148,129,66,67,
+    86,2,0,81,0,0,6,67,209,52,128,101,1,44,11,160,105,0,77,3,120,
+    30,64,244,0,166,9,0,4,0,0,20,56,0,0,4,216,160,41,177,56,64,
+    66,67,86,2,0,81,0,0,6,69,145,36,205,242,60,104,154,166,121,30,52,
+    77,211,60,17,158,231,121,162,8,207,243,60,81,132,40,122,158,105,66,20,61,
+    207,52,97,154,162,104,154,64,20,77,83,0,0,64,129,3,0,64,128,13,154,
+    18,139,3,4,66,67,86,2,0,33,1,0,6,69,177,44,207,19,69,207,51,
+    69,211,84,85,104,154,231,137,162,40,154,166,170,170,46,52,205,243,68,81,20,
+    77,83,85,93,21,158,39,138,166,41,138,166,169,170,174,11,207,19,69,211,20,
+    69,213,84,85,215,133,40,138,162,105,154,166,170,170,174,235,66,20,69,209,52,
+    77,83,85,93,87,150,97,154,166,169,170,166,169,170,174,43,203,192,20,77,213,
+    52,85,213,117,101,25,136,162,41,154,170,235,202,178,45,3,81,20,77,211,84,
+    85,217,149,101,96,154,166,169,170,174,43,203,182,13,48,77,85,117,93,89,150,
+    109,128,170,170,170,235,202,182,109,3,84,85,85,93,87,150,109,25,160,170,174,
+    43,203,182,109,219,0,92,215,117,101,217,182,5,0,0,28,56,0,0,4,24,
+    65,39,25,85,22,97,163,9,23,30,128,66,67,86,4,0,81,0,0,128,49,
+    76,41,166,148,97,140,66,105,161,52,140,73,41,41,132,138,74,74,45,165,84,
+    73,73,169,165,82,42,40,41,165,84,74,38,169,165,212,82,171,32,148,16,82,
+    41,21,132,82,74,42,165,0,0,176,3,7,0,176,3,11,33,66,67,86,2,
+    0,121,0,0,0,33,74,57,7,33,132,82,74,198,156,131,16,66,41,33,99,
+    206,65,8,161,148,210,57,8,33,132,80,74,233,28,132,16,58,40,165,116,14,
+    66,40,165,148,82,66,8,33,132,82,82,73,33,132,80,74,41,41,165,82,66,
+    40,165,132,84,74,41,165,132,80,74,74,165,148,16,66,41,165,0,0,160,2,
+    7,0,128,0,27,69,54,39,24,9,10,66,67,86,2,0,169,0,0,6,199,
+    209,44,77,211,52,207,19,69,205,178,52,205,243,52,205,19,77,83,179,44,77,
+    243,52,77,19,69,211,229,121,158,231,137,158,39,138,166,201,243,60,207,19,61,
+    81,20,85,19,89,244,68,81,20,77,83,85,201,68,81,20,69,81,53,85,21,
+    158,104,138,166,41,171,174,11,79,20,69,211,148,93,87,134,203,52,93,213,84,
+    93,23,178,108,154,166,234,146,1,89,229,186,174,236,2,178,172,202,178,234,10,
+    0,0,79,112,0,0,42,176,97,117,132,147,162,177,192,66,67,86,2,0,25,
+    0,0,0,49,8,49,165,20,98,140,41,197,24,83,138,49,166,148,0,0,128,
+    1,7,0,128,0,19,202,64,66,67,86,4,0,81,0,0,128,115,206,57,231,
+    156,115,206,57,231,156,115,206,57,231,156,115,206,57,231,28,99,140,49,198,24,
+    99,140,49,198,24,99,140,49,198,24,99,140,49,198,24,99,140,49,198,24,99,
+    140,49,198,152,0,128,157,8,7,128,157,8,11,33,66,67,86,2,0,225,0,
+    0,128,49,8,73,71,41,165,148,82,170,148,98,138,74,74,41,165,148,82,134,
+    148,82,142,81,74,41,165,148,82,230,156,131,144,82,74,41,165,148,66,199,28,
+    164,148,82,74,41,165,148,74,74,41,165,148,82,74,41,165,148,74,74,41,165,
+    148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,
+    82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,
+    74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,
+    41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,169,0,0,147,7,7,
+    0,168,4,27,103,88,73,58,43,28,13,14,66,67,86,2,0,185,1,0,0,
+    66,140,57,230,156,148,16,74,41,41,149,150,90,107,161,115,206,57,40,165,148,
+    148,82,73,169,181,212,58,199,152,131,82,74,40,37,148,146,82,74,41,133,16,
+    66,7,165,164,82,82,106,165,180,150,82,9,161,116,80,74,9,165,164,84,82,
+    41,165,181,22,74,40,33,148,146,82,74,165,148,212,82,75,173,164,146,66,9,
+    37,148,18,74,73,37,165,148,90,10,165,148,146,82,74,169,164,148,82,105,165,
+    181,212,74,73,37,164,146,66,73,165,148,148,82,106,173,132,144,74,104,169,180,
+    150,82,74,37,165,150,74,11,169,164,82,82,73,161,148,146,90,74,45,149,146,
+    82,40,165,149,84,74,9,165,148,18,74,73,41,165,150,74,41,37,165,146,82,
+    72,165,149,150,74,42,165,164,82,82,42,169,148,82,82,106,165,148,84,82,75,
+    37,149,146,82,105,37,148,146,82,42,173,148,148,82,41,169,148,146,74,42,45,
+    165,82,74,43,37,133,146,82,42,37,149,18,82,106,45,181,148,82,74,41,148,
+    84,90,41,165,164,82,82,41,173,148,82,74,104,165,148,210,66,42,37,149,214,
+    74,107,173,148,82,66,73,165,180,82,90,42,169,148,150,74,43,37,133,84,66,
+    9,165,0,0,160,3,7,0,128,0,35,42,45,196,78,51,174,60,2,71,20,
+    50,76,64,1,66,67,86,2,0,100,0,0,12,18,77,42,230,160,68,66,36,
+    134,20,115,20,132,16,66,8,33,132,102,192,130,202,73,203,41,3,81,41,6,
+    41,87,6,44,101,144,163,94,41,240,20,82,16,123,7,65,133,206,81,12,162,
+    5,93,99,139,53,184,28,132,16,194,7,33,0,66,67,86,8,0,161,25,0,
+    6,73,2,36,77,3,36,77,3,0,0,0,0,0,0,0,201,211,0,205,19,
+    1,205,19,1,0,0,0,0,0,0,64,210,60,64,19,61,64,19,61,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,36,207,3,60,81,4,60,81,4,0,0,0,0,0,0,0,77,20,
+    1,207,51,1,209,52,1,0,0,0,0,0,0,64,19,69,192,51,69,64,52,
+    77,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,36,207,3,60,81,4,60,81,4,0,0,0,0,0,0,
+    0,77,20,1,209,52,1,79,52,1,0,0,0,0,0,0,64,19,69,64,52,
+    77,192,51,61,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,1,0,0,1,14,0,0,1,22,66,66,
+    67,86,4,0,113,2,0,14,199,145,36,0,0,112,28,199,178,0,0,192,113,
+    28,203,2,0,0,203,178,52,13,0,0,44,203,210,52,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,3,
+    14,0,0,1,38,148,129,66,67,86,2,0,81,0,0,6,67,209,52,128,101,
+    1,44,11,160,105,0,77,3,120,30,64,244,0,166,9,0,4,0,0,20,56,
+    0,0,4,216,160,41,177,56,64,66,67,86,2,0,81,0,0,6,69,113,36,
+    203,242,60,120,158,166,137,34,60,79,211,68,17,162,233,121,162,8,211,244,60,
+    81,132,106,122,158,105,66,85,61,207,52,225,186,162,104,154,64,20,77,83,0,
+    0,64,129,3,0,64,128,13,154,18,139,3,4,66,67,86,2,0,33,1,0,
+    6,69,145,36,207,243,60,81,52,77,85,85,85,120,158,231,137,162,40,154,166,
+    170,186,46,60,207,243,68,81,20,77,83,85,93,23,162,232,121,166,105,154,170,
+    234,186,174,11,81,244,60,211,52,77,85,117,93,215,133,105,138,162,105,154,166,
+    170,186,174,44,195,52,69,209,52,77,83,85,93,87,150,161,170,162,104,154,166,
+    169,170,174,43,203,64,20,77,211,52,85,213,117,101,25,136,162,105,170,170,235,
+    186,174,44,3,81,52,77,85,117,85,215,149,101,96,154,170,170,170,174,43,187,
+    178,12,80,77,85,117,93,89,150,101,128,170,186,174,235,202,178,108,3,84,213,
+    117,93,87,150,109,25,224,186,174,43,203,178,108,219,0,92,87,150,101,217,182,
+    5,0,0,28,56,0,0,4,24,65,39,25,85,22,97,163,9,23,30,128,66,
+    67,86,4,0,81,0,0,128,49,74,41,166,148,97,76,66,40,33,68,140,73,
+    8,37,132,74,74,41,37,149,82,65,40,161,164,82,42,8,37,132,20,74,38,
+    37,165,148,74,169,32,148,82,82,8,21,132,82,74,9,161,0,0,176,3,7,
+    0,176,3,11,33,66,67,86,2,0,121,0,0,4,33,8,49,198,24,99,82,
+    66,198,24,115,206,57,8,33,99,140,57,231,156,148,146,49,198,156,115,78,74,
+    201,24,99,206,57,39,165,116,206,57,231,156,147,82,58,231,156,115,206,73,41,
+    157,115,206,57,231,164,148,82,58,231,156,115,82,74,41,157,115,206,57,41,165,
+    148,206,57,231,156,0,0,160,2,7,0,128,0,27,69,54,39,24,9,10,66,
+    67,86,2,0,169,0,0,6,199,177,44,207,243,60,81,52,77,77,146,52,205,
+    243,60,79,52,85,85,147,36,77,243,60,81,52,77,85,229,121,158,39,138,162,
+    40,154,170,202,243,60,79,20,69,209,52,85,149,235,138,162,40,154,162,169,170,
+    42,217,21,61,81,52,77,85,117,85,136,162,40,154,166,170,186,46,76,83,20,
+    77,83,85,93,23,178,108,154,170,234,170,178,11,219,54,77,213,84,85,215,5,
+    174,171,170,174,43,203,192,117,85,211,85,101,87,0,0,120,130,3,0,80,129,
+    13,171,35,156,20,141,5,6,66,67,86,2,0,25,0,0,4,33,8,41,165,
+    16,82,74,33,164,148,66,72,41,133,144,0,0,128,1,7,0,128,0,19,202,
+    64,66,67,86,2,0,169,0,0,0,33,82,74,41,165,148,82,34,165,164,148,
+    82,74,41,165,84,204,73,41,165,148,82,74,41,165,148,82,74,41,165,148,82,
+    74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,
+    41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,
+    165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,
+    148,82,74,41,165,148,82,66,8,161,0,64,236,10,7,128,157,8,27,86,71,
+    56,41,26,11,12,66,67,86,2,0,225,0,0,128,49,8,49,6,33,165,214,
+    98,172,16,82,10,66,41,173,181,152,107,133,16,99,16,74,105,173,197,26,131,
+    198,156,147,146,82,139,49,198,24,52,230,156,148,148,98,140,177,214,160,82,8,
+    41,181,214,98,172,57,6,215,66,72,169,181,24,99,172,61,8,161,90,107,49,
+    198,154,107,206,65,8,215,82,138,177,214,92,115,14,66,232,28,99,173,185,230,
+    220,115,16,66,231,24,99,173,57,231,220,131,16,194,215,92,107,174,53,231,28,
+    132,16,194,214,94,115,206,57,231,32,132,16,194,247,28,116,174,65,7,31,132,
+    16,62,215,156,115,206,185,0,0,147,7,7,0,168,4,27,103,88,73,58,43,
+    28,13,14,66,67,86,2,0,185,1,0,132,49,74,49,230,156,115,208,65,8,
+    33,132,16,82,106,25,99,204,57,8,33,148,82,74,41,165,164,148,50,198,152,
+    115,208,65,8,33,132,82,74,73,169,117,206,57,231,32,132,80,74,41,165,148,
+    146,82,202,152,115,206,65,8,161,148,82,74,41,37,165,212,57,231,32,132,16,
+    66,41,165,148,82,74,74,169,115,206,65,8,33,132,82,74,41,165,148,212,82,
+    8,29,132,16,66,41,165,148,82,74,41,41,165,148,58,7,33,132,82,74,41,
+    165,148,82,82,75,45,133,16,66,40,165,148,82,74,41,165,164,148,82,10,33,
+    132,82,74,41,165,148,82,74,105,169,165,20,66,40,165,148,82,74,41,165,148,
+    210,82,74,41,165,82,74,41,165,148,82,74,41,41,165,150,82,75,165,148,82,
+    74,41,165,148,146,74,74,41,165,148,74,41,165,148,82,74,41,165,148,148,90,
+    106,41,149,82,74,41,165,148,82,74,41,41,181,212,82,74,169,148,82,74,41,
+    165,148,82,82,106,41,181,148,90,41,169,148,82,74,41,165,164,148,82,74,41,
+    165,82,74,41,165,148,82,74,105,45,181,148,90,107,41,149,82,74,41,165,148,
+    212,90,106,45,181,148,82,42,165,148,82,74,41,165,0,0,160,3,7,0,128,
+    0,35,42,45,196,78,51,174,60,2,71,20,50,76,64,1,66,67,86,2,0,
+    100,0,0,140,18,143,58,7,161,52,70,36,136,20,115,82,140,49,66,8,33,
+    132,134,192,162,138,57,104,45,4,215,57,40,37,102,8,44,103,144,114,82,33,
+    176,28,50,136,65,198,192,131,10,33,229,156,3,145,58,165,20,131,18,92,43,
+    33,99,14,0,66,67,86,2,0,100,0,0,148,178,82,74,40,173,85,64,34,
+    165,24,164,218,66,71,153,131,20,115,137,44,115,12,90,205,165,98,14,41,6,
+    173,134,202,49,165,24,180,22,50,8,153,82,76,74,9,37,117,76,41,39,45,
+    197,152,74,231,156,164,152,115,141,165,115,16,0,66,67,86,8,0,161,25,0,
+    14,199,1,36,203,2,36,75,3,0,0,0,0,0,0,0,73,211,0,205,243,
+    0,203,243,0,0,0,0,0,0,0,64,210,52,192,242,52,64,243,60,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,36,77,3,52,207,3,52,207,3,0,0,0,0,0,0,0,205,243,
+    0,79,20,1,79,20,1,0,0,0,0,0,0,192,242,60,192,19,61,192,19,
+    69,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,28,77,3,52,207,3,52,207,3,0,0,0,0,0,0,
+    0,203,243,0,79,20,1,207,19,1,0,0,0,0,0,0,64,243,60,192,19,
+    69,192,19,69,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,1,0,0,1,14,0,0,1,22,66,66,
+    67,86,4,0,113,2,0,6,199,129,166,65,211,224,121,0,199,178,224,121,240,
+    60,136,34,192,177,44,120,30,60,15,162,8,0,0,0,0,0,0,0,0,0,
+    128,230,121,80,85,168,42,92,21,160,121,30,76,21,170,10,213,5,0,0,0,
+    0,0,0,0,0,0,192,242,60,168,42,84,21,174,11,176,60,15,166,10,83,
+    133,170,2,0,0,0,0,0,0,0,0,0,224,137,34,84,23,170,11,87,5,
+    120,166,8,87,133,171,66,117,1,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,1,0,0,3,14,0,0,1,38,148,129,
+    66,67,86,4,0,113,2,0,14,71,177,44,0,0,112,28,199,178,0,0,192,
+    113,28,203,2,0,0,203,178,68,17,0,0,44,75,19,69,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,
+    3,14,0,0,1,38,148,129,66,67,86,2,0,81,0,0,6,69,177,44,96,
+    89,150,5,44,203,178,128,166,89,22,192,210,0,154,7,240,60,128,40,2,0,
+    1,0,0,5,14,0,0,1,54,104,74,44,14,16,66,67,86,2,0,81,0,
+    0,6,69,177,44,77,19,69,154,166,105,154,38,138,52,77,211,52,77,20,121,
+    158,166,121,158,105,66,211,60,207,52,33,138,158,103,154,16,69,207,51,77,152,
+    166,40,170,42,16,69,85,21,0,0,80,224,0,0,16,96,131,166,196,226,0,
+    1,66,67,86,2,0,33,1,0,6,71,177,44,207,19,69,81,20,69,211,84,
+    85,154,166,105,158,39,138,162,104,154,170,234,170,52,77,211,60,79,20,69,209,
+    52,85,85,117,121,158,166,137,162,105,138,162,105,170,170,235,66,211,68,209,52,
+    77,209,52,85,213,117,225,121,162,104,154,166,169,170,170,234,186,240,60,81,52,
+    77,211,84,85,215,117,93,136,162,40,154,166,105,170,170,235,186,46,16,69,211,
+    52,77,85,117,93,89,6,162,104,154,170,170,170,174,43,203,64,20,77,83,85,
+    85,213,117,101,25,152,166,105,170,170,235,202,174,44,3,76,83,85,93,87,150,
+    101,25,160,170,174,235,186,178,44,219,0,85,117,93,215,149,101,217,6,184,174,
+    235,202,178,44,219,54,0,215,149,101,89,182,109,1,0,0,7,14,0,0,1,
+    70,208,73,70,149,69,216,104,194,133,7,32,66,67,86,4,0,81,0,0,128,
+    49,76,41,166,148,97,76,66,72,33,52,140,73,8,37,132,76,74,42,41,149,
+    84,65,72,165,164,82,42,8,169,164,84,74,70,37,165,212,82,170,32,164,82,
+    82,42,21,132,84,74,43,169,0,0,176,3,7,0,176,3,11,33,66,67,86,
+    2,0,121,0,0,4,49,74,49,198,24,99,144,49,165,24,115,206,57,168,148,
+    82,140,57,231,156,100,140,49,198,156,115,78,74,201,24,99,206,57,39,165,100,
+    204,57,231,156,147,82,50,231,156,115,206,73,41,157,115,206,57,231,164,148,82,
+    58,231,156,115,82,74,41,33,116,206,57,41,165,148,206,57,231,156,0,0,160,
+    2,7,0,128,0,27,69,54,39,24,9,10,66,67,86,2,0,169,0,0,6,
+    199,177,44,77,211,52,207,19,69,75,146,52,205,243,60,79,20,77,83,179,36,
+    77,243,60,207,19,69,211,228,121,158,39,138,162,104,154,170,202,243,60,79,20,
+    69,209,52,85,149,235,138,162,105,154,166,170,170,42,89,22,69,211,52,77,85,
+    117,93,152,166,105,170,170,235,186,50,76,211,52,85,213,117,93,23,182,109,170,
+    170,234,186,178,12,219,86,77,85,149,93,89,6,174,171,186,178,107,219,192,117,
+    93,87,118,109,91,0,0,120,130,3,0,80,129,13,171,35,156,20,141,5,6,
+    66,67,86,2,0,25,0,0,132,49,200,40,132,16,82,8,33,164,16,66,72,
+    41,133,144,0,0,128,1,7,0,128,0,19,202,64,66,67,86,2,0,169,0,
+    0,0,50,214,90,107,173,181,214,26,232,40,165,148,82,74,41,21,142,81,74,
+    41,165,148,82,74,41,165,148,82,74,41,165,148,82,73,41,165,148,82,74,41,
+    165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,
+    148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,
+    82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,
+    74,169,0,192,165,10,7,0,221,7,27,86,71,56,41,26,11,12,66,67,86,
+    2,0,169,0,0,128,49,74,49,229,156,132,82,42,132,24,115,76,66,74,45,
+    86,8,49,230,156,148,148,98,44,158,115,14,66,41,173,181,88,60,231,28,132,
+    82,90,139,177,168,212,57,41,41,181,20,91,81,41,100,82,82,74,173,197,32,
+    132,41,41,181,214,74,107,65,8,85,82,137,45,181,214,130,16,186,166,212,82,
+    44,177,5,33,108,109,37,165,24,99,12,194,7,31,99,43,177,212,24,124,240,
+    65,182,86,98,170,181,0,0,204,6,7,0,136,4,27,86,71,56,41,26,11,
+    12,66,67,86,2,0,33,1,0,132,49,74,49,198,24,99,206,57,231,156,100,
+    140,49,198,156,115,14,66,8,33,148,140,49,230,156,115,206,65,8,33,132,210,
+    57,231,156,115,14,66,8,33,132,80,74,233,152,115,206,65,8,33,132,16,74,
+    74,157,115,14,66,8,33,148,16,66,73,165,115,206,65,8,33,132,80,74,41,
+    169,116,14,66,8,33,148,16,74,40,169,164,148,58,7,33,132,16,66,40,37,
+    165,148,82,8,33,132,80,66,8,165,164,148,82,10,33,132,16,66,8,37,148,
+    148,82,74,33,132,80,74,8,161,148,146,82,74,41,165,16,66,9,161,148,82,
+    82,42,41,165,84,66,41,33,132,80,74,42,41,165,148,66,8,161,132,82,74,
+    73,37,165,148,82,41,33,148,80,74,41,165,148,148,82,74,41,132,18,74,40,
+    165,0,0,128,3,7,0,128,0,35,232,36,163,202,34,108,52,225,194,3,16,
+    66,67,86,2,0,100,0,0,40,196,214,82,107,49,119,130,26,135,152,180,28,
+    51,9,157,147,24,132,106,44,130,200,81,237,173,114,76,41,71,177,167,6,34,
+    101,148,196,158,42,202,152,98,18,115,12,45,116,202,73,171,181,148,78,33,5,
+    41,230,148,66,133,148,131,22,0,66,67,86,2,0,100,0,0,144,162,148,82,
+    41,45,69,130,34,165,24,164,24,75,70,21,115,80,90,138,168,114,12,82,205,
+    169,82,206,32,230,36,150,136,49,132,148,147,84,50,230,20,66,12,66,234,28,
+    117,76,41,6,45,149,24,66,198,24,164,216,114,75,161,115,14,0,66,67,86,
+    8,0,161,25,0,14,199,1,36,203,2,36,203,2,0,0,0,0,0,0,0,
+    73,211,0,205,243,0,75,243,0,0,0,0,0,0,0,64,210,52,192,242,52,
+    64,243,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,36,77,3,52,207,3,52,207,3,0,0,0,0,
+    0,0,0,205,243,0,207,19,1,79,20,1,0,0,0,0,0,0,192,242,60,
+    64,19,61,192,19,69,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,36,77,3,52,207,3,52,207,3,0,
+    0,0,0,0,0,0,203,243,0,79,20,1,205,19,1,0,0,0,0,0,0,
+    192,242,60,192,19,69,192,19,61,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,14,0,
+    0,1,22,66,66,67,86,4,0,113,2,0,14,73,130,36,65,146,160,121,0,
+    201,178,160,105,208,52,152,38,64,178,44,104,26,52,13,166,9,0,0,0,0,
+    0,0,0,0,0,128,164,105,208,52,104,26,68,17,32,105,26,52,13,154,6,
+    81,4,0,0,0,0,0,0,0,0,0,64,210,52,104,26,52,13,162,8,144,
+    52,13,154,6,77,131,40,2,0,0,0,0,0,0,0,0,0,224,153,38,68,
+    17,162,8,211,4,120,166,9,81,132,40,194,52,1,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,3,14,0,
+    0,1,38,148,129,66,67,86,4,0,113,2,0,14,71,177,44,0,0,112,28,
+    199,178,0,0,192,113,28,203,2,0,0,203,178,68,17,0,0,44,75,19,69,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,1,0,0,3,14,0,0,1,38,148,129,66,67,86,2,0,81,0,0,
+    14,69,177,44,224,56,150,5,28,199,178,128,36,89,22,192,178,0,154,7,208,
+    52,128,40,2,0,1,0,0,5,14,0,0,1,54,104,74,44,14,16,66,67,
+    86,2,0,81,0,0,6,197,177,44,77,19,69,146,164,105,154,39,138,36,73,
+    211,60,79,20,105,154,231,121,158,105,194,243,60,207,52,33,138,162,104,154,16,
+    69,81,52,77,152,166,105,170,42,48,77,85,21,0,0,80,224,0,0,16,96,
+    131,166,196,226,0,1,66,67,86,2,0,33,1,0,14,69,177,44,77,243,60,
+    207,19,69,211,84,77,146,164,105,158,39,138,162,104,154,166,169,170,36,73,211,
+    60,79,20,69,209,52,77,83,85,89,150,166,121,158,40,138,162,105,170,170,170,
+    66,211,60,79,20,69,209,52,85,85,117,225,121,158,39,138,162,104,154,170,234,
+    186,240,60,207,19,69,81,52,77,85,117,93,136,162,40,154,166,105,170,166,170,
+    186,46,16,69,211,52,77,85,85,85,215,5,162,39,138,166,169,170,174,235,186,
+    192,243,68,209,52,85,213,85,93,23,136,166,105,170,170,170,186,174,44,3,76,
+    211,52,85,213,117,101,25,160,170,170,234,186,174,43,203,0,85,85,85,215,117,
+    93,89,6,168,170,235,186,174,44,203,50,0,215,117,93,89,150,101,1,0,0,
+    7,14,0,0,1,70,208,73,70,149,69,216,104,194,133,7,32,66,67,86,4,
+    0,81,0,0,128,49,76,41,166,148,97,76,66,72,33,52,140,73,8,41,132,
+    76,74,74,165,165,84,65,72,165,164,82,42,8,169,148,84,74,70,41,165,212,
+    82,170,32,164,82,82,41,21,132,84,74,42,165,0,0,176,3,7,0,176,3,
+    11,33,66,67,86,2,0,121,0,0,132,49,74,49,198,152,115,18,33,165,24,
+    115,206,57,137,144,82,140,57,231,156,84,138,49,231,156,115,78,74,201,152,99,
+    206,57,39,165,116,206,57,231,156,147,82,50,231,156,115,206,73,41,157,115,206,
+    57,231,164,148,82,58,231,156,115,82,74,41,33,116,14,58,41,165,148,206,57,
+    231,156,0,0,160,2,7,0,128,0,27,69,54,39,24,9,10,66,67,86,2,
+    0,169,0,0,6,199,177,44,77,243,60,81,52,77,75,146,52,205,243,60,79,
+    20,77,83,147,36,77,243,60,207,19,69,213,228,121,158,39,138,162,104,154,170,
+    202,243,60,79,20,69,209,52,85,149,235,138,162,105,154,166,170,170,46,89,22,
+    69,211,52,77,85,117,93,152,166,105,170,170,235,186,46,76,211,52,85,213,117,
+    93,23,182,173,170,170,234,186,178,12,219,86,85,85,117,93,89,6,174,235,186,
+    178,108,203,64,150,93,87,118,109,89,0,0,120,130,3,0,80,129,13,171,35,
+    156,20,141,5,6,66,67,86,2,0,25,0,0,132,49,8,41,132,16,82,6,
+    33,164,16,66,72,41,133,144,0,0,128,1,7,0,128,0,19,202,64,66,67,
+    86,2,0,169,0,0,128,49,214,90,107,173,181,214,26,232,172,181,214,90,107,
+    173,21,144,89,107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,106,173,
+    181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,
+    214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,214,
+    90,107,173,181,214,90,107,173,165,148,82,74,41,165,148,82,74,41,165,148,82,
+    74,41,165,148,82,74,169,0,64,191,10,7,0,255,7,27,86,71,56,41,26,
+    11,12,66,67,86,2,0,225,0,0,128,49,74,49,230,24,132,82,74,169,16,
+    98,204,57,233,168,180,22,99,133,16,99,206,73,72,169,181,216,138,231,156,131,
+    80,66,42,173,197,88,60,231,28,132,82,82,138,173,198,162,82,8,165,164,148,
+    90,108,177,22,149,66,71,37,165,148,90,171,177,24,99,82,73,173,181,22,91,
+    141,197,24,147,82,104,169,181,22,99,44,70,216,154,82,107,177,213,86,99,49,
+    198,214,84,90,104,49,198,24,139,17,190,200,216,90,76,181,213,26,140,17,70,
+    182,88,90,170,181,214,96,140,49,186,183,22,75,109,53,23,99,124,240,181,165,
+    88,98,172,185,0,0,238,6,7,0,136,4,27,103,88,73,58,43,28,13,14,
+    66,67,86,2,0,33,1,0,4,66,74,49,198,24,99,206,57,231,156,84,138,
+    49,199,156,115,206,65,8,33,148,74,49,198,152,115,206,65,8,33,132,146,49,
+    198,156,115,14,66,8,33,132,80,74,201,152,115,14,66,8,33,132,16,82,74,
+    157,115,14,66,8,33,132,16,66,41,165,115,206,65,8,33,132,16,66,40,165,
+    116,16,66,8,33,132,16,66,9,165,148,148,66,8,33,132,16,66,8,33,149,
+    148,82,8,33,132,80,74,8,37,164,146,82,10,33,132,16,66,40,165,132,148,
+    82,74,33,132,80,74,8,33,148,144,82,74,41,165,16,66,8,161,148,82,82,
+    74,41,165,84,66,41,161,132,80,66,42,37,165,148,66,9,33,132,82,74,73,
+    41,165,148,74,41,33,148,80,66,41,165,164,148,82,74,41,132,16,66,41,165,
+    0,0,128,3,7,0,128,0,35,232,36,163,202,34,108,52,225,194,3,16,66,
+    67,86,2,0,100,0,0,36,196,84,75,139,177,102,194,34,137,152,180,218,42,
+    232,24,131,20,123,105,44,146,202,89,237,173,114,76,33,70,173,151,198,33,101,
+    20,196,94,42,201,152,98,16,115,11,41,116,138,73,171,53,149,80,33,5,41,
+    230,152,74,133,148,131,20,0,66,67,86,2,0,100,0,0,12,163,148,82,73,
+    45,69,130,34,165,24,164,150,66,37,21,115,80,82,138,40,115,14,82,172,169,
+    66,206,32,230,36,149,138,49,132,148,131,84,50,7,149,82,204,65,10,33,101,
+    76,41,6,173,149,24,58,198,152,163,152,106,42,161,99,12,0,66,67,86,8,
+    0,161,25,0,14,199,1,36,203,2,36,75,3,0,0,0,0,0,0,0,73,
+    211,0,205,243,0,203,243,0,0,0,0,0,0,0,64,210,52,192,242,52,64,
+    243,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,36,77,3,52,207,3,52,207,3,0,0,0,0,0,
+    0,0,205,243,0,79,20,1,79,20,1,0,0,0,0,0,0,192,242,60,192,
+    19,61,192,19,69,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,28,77,3,52,207,3,52,207,3,0,0,
+    0,0,0,0,0,203,243,0,79,20,1,207,19,1,0,0,0,0,0,0,64,
+    243,60,192,19,69,192,19,69,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,14,0,0,
+    1,22,66,66,67,86,4,0,113,2,0,14,73,130,36,65,146,160,105,0,201,
+    178,160,105,208,52,152,38,64,178,44,104,26,52,13,166,9,0,0,0,0,0,
+    0,0,0,0,128,228,105,208,52,104,26,68,17,32,105,30,52,13,154,6,81,
+    4,0,0,0,0,0,0,0,0,0,64,210,52,104,26,52,13,162,8,144,52,
+    13,154,6,77,131,40,2,0,0,0,0,0,0,0,0,0,160,153,38,68,17,
+    162,8,211,4,120,166,9,81,132,40,194,52,1,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,3,14,0,0,
+    1,38,148,129,66,67,86,4,0,113,2,0,14,69,177,44,0,0,112,36,199,
+    178,0,0,192,113,36,203,2,0,0,203,178,68,17,0,0,44,75,19,69,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,1,0,0,3,14,0,0,1,38,148,129,66,67,86,2,0,81,0,0,14,
+    69,177,44,224,56,150,5,28,199,178,128,36,89,22,192,178,0,154,7,208,52,
+    128,40,2,0,1,0,0,5,14,0,0,1,54,104,74,44,14,16,66,67,86,
+    2,0,81,0,0,14,69,177,44,77,19,69,142,99,89,154,38,138,28,201,178,
+    52,77,20,89,150,166,121,158,105,66,211,60,207,20,33,122,158,103,154,240,60,
+    207,51,77,152,166,40,170,42,16,69,211,20,0,0,80,224,0,0,16,96,131,
+    166,196,226,0,1,66,67,86,2,0,33,1,0,14,199,177,44,207,19,69,207,
+    19,69,211,84,85,142,99,89,158,39,138,162,104,154,170,170,170,28,71,179,60,
+    79,20,69,209,52,85,85,85,89,150,166,121,158,40,138,162,105,170,170,234,66,
+    211,60,79,20,69,209,52,85,213,117,225,121,158,39,138,162,104,154,170,234,186,
+    240,60,207,19,69,81,52,77,85,117,93,136,162,40,154,166,105,170,170,170,186,
+    46,16,69,211,52,77,85,85,85,215,5,162,40,154,166,169,170,170,234,186,64,
+    20,69,209,52,85,85,117,93,23,152,166,105,170,170,170,186,174,236,2,76,83,
+    85,85,213,117,93,23,160,170,170,234,186,174,43,203,0,85,85,85,215,117,93,
+    89,6,184,174,235,186,174,44,203,50,0,215,117,93,87,150,101,1,0,0,7,
+    14,0,0,1,70,208,73,70,149,69,216,104,194,133,7,32,66,67,86,4,0,
+    81,0,0,128,49,76,41,166,148,97,76,66,72,33,52,140,73,8,41,132,76,
+    74,74,37,165,84,65,72,165,164,82,42,8,169,148,84,74,70,169,165,212,82,
+    170,32,164,82,82,41,21,132,84,74,42,165,0,0,176,3,7,0,176,3,11,
+    33,66,67,86,2,0,121,0,0,132,49,74,49,198,152,115,18,33,165,24,115,
+    206,57,137,144,82,140,57,231,156,84,138,49,231,156,115,78,74,201,152,115,206,
+    57,39,165,116,204,57,231,156,147,82,50,230,156,115,206,73,41,157,115,206,57,
+    231,164,148,82,58,231,156,115,82,74,41,33,116,14,58,41,165,148,206,57,7,
+    161,0,0,160,2,7,0,128,0,27,69,54,39,24,9,10,66,67,86,2,0,
+    169,0,0,6,199,177,44,77,243,60,81,52,77,75,146,52,205,243,60,79,52,
+    85,85,147,36,77,243,60,81,52,77,85,229,121,158,39,138,162,104,154,170,202,
+    243,60,79,20,69,209,52,85,149,235,138,162,40,154,166,105,170,42,89,22,69,
+    83,52,77,85,85,93,152,166,105,154,166,170,186,46,76,211,52,77,83,85,93,
+    23,182,173,170,170,234,186,174,11,219,86,85,85,117,93,87,6,174,235,186,174,
+    43,203,64,118,93,215,117,101,89,0,0,120,130,3,0,80,129,13,171,35,156,
+    20,141,5,6,66,67,86,2,0,25,0,0,132,49,8,41,132,16,82,200,32,
+    164,16,66,72,41,133,144,0,0,128,1,7,0,128,0,19,202,64,66,67,86,
+    2,0,169,0,0,0,33,214,90,107,173,181,214,26,198,172,181,214,90,107,173,
+    37,206,89,107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,
+    214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,214,
+    90,107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,
+    107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,
+    173,181,214,90,107,173,0,64,236,10,7,128,157,8,27,86,71,56,41,26,11,
+    12,66,67,86,2,0,225,0,0,128,49,8,49,6,157,132,82,74,169,16,98,
+    12,58,9,169,180,22,99,133,16,99,16,74,73,169,181,22,147,231,156,131,80,
+    74,75,173,197,152,60,231,28,132,148,90,139,49,198,228,90,8,41,165,212,82,
+    108,49,22,215,66,72,37,165,214,90,140,53,25,163,82,74,173,197,22,99,173,
+    189,24,149,82,105,41,198,24,99,13,198,216,156,90,139,49,198,90,107,49,70,
+    231,86,98,137,49,198,88,139,48,194,184,216,98,140,181,246,90,132,49,66,182,
+    88,90,171,181,214,96,140,49,54,183,22,91,173,57,23,99,132,209,181,165,214,
+    106,173,185,0,0,147,7,7,0,168,4,27,103,88,73,58,43,28,13,14,66,
+    67,86,2,0,185,1,0,4,66,74,49,198,152,115,206,57,231,28,132,16,82,
+    165,24,115,206,57,8,33,132,16,66,41,165,164,74,49,230,156,115,16,66,8,
+    161,132,82,74,73,25,99,204,57,8,33,132,16,74,41,165,148,210,82,202,152,
+    115,16,66,8,161,148,82,74,41,165,165,214,57,231,32,132,16,74,41,165,148,
+    82,74,74,169,115,206,65,8,161,148,82,74,41,165,148,148,90,8,33,132,80,
+    66,41,165,148,82,74,41,41,165,148,66,8,161,148,82,74,41,165,148,82,82,
+    75,41,133,16,74,41,165,148,82,74,41,165,164,148,82,10,33,132,82,74,41,
+    165,148,82,74,73,41,181,86,74,41,165,148,82,74,41,165,148,146,90,106,41,
+    165,80,74,41,165,148,82,74,41,37,181,148,82,74,165,148,82,74,41,165,148,
+    82,74,74,169,165,148,74,41,165,148,82,74,41,165,148,150,82,75,41,149,82,
+    74,41,165,148,82,74,41,41,165,148,82,74,169,148,82,74,41,165,148,82,82,
+    74,169,181,148,82,74,41,149,82,74,41,165,180,214,82,74,45,165,84,74,41,
+    165,148,82,74,105,169,181,214,90,106,41,149,82,74,41,165,148,210,90,107,41,
+    165,148,82,42,165,148,82,74,41,165,0,0,160,3,7,0,128,0,35,42,45,
+    196,78,51,174,60,2,71,20,50,76,64,1,66,67,86,2,0,100,0,0,12,
+    211,146,75,203,61,55,130,34,169,28,213,90,75,70,149,147,20,115,104,40,130,
+    10,90,205,53,84,208,32,38,45,134,136,41,132,152,196,88,58,232,152,114,82,
+    107,76,165,100,204,81,205,177,133,80,33,38,53,232,152,74,165,24,180,32,0,
+    66,67,86,2,0,100,0,0,136,131,88,90,107,173,85,70,57,229,164,164,214,
+    33,35,13,115,80,82,236,164,131,144,90,172,165,50,144,32,229,36,165,78,65,
+    132,20,131,212,66,70,149,82,204,73,75,161,101,76,41,6,177,149,24,58,198,
+    152,163,156,114,42,161,99,12,0,66,67,86,8,0,161,25,0,14,199,1,28,
+    77,3,28,75,3,0,0,0,0,0,0,0,73,211,0,77,20,1,205,19,1,
+    0,0,0,0,0,0,192,209,52,64,19,61,64,19,69,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,
+    77,3,52,81,4,52,81,4,0,0,0,0,0,0,0,77,20,1,209,84,1,
+    209,52,1,0,0,0,0,0,0,64,19,69,192,51,69,64,52,85,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,28,77,3,52,81,4,52,81,4,0,0,0,0,0,0,0,77,20,1,
+    81,53,1,79,52,1,0,0,0,0,0,0,64,19,69,64,52,77,64,84,77,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,1,0,0,1,14,0,0,1,22,66,66,67,86,4,0,
+    113,2,0,14,199,129,36,65,146,224,105,0,199,178,224,121,240,52,152,38,192,
+    177,44,120,30,52,15,166,9,0,0,0,0,0,0,0,0,0,128,228,105,240,
+    60,120,30,76,19,32,105,30,60,15,158,7,211,4,0,0,0,0,0,0,0,
+    0,0,64,242,60,120,30,60,15,166,9,144,60,15,158,7,207,131,105,2,0,
+    0,0,0,0,0,0,0,0,224,153,38,76,19,162,9,213,4,120,166,9,211,
+    132,105,194,84,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,1,0,0,3,14,0,0,1,38,148,129,66,67,86,4,
+    0,113,2,0,14,71,145,36,0,0,112,36,201,178,0,0,64,145,36,203,2,
+    0,0,203,178,60,15,0,0,36,203,242,60,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,3,14,0,0,
+    1,38,148,129,66,67,86,2,0,81,0,0,14,69,177,44,224,56,150,5,28,
+    199,178,128,36,89,22,192,178,0,154,6,240,52,128,40,2,0,1,0,0,5,
+    14,0,0,1,54,104,74,44,14,16,66,67,86,2,0,81,0,0,14,71,177,
+    44,77,19,69,142,99,89,154,38,138,28,199,178,52,77,20,89,150,166,105,154,
+    40,66,179,52,77,20,225,121,158,103,154,240,60,207,51,77,136,162,40,154,38,
+    16,69,211,20,0,0,80,224,0,0,16,96,131,166,196,226,0,1,66,67,86,
+    2,0,33,1,0,14,199,177,44,207,19,69,81,52,77,211,84,85,142,99,89,
+    158,39,138,162,104,154,170,234,186,28,199,178,60,79,20,69,209,52,85,213,117,
+    89,150,166,121,158,40,138,162,105,170,170,235,66,211,60,79,20,69,209,52,85,
+    213,117,161,105,162,104,154,166,169,170,170,234,186,208,52,79,52,77,211,84,85,
+    85,117,93,120,158,40,154,166,105,170,170,235,186,46,16,69,211,52,77,85,117,
+    93,215,5,162,104,154,166,169,170,174,235,186,64,20,69,211,52,85,213,117,93,
+    23,152,166,105,170,170,234,186,174,44,3,76,83,85,85,213,117,101,25,160,170,
+    170,234,186,174,44,203,0,85,85,85,215,117,93,89,6,184,174,235,202,174,44,
+    203,50,0,215,117,93,89,150,101,1,0,0,7,14,0,0,1,70,208,73,70,
+    149,69,216,104,194,133,7,32,66,67,86,4,0,81,0,0,128,49,76,41,166,
+    148,97,76,66,72,33,52,140,73,8,41,132,76,74,74,37,165,84,65,72,165,
+    164,82,42,8,169,148,84,74,70,169,165,212,82,170,32,164,82,82,41,21,132,
+    84,74,42,165,0,0,176,3,7,0,176,3,11,33,66,67,86,2,0,121,0,
+    0,132,49,74,49,230,156,115,18,33,165,24,115,206,57,137,144,82,140,57,231,
+    156,84,138,49,231,156,115,78,74,201,152,115,206,57,39,165,100,204,57,231,156,
+    147,82,50,230,156,115,206,73,41,157,115,206,57,7,165,148,82,58,231,156,115,
+    82,74,41,33,116,206,57,41,165,148,206,57,231,156,0,0,160,2,7,0,128,
+    0,27,69,54,39,24,9,10,66,67,86,2,0,169,0,0,6,199,177,44,77,
+    243,60,81,52,77,75,146,52,205,243,60,209,52,77,83,147,36,77,243,60,81,
+    52,77,211,228,121,158,39,138,162,104,154,170,202,243,60,79,20,69,209,52,85,
+    149,235,138,162,104,154,166,105,170,42,89,22,69,81,52,77,85,85,85,152,166,
+    105,154,166,170,170,42,76,211,52,77,83,85,93,23,182,173,170,170,234,186,174,
+    11,219,86,85,85,117,93,215,5,174,235,186,174,43,203,192,117,93,215,117,101,
+    89,0,0,120,130,3,0,80,129,13,171,35,156,20,141,5,6,66,67,86,2,
+    0,25,0,0,132,49,8,41,132,16,82,6,33,164,16,66,72,41,133,144,0,
+    0,128,1,7,0,128,0,19,202,64,66,67,86,2,0,225,0,0,0,33,24,
+    99,140,49,198,24,99,108,24,195,24,99,140,49,198,24,99,226,20,198,24,99,
+    140,49,198,24,99,140,49,198,24,99,140,49,198,24,99,140,49,198,24,99,140,
+    49,198,24,99,140,49,198,24,99,140,49,198,24,99,140,49,198,24,99,140,49,
+    198,24,99,140,49,198,24,99,140,49,198,24,99,140,49,198,24,99,140,49,198,
+    24,99,140,49,198,24,99,140,49,198,24,99,140,49,198,24,99,140,49,198,24,
+    99,140,49,198,24,99,140,49,198,24,99,140,49,198,24,99,140,49,198,24,99,
+    140,49,198,24,99,140,177,181,214,90,107,173,0,48,156,11,7,128,178,8,27,
+    103,88,73,58,43,28,13,14,66,67,86,2,0,33,1,0,128,49,8,49,6,
+    157,132,82,82,73,169,66,136,49,7,165,164,210,82,75,177,85,8,49,6,161,
+    148,148,90,139,45,198,226,57,231,32,148,148,82,75,49,197,86,60,231,156,148,
+    148,90,139,49,198,88,139,107,33,164,148,82,107,177,197,22,99,147,45,132,148,
+    82,106,45,198,88,107,108,70,169,150,82,107,49,198,24,99,141,69,41,151,82,
+    106,45,182,24,99,173,177,8,101,115,107,45,198,88,107,173,181,38,165,124,110,
+    41,182,90,107,140,181,214,100,148,81,50,198,88,107,141,181,214,90,132,82,74,
+    198,152,98,138,181,214,90,147,16,198,248,30,99,140,53,230,92,107,82,66,24,
+    223,99,170,37,182,90,107,77,74,41,101,132,172,49,213,88,107,206,73,41,161,
+    140,177,177,165,154,114,206,185,0,0,168,7,7,0,168,4,35,232,36,163,202,
+    34,108,52,225,194,3,16,66,67,86,2,0,185,1,0,8,66,74,49,198,152,
+    115,206,57,231,156,115,14,82,164,24,115,204,57,231,32,132,16,66,8,33,164,
+    8,49,198,152,115,206,65,8,33,132,16,66,72,25,99,204,57,231,32,132,16,
+    66,8,161,132,146,82,202,152,115,206,65,8,33,132,82,74,41,37,165,212,57,
+    231,32,132,16,66,40,165,148,82,74,74,169,115,206,65,8,33,132,82,74,41,
+    165,148,148,82,8,33,132,16,66,8,165,148,82,74,41,41,165,148,66,8,33,
+    132,18,74,41,165,148,82,82,74,41,133,16,66,8,165,148,82,74,41,165,164,
+    148,82,10,33,132,16,74,41,165,148,82,74,73,41,165,20,66,9,165,148,82,
+    74,41,165,148,146,82,74,41,165,16,74,41,165,148,82,74,41,37,165,148,82,
+    74,165,148,82,74,41,165,148,82,74,74,41,165,148,74,41,165,148,82,74,41,
+    165,148,148,82,74,41,149,82,74,41,165,148,82,74,41,41,165,148,82,74,169,
+    148,82,74,41,165,148,82,82,74,41,165,148,82,41,165,148,82,74,41,165,164,
+    148,82,74,41,165,82,74,41,165,148,82,74,73,41,165,148,82,74,165,148,82,
+    74,41,165,148,146,82,74,41,165,148,82,42,165,148,82,74,41,165,0,0,160,
+    3,7,0,128,0,35,42,45,196,78,51,174,60,2,71,20,50,76,64,1,66,
+    67,86,2,0,100,0,0,144,147,154,82,235,57,72,136,65,230,36,6,161,33,
+    36,17,115,20,115,233,164,115,142,114,49,30,66,142,24,37,181,135,76,49,67,
+    16,212,98,66,39,21,82,80,139,107,169,117,204,81,45,54,182,146,33,5,181,
+    216,26,75,133,148,163,30,0,66,67,86,2,0,100,0,0,136,163,88,107,140,
+    189,86,196,48,8,37,213,88,26,130,24,131,18,115,203,140,81,202,73,204,173,
+    83,74,41,39,177,166,144,41,165,152,179,20,75,232,152,82,140,82,76,37,132,
+    140,41,73,49,198,24,83,232,164,181,156,123,110,169,148,22,0,66,67,86,4,
+    0,81,0,0,6,73,34,73,36,73,242,52,162,72,244,36,205,35,138,60,17,
+    128,36,122,60,143,231,73,158,200,243,120,30,0,73,20,121,30,207,147,68,145,
+    231,241,60,1,0,0,1,14,0,0,1,22,66,66,67,86,4,0,113,2,0,
+    22,73,242,60,146,228,121,36,201,243,104,154,40,66,20,37,77,19,69,158,103,
+    154,60,205,20,153,166,170,66,85,37,77,19,69,158,103,154,52,79,52,153,166,
+    170,66,85,61,81,84,85,170,234,186,84,211,117,201,182,109,195,150,61,81,84,
+    85,170,234,186,76,213,117,217,178,109,67,182,1,0,0,72,158,166,154,52,205,
+    52,105,154,105,18,69,213,132,170,74,154,103,170,52,205,52,105,154,105,18,69,
+    83,133,170,122,166,232,186,76,211,117,153,166,235,114,93,89,134,44,123,162,233,
+    186,76,83,117,153,166,235,114,93,89,134,44,3,0,0,144,60,79,85,105,154,
+    105,210,52,211,36,138,166,10,213,148,60,79,85,105,154,105,210,52,211,36,138,
+    170,10,83,245,76,211,117,153,166,235,50,77,215,229,202,178,12,91,246,76,211,
+    117,153,166,235,50,77,215,37,187,178,12,89,6,0,0,160,153,166,45,19,69,
+    217,37,138,174,203,52,93,23,174,171,153,166,108,19,69,87,38,138,174,203,52,
+    93,23,174,43,170,170,45,83,77,91,166,170,178,204,117,101,25,178,44,170,170,
+    108,51,85,217,166,170,178,204,117,101,25,178,12,0,0,0,0,0,0,0,0,
+    0,81,85,109,155,170,202,50,213,148,101,174,43,203,144,101,81,85,109,155,170,
+    202,50,83,149,101,174,107,203,144,101,1,0,0,3,14,0,0,1,38,148,129,
+    66,67,86,2,0,81,0,0,14,197,177,44,77,19,69,142,99,89,154,38,154,
+    28,199,178,52,205,20,73,146,166,121,158,105,66,179,60,207,52,161,105,162,168,
+    170,208,52,81,84,85,0,0,4,0,0,20,56,0,0,4,216,160,41,177,56,
+    64,66,67,86,2,0,33,1,0,14,199,177,44,77,243,60,207,19,69,209,52,
+    77,142,99,89,158,39,138,162,104,154,166,169,170,28,199,178,60,79,20,69,209,
+    52,77,83,85,89,150,166,121,158,40,138,162,105,170,170,170,66,211,60,79,20,
+    69,209,52,85,85,85,161,105,162,104,154,166,169,170,170,234,186,208,52,81,52,
+    77,211,84,85,85,117,93,104,154,231,137,162,105,170,170,235,186,46,240,60,81,
+    52,77,85,117,93,215,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,16,0,0,112,224,0,0,16,96,4,157,100,84,89,132,141,38,92,120,
+    0,2,66,67,86,4,0,81,0,0,128,49,136,49,197,152,81,10,66,41,37,
+    52,74,65,9,37,148,10,66,105,169,164,148,73,72,173,181,214,50,41,169,181,
+    214,90,37,165,180,150,90,203,160,164,214,90,107,153,132,214,90,107,173,0,0,
+    176,3,7,0,176,3,11,33,66,67,86,2,0,121,0,0,8,50,74,49,230,
+    156,115,212,24,165,24,115,206,57,106,140,82,140,57,231,28,85,74,41,231,156,
+    131,144,82,170,20,115,206,57,72,41,101,204,57,231,156,163,148,50,230,156,115,
+    206,81,74,157,115,206,57,231,40,165,82,58,231,156,115,148,82,41,157,115,206,
+    57,74,169,148,140,57,231,156,0,0,160,2,7,0,128,0,27,69,54,39,24,
+    9,10,66,67,86,2,0,169,0,0,6,199,177,44,207,243,60,83,52,77,75,
+    146,52,77,20,69,209,52,85,213,146,36,77,19,69,83,84,77,85,101,89,154,
+    38,138,166,169,170,174,75,211,52,77,20,77,83,85,93,151,170,122,158,105,170,
+    170,235,186,46,213,21,61,211,84,85,215,149,101,0,0,0,0,0,0,0,0,
+    0,64,0,0,120,130,3,0,80,129,13,171,35,156,20,141,5,6,66,67,86,
+    2,0,25,0,0,136,49,8,33,99,16,66,198,32,164,16,66,72,41,133,144,
+    0,0,128,1,7,0,128,0,19,202,64,66,67,86,2,0,169,0,0,128,49,
+    74,57,231,156,148,84,42,132,24,115,14,66,41,45,85,8,49,230,28,132,82,
+    90,138,26,99,12,66,41,41,181,22,53,198,24,132,82,82,106,45,186,22,66,
+    41,41,165,212,90,116,45,132,82,82,106,173,181,40,165,74,165,164,214,90,140,
+    81,74,149,74,105,173,181,24,163,148,58,167,212,90,140,49,70,41,117,79,169,
+    181,24,107,141,82,74,39,99,140,49,214,218,156,115,78,198,24,99,172,181,0,
+    0,132,6,7,0,176,3,27,86,71,56,41,26,11,12,66,67,86,2,0,121,
+    0,0,8,66,74,49,198,24,99,16,33,165,24,99,204,49,135,144,82,140,49,
+    198,24,84,138,49,198,28,99,14,66,200,24,99,140,49,7,33,100,140,49,231,
+    156,131,16,50,198,24,99,206,65,8,157,115,142,49,231,32,132,208,57,199,152,
+    115,16,66,231,156,99,204,57,8,161,115,140,49,230,156,0,0,160,2,7,0,
+    128,0,27,69,54,39,24,9,10,66,67,86,2,0,225,0,0,128,49,140,57,
+    199,152,99,208,73,168,16,114,14,66,231,32,164,146,74,133,144,115,16,58,7,
+    161,148,148,138,231,160,147,18,66,41,165,164,82,60,7,161,148,16,74,73,169,
+    181,226,98,40,165,132,82,74,74,45,21,25,67,40,165,148,82,82,106,173,24,
+    99,74,8,41,165,148,90,107,197,24,19,74,72,37,165,148,98,43,198,216,88,
+    74,74,173,181,214,90,49,198,198,82,82,105,173,181,214,138,49,198,184,150,82,
+    107,49,198,90,140,49,198,181,148,90,138,177,198,98,140,49,190,167,214,98,140,
+    53,22,99,140,241,185,165,150,98,202,181,0,0,147,7,7,0,168,4,27,103,
+    88,73,58,43,28,13,14,66,67,86,2,0,185,1,0,8,66,74,49,198,152,
+    99,206,57,231,156,115,206,73,165,24,115,206,57,231,32,132,16,66,8,33,148,
+    74,49,230,156,115,206,65,7,33,132,16,66,40,25,115,206,57,7,33,132,16,
+    66,8,33,132,80,82,234,152,115,14,66,8,33,132,16,66,8,33,165,212,57,
+    231,32,132,16,66,8,33,132,16,66,74,169,115,206,65,8,33,132,16,66,8,
+    33,132,148,82,8,33,132,16,66,8,33,132,16,66,8,41,165,148,66,8,33,
+    132,16,66,8,33,148,18,82,74,41,133,16,66,8,37,132,18,74,8,37,164,
+    148,82,10,33,132,16,66,41,165,132,82,66,73,41,165,20,66,8,165,148,80,
+    74,41,161,148,144,82,74,41,165,16,66,40,165,148,80,74,41,37,165,148,82,
+    74,37,148,82,74,41,37,148,80,74,74,41,165,148,74,40,161,148,80,74,41,
+    165,148,148,82,74,41,149,82,74,41,37,148,82,74,9,41,165,148,82,74,169,
+    148,82,74,41,165,148,82,82,74,41,165,148,82,41,165,148,82,74,41,165,164,
+    148,82,74,41,165,82,74,41,165,148,18,74,73,41,165,148,82,74,165,148,80,
+    74,41,165,148,82,82,74,41,165,148,74,10,165,148,82,74,41,165,0,0,160,
+    3,7,0,128,0,35,42,45,196,78,51,174,60,2,71,20,50,76,64,1,66,
+    67,86,2,0,169,0,0,0,33,148,82,74,41,165,148,26,198,40,165,148,82,
+    74,41,69,14,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,74,41,
+    165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,
+    148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,
+    82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,
+    74,41,165,148,82,74,41,165,0,224,238,11,7,64,159,9,27,86,71,56,41,
+    26,11,12,66,67,86,2,0,169,0,0,128,49,140,49,198,148,115,206,41,165,
+    156,115,206,49,232,164,68,74,57,7,161,115,82,74,233,33,132,16,66,232,36,
+    164,212,59,8,33,132,16,74,73,169,199,24,66,9,161,164,148,90,143,53,116,
+    210,65,40,165,165,94,123,8,33,164,212,82,75,189,247,144,65,69,41,149,148,
+    122,239,169,133,146,82,75,49,246,222,91,42,153,149,214,90,235,61,247,94,82,
+    73,49,214,214,123,207,185,149,148,98,106,177,0,0,147,8,7,0,196,5,27,
+    86,71,56,41,26,11,12,66,67,86,1,0,49,0,0,132,33,6,33,164,148,
+    82,74,41,165,20,99,140,49,198,24,99,140,49,198,24,99,140,49,198,24,99,
+    140,49,198,152,0,0,192,4,7,0,128,0,43,216,149,89,90,181,81,220,212,
+    73,94,244,65,224,19,58,98,51,50,228,82,42,102,114,34,232,145,26,106,177,
+    18,236,208,10,110,240,2,48,66,67,86,2,0,100,0,0,8,164,20,107,18,
+    66,73,6,57,41,177,23,165,25,131,28,180,26,148,167,16,98,76,98,47,166,
+    99,10,33,71,65,169,144,49,100,144,3,37,83,199,24,66,204,139,141,157,82,
+    8,49,47,198,151,206,49,6,189,24,227,74,9,161,4,35,0,66,67,86,2,
+    0,100,0,0,136,163,152,107,141,185,86,6,49,40,41,213,88,26,130,152,131,
+    18,99,203,140,65,202,65,171,49,84,8,41,7,173,182,144,41,132,148,163,212,
+    82,232,152,82,76,82,76,37,116,76,41,72,49,182,214,74,232,32,181,154,115,
+    109,169,148,22,0,66,67,86,4,0,81,0,0,6,73,34,73,36,73,242,52,
+    162,72,244,36,205,35,138,60,17,128,36,138,60,143,231,73,158,200,243,120,30,
+    0,73,20,121,30,207,147,60,145,231,241,60,1,0,0,1,14,0,0,1,22,
+    66,66,67,86,4,0,113,2,0,22,73,242,60,146,228,121,36,201,243,104,154,
+    40,66,20,37,77,19,69,158,103,154,60,205,20,153,166,170,66,85,37,77,19,
+    69,158,103,154,52,79,52,153,166,170,66,85,61,81,84,77,170,234,186,84,211,
+    117,201,182,109,195,150,61,81,52,85,170,234,186,76,213,117,201,178,109,67,182,
+    1,0,0,72,158,166,154,52,205,52,105,154,105,18,69,213,132,170,74,154,103,
+    170,52,205,52,105,154,105,18,69,83,133,170,122,166,232,186,76,211,117,153,166,
+    235,114,93,89,134,44,123,162,233,186,76,211,117,153,166,234,114,93,89,134,44,
+    3,0,0,144,60,79,85,105,154,105,210,52,211,36,138,166,10,213,148,60,207,
+    84,105,154,105,210,52,211,36,138,170,9,83,21,77,211,117,153,166,235,50,77,
+    215,229,202,178,12,217,21,77,211,117,153,166,235,50,77,215,37,187,178,12,87,
+    6,0,0,160,153,166,45,19,69,215,37,138,174,203,52,93,23,174,171,153,166,
+    108,19,69,87,38,138,174,203,52,93,23,174,43,170,170,45,83,77,217,165,170,
+    178,204,117,101,25,178,44,170,170,108,51,85,87,166,170,178,204,117,101,25,178,
+    12,0,0,0,0,0,0,0,0,0,81,85,109,155,169,202,50,213,148,101,174,
+    43,203,144,93,81,85,109,155,106,202,50,83,149,101,174,107,203,144,101,1,0,
+    0,3,14,0,0,1,38,148,129,66,67,86,2,0,81,0,0,14,199,145,36,
+    77,19,69,142,99,89,154,38,138,28,199,178,52,77,20,73,146,101,121,158,105,
+    194,178,60,207,52,161,105,162,104,154,208,52,207,51,77,0,0,4,0,0,20,
+    56,0,0,4,216,160,41,177,56,64,66,67,86,2,0,33,1,0,22,199,145,
+    36,77,243,60,207,19,69,211,84,85,142,99,89,154,230,121,162,104,154,170,234,
+    186,28,199,178,52,205,243,68,209,52,85,213,117,73,146,101,121,158,40,138,162,
+    105,170,174,235,194,178,60,77,20,69,209,52,85,213,117,161,105,158,39,138,166,
+    169,170,174,43,187,208,52,207,19,69,211,84,85,215,117,101,104,154,231,137,162,
+    105,170,170,235,202,50,240,60,81,52,77,85,117,93,89,6,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,16,0,0,112,224,0,0,16,96,4,
+    157,100,84,89,132,141,38,92,120,0,2,66,67,86,4,0,81,0,0,128,49,
+    136,49,197,152,81,76,74,41,37,52,74,73,41,37,148,72,74,72,173,164,150,
+    73,73,173,181,214,50,41,169,181,214,90,37,165,180,150,90,203,164,180,214,90,
+    106,153,148,212,90,107,173,0,0,176,3,7,0,176,3,11,33,66,67,86,2,
+    0,121,0,0,8,66,74,49,230,156,115,212,24,165,24,115,14,66,106,140,82,
+    140,57,7,161,69,72,41,198,32,132,208,90,171,20,99,16,66,72,41,101,140,
+    49,231,32,164,148,50,198,152,115,16,82,74,25,115,206,57,8,41,165,148,58,
+    231,156,131,148,82,74,157,115,206,57,74,41,165,140,57,231,156,0,0,160,2,
+    7,0,128,0,27,69,54,39,24,9,10,66,67,86,2,0,169,0,0,6,199,
+    177,44,77,243,52,209,51,77,75,146,52,205,243,68,81,52,85,85,147,36,77,
+    243,60,81,52,77,85,165,105,154,38,122,162,104,154,170,202,243,52,205,19,69,
+    209,52,85,149,170,138,162,105,170,166,170,186,46,215,21,69,211,84,85,85,117,
+    93,0,0,0,0,0,0,0,0,0,64,0,0,120,130,3,0,80,129,13,171,
+    35,156,20,141,5,6,66,67,86,2,0,25,0,0,136,49,8,33,99,16,66,
+    198,32,164,16,66,72,41,133,144,0,0,128,1,7,0,128,0,19,202,64,66,
+    67,86,2,0,169,0,0,128,49,74,49,7,161,148,150,42,132,24,115,14,74,
+    74,173,101,8,49,230,156,148,148,90,107,26,99,204,65,41,41,181,216,52,198,
+    24,132,82,82,139,177,169,212,57,8,41,181,22,99,83,169,115,16,82,106,45,
+    198,230,156,41,165,180,22,99,140,205,57,83,74,105,45,198,88,155,115,182,166,
+    212,90,140,181,54,231,108,77,169,181,24,107,109,206,57,37,99,140,181,230,154,
+    148,82,74,198,24,107,205,185,0,0,132,6,7,0,176,3,27,86,71,56,41,
+    26,11,12,66,67,86,2,0,121,0,0,12,66,74,49,198,24,99,78,41,198,
+    24,99,140,49,167,148,98,140,49,198,152,83,138,49,198,24,99,204,57,199,24,
+    99,140,49,230,156,99,140,49,198,24,115,206,49,198,24,99,140,57,231,24,99,
+    140,49,198,156,115,206,49,198,24,99,206,57,231,24,99,140,49,231,156,115,140,
+    49,198,152,0,0,160,2,7,0,128,0,27,69,54,39,24,9,10,66,67,86,
+    2,0,225,0,0,128,49,140,57,231,24,116,16,74,169,16,98,12,66,231,36,
+    164,210,82,133,144,99,16,58,39,37,165,150,146,231,156,147,18,66,41,41,181,
+    148,60,231,156,148,16,74,73,169,181,228,90,8,165,132,82,74,74,173,37,215,
+    66,40,165,148,82,90,107,45,41,37,66,8,169,164,212,82,140,73,41,17,66,
+    72,37,165,212,98,76,74,201,88,74,74,173,181,22,91,82,202,198,82,82,106,
+    173,197,24,147,82,74,185,214,82,139,53,198,152,148,82,202,181,150,90,139,53,
+    214,164,148,82,190,183,216,98,172,185,38,99,140,241,185,165,150,106,171,181,0,
+    0,147,7,7,0,168,4,27,103,88,73,58,43,28,13,14,66,67,86,2,0,
+    185,1,0,8,66,76,49,230,156,115,206,57,231,156,115,206,73,165,24,115,206,
+    57,8,33,132,16,66,8,33,148,74,49,230,156,115,16,66,8,33,132,16,66,
+    40,25,115,206,57,8,33,132,16,66,8,33,132,80,74,233,156,115,16,66,8,
+    33,132,16,66,8,161,148,210,57,7,33,132,16,66,8,33,132,16,66,41,165,
+    115,16,66,8,33,132,16,66,8,33,132,82,74,8,33,132,16,66,8,33,132,
+    16,66,8,37,149,82,66,8,33,132,16,66,40,33,148,16,74,42,169,132,16,
+    66,8,161,148,18,74,8,33,164,146,74,9,33,132,16,74,8,37,132,18,66,
+    73,165,164,18,66,8,161,148,80,74,41,161,148,82,74,73,41,149,16,66,41,
+    165,148,82,74,41,165,148,148,74,41,165,148,82,74,41,37,148,18,74,74,37,
+    149,84,66,41,161,148,82,74,41,165,148,148,82,42,41,149,82,74,41,161,132,
+    82,66,9,165,148,84,82,73,169,148,82,74,9,165,148,82,74,73,165,148,82,
+    74,41,165,148,82,74,41,165,148,82,82,73,169,148,82,66,40,37,132,18,74,
+    41,37,165,82,74,41,165,132,80,74,9,161,148,82,74,42,169,148,82,74,9,
+    165,148,82,74,41,165,0,0,160,3,7,0,128,0,35,42,45,196,78,51,174,
+    60,2,71,20,50,76,64,1,66,67,86,2,0,169,0,0,0,33,148,82,74,
+    41,165,148,26,165,40,165,148,82,74,41,53,140,81,74,41,165,148,82,74,41,
+    165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,
+    148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,
+    82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,
+    74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,169,0,224,238,11,
+    7,64,159,9,27,86,71,56,41,26,11,12,66,67,86,2,0,169,0,0,128,
+    49,140,49,198,148,115,206,41,165,156,131,206,49,232,168,68,74,57,7,157,115,
+    18,82,234,157,131,14,66,232,36,164,210,59,7,161,148,16,74,73,169,199,24,
+    66,41,161,164,212,82,143,49,116,18,74,41,37,165,94,123,7,33,164,146,82,
+    75,189,247,144,73,70,37,165,150,122,239,173,133,146,82,75,173,245,222,91,41,
+    25,117,150,90,235,61,247,158,90,41,45,181,214,123,207,57,165,82,90,107,173,
+    0,0,147,8,7,0,196,5,27,86,71,56,41,26,11,12,66,67,86,1,0,
+    49,0,0,132,33,6,33,164,148,82,74,41,165,20,99,140,49,198,24,99,140,
+    49,198,24,99,140,49,198,24,99,140,49,198,152,0,0,192,4,7,0,128,0,
+    43,216,149,89,90,181,81,220,212,73,94,244,65,224,19,58,98,51,50,228,82,
+    42,102,114,34,232,145,26,106,177,18,236,208,10,110,240,2,48,66,67,86,2,
+    0,100,0,0,12,181,154,115,16,198,72,74,57,40,49,24,165,33,163,28,164,
+    156,148,167,16,82,140,106,15,34,99,138,49,137,57,153,142,41,166,24,212,222,
+    74,200,152,50,72,114,141,41,83,202,8,134,189,231,208,57,167,32,38,37,92,
+    42,37,164,26,0,66,67,86,2,0,100,0,0,136,179,88,107,141,181,86,6,
+    57,41,41,213,24,34,131,152,131,18,99,203,144,65,202,65,139,49,84,8,33,
+    6,169,182,146,41,100,20,147,212,82,232,24,66,74,74,108,37,116,74,33,39,
+    53,182,150,74,200,156,180,88,107,108,41,132,18,0,66,67,86,4,0,81,0,
+    0,6,73,34,73,36,73,210,52,162,71,244,44,77,227,137,60,17,128,36,122,
+    60,143,231,73,158,200,243,120,30,0,73,244,120,30,207,147,60,145,231,241,60,
+    1,0,0,1,14,0,0,1,22,66,66,67,86,4,0,113,2,0,22,73,242,
+    60,146,228,121,36,201,243,104,154,40,66,20,37,77,19,69,158,102,138,60,205,
+    20,153,166,170,66,85,37,77,19,69,154,39,154,52,79,52,153,166,170,66,85,
+    61,81,84,77,170,233,170,84,211,117,201,178,109,195,150,61,81,52,85,166,234,
+    186,76,213,117,201,178,109,67,182,1,0,0,72,158,166,154,52,205,52,105,154,
+    105,18,69,211,132,106,74,154,103,170,52,205,52,105,154,105,18,69,211,132,105,
+    122,166,232,186,76,211,85,153,166,235,114,93,217,133,236,122,162,233,186,76,83,
+    117,153,166,234,114,93,89,134,43,3,0,0,176,60,77,53,105,154,105,210,52,
+    211,36,138,166,10,211,180,52,207,84,105,154,105,210,52,211,36,138,166,9,211,
+    20,77,209,117,153,166,235,50,77,87,229,186,178,12,217,245,68,211,117,153,166,
+    235,50,77,213,229,186,178,12,87,6,0,0,160,153,166,44,19,69,215,37,138,
+    174,203,52,93,23,174,171,153,166,44,19,69,215,37,138,174,203,52,93,23,174,
+    43,170,170,45,51,77,217,165,154,178,203,117,101,23,178,44,170,170,108,51,85,
+    87,102,170,178,204,117,93,25,178,12,0,0,0,0,0,0,0,0,0,81,85,
+    109,155,169,202,50,213,148,101,170,43,203,144,93,81,85,109,155,106,202,50,83,
+    149,101,174,43,203,112,101,1,0,0,3,14,0,0,1,38,148,129,66,67,86,
+    2,0,81,0,0,14,199,145,36,77,19,69,142,99,89,154,38,138,28,199,178,
+    52,77,20,73,146,101,121,158,105,194,178,60,207,52,161,105,162,104,154,208,52,
+    207,51,77,0,0,4,0,0,20,56,0,0,4,216,160,41,177,56,64,66,67,
+    86,2,0,33,1,0,22,199,145,36,77,243,60,207,19,69,211,84,85,142,99,
+    89,154,230,121,162,103,154,170,170,170,28,199,178,52,205,243,68,209,52,85,85,
+    85,89,146,101,105,154,40,138,162,105,170,170,235,194,178,52,77,20,69,209,52,
+    85,213,117,161,105,158,39,138,166,169,170,170,235,186,208,52,207,19,69,211,84,
+    85,213,117,93,104,154,231,137,162,105,170,170,235,202,50,240,60,81,52,77,85,
+    117,93,89,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,
+    0,0,112,224,0,0,16,96,4,157,100,84,89,132,141,38,92,120,0,2,66,
+    67,86,4,0,81,0,0,128,49,136,49,197,152,97,74,74,41,165,52,74,73,
+    41,37,148,72,74,72,169,164,148,73,73,173,181,214,50,41,169,181,214,90,37,
+    165,180,86,90,203,164,164,214,90,107,153,148,212,90,107,173,0,0,176,3,7,
+    0,176,3,11,33,66,67,86,2,0,121,0,0,8,66,74,49,230,156,115,212,
+    32,165,24,115,206,57,138,144,82,140,57,231,160,69,72,41,198,156,131,208,90,
+    171,20,99,206,65,72,41,85,138,49,231,156,163,148,42,197,152,115,206,81,74,
+    25,99,206,57,231,40,165,148,50,230,156,115,148,82,74,25,99,204,57,74,41,
+    165,140,49,230,156,0,0,160,2,7,0,128,0,27,69,54,39,24,9,10,66,
+    67,86,2,0,169,0,0,6,199,177,44,77,243,60,81,52,77,75,146,52,205,
+    243,68,209,52,85,213,146,36,77,243,60,81,52,77,85,165,105,154,38,138,166,
+    105,154,170,74,211,52,77,20,77,211,52,85,149,170,138,162,105,170,170,170,186,
+    46,215,21,69,211,84,85,215,117,93,0,0,0,0,0,0,0,0,0,64,0,
+    0,120,130,3,0,80,129,13,171,35,156,20,141,5,6,66,67,86,2,0,25,
+    0,0,136,49,8,33,99,16,66,198,32,164,16,66,72,41,133,144,0,0,128,
+    1,7,0,128,0,19,202,64,66,67,86,2,0,169,0,0,128,49,74,57,6,
+    161,148,214,42,132,24,115,78,74,74,173,101,8,49,230,156,148,148,90,139,26,
+    99,204,65,41,41,181,22,53,198,24,132,82,90,139,49,170,212,57,8,41,181,
+    22,99,84,169,115,16,82,106,45,198,40,165,41,165,164,212,98,140,81,74,83,
+    74,73,41,198,26,163,148,50,166,212,90,140,181,70,41,109,77,169,181,24,107,
+    141,82,74,39,99,108,181,246,220,156,115,78,198,24,107,204,185,0,0,132,6,
+    7,0,176,3,27,86,71,56,41,26,11,12,66,67,86,2,0,121,0,0,12,
+    82,74,49,198,24,99,78,41,197,24,99,140,49,167,148,82,140,49,198,152,83,
+    138,49,198,24,99,204,57,199,24,99,140,49,230,156,99,140,49,198,24,115,206,
+    49,198,24,99,140,57,231,24,99,140,49,198,156,115,206,49,198,24,99,206,57,
+    231,24,99,140,49,231,156,115,140,49,198,152,0,0,160,2,7,0,128,0,27,
+    69,54,39,24,9,10,66,67,86,2,0,225,0,0,128,49,76,57,231,24,116,
+    82,82,169,16,98,12,66,231,164,164,212,82,133,16,99,16,66,40,37,165,214,
+    154,231,156,131,16,66,41,41,181,214,60,231,156,132,16,74,73,169,181,230,90,
+    8,165,148,82,82,107,173,53,215,66,40,165,148,148,90,139,177,57,39,66,8,
+    169,164,212,90,139,77,41,17,66,72,41,181,214,98,76,74,201,88,74,74,173,
+    197,24,99,82,202,198,84,82,106,173,197,24,147,82,74,185,214,90,140,49,214,
+    152,148,82,202,181,150,90,139,181,214,164,148,82,62,199,22,99,172,181,38,165,
+    148,18,66,182,152,106,204,185,0,0,147,7,7,0,168,4,27,103,88,73,58,
+    43,28,13,14,66,67,86,2,0,185,1,0,12,66,140,49,230,156,115,206,57,
+    231,156,115,206,73,165,24,115,206,57,8,33,132,16,66,8,33,148,74,49,230,
+    156,115,206,65,8,33,132,16,66,40,25,115,206,57,8,33,132,16,66,8,33,
+    132,80,74,233,156,115,16,66,8,33,132,16,66,8,161,148,210,57,7,33,132,
+    16,66,8,33,132,16,66,41,165,115,206,65,8,33,132,16,66,8,33,132,82,
+    74,8,33,132,16,66,8,33,132,16,66,8,165,148,82,66,8,33,132,16,66,
+    8,33,132,16,74,41,165,132,16,66,8,33,148,16,66,8,33,148,82,74,9,
+    33,132,16,66,8,33,132,16,66,40,165,148,18,66,8,33,132,80,74,9,33,
+    132,80,74,41,165,148,16,66,8,165,148,16,66,8,161,148,82,74,41,161,148,
+    80,74,41,161,132,82,66,41,165,148,82,66,41,165,148,18,66,41,161,148,82,
+    74,41,165,148,82,74,41,33,132,18,66,8,165,148,82,74,41,165,148,82,74,
+    8,37,148,80,74,41,165,148,82,74,41,165,148,18,66,9,33,148,82,74,41,
+    165,148,82,66,8,33,132,18,66,41,165,148,82,74,41,165,148,82,66,9,161,
+    132,80,74,41,165,148,82,74,41,37,132,82,66,9,161,0,0,160,3,7,0,
+    128,0,35,42,45,196,78,51,174,60,2,71,20,50,76,64,1,66,67,86,2,
+    0,33,1,0,128,33,148,82,74,41,165,148,82,74,169,97,140,82,74,41,165,
+    148,82,74,41,53,142,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,
+    82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,
+    74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,
+    41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,
+    165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,
+    148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,149,82,
+    74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,
+    41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,0,192,232,12,
+    7,192,232,9,35,232,36,163,202,34,108,52,225,194,3,16,66,67,86,2,0,
+    105,1,0,128,49,76,49,198,152,115,16,74,41,37,165,74,41,231,160,115,76,
+    58,42,45,181,22,99,132,148,115,16,58,39,33,165,214,98,140,49,120,14,66,
+    8,33,148,208,74,107,177,197,24,68,7,33,132,16,74,105,173,181,24,99,12,
+    50,134,80,74,41,41,181,20,91,140,53,7,25,67,39,161,148,148,90,171,49,
+    199,154,131,16,162,132,146,82,107,173,197,88,107,206,65,8,209,65,71,169,181,
+    214,106,172,181,230,32,132,171,161,164,212,90,141,177,230,152,115,16,66,166,210,
+    81,136,45,198,24,99,173,53,8,33,132,106,41,197,88,99,174,49,247,28,132,
+    16,66,165,214,97,171,49,216,92,115,13,66,8,161,115,107,173,197,90,107,174,
+    193,6,33,132,240,193,181,216,98,172,181,214,90,131,16,66,8,97,107,108,49,
+    230,92,99,14,66,8,33,132,144,53,198,24,107,206,185,230,32,132,16,66,248,
+    28,107,140,181,230,90,123,16,66,8,33,124,143,53,198,90,115,205,181,0,128,
+    220,8,7,0,196,5,35,9,169,179,12,43,141,184,241,4,12,17,72,66,67,
+    86,1,0,49,0,0,129,0,0,0,0,0,0,0,8,1,0,0,0,8,0,
+    128,16,66,0,0,4,16,66,0,0,0,0,0,0,0,0,0,66,67,86,2,
+    0,100,0,0,12,197,154,115,17,74,72,202,65,41,45,39,101,41,165,156,163,
+    90,148,167,144,81,76,98,15,34,83,72,49,104,57,153,142,41,165,24,196,220,
+    74,232,152,50,72,114,140,169,83,202,8,102,65,247,210,57,166,160,37,35,100,
+    42,37,164,26,0,66,67,86,2,0,100,0,0,136,179,154,115,142,57,87,200,
+    73,107,177,213,88,42,164,28,164,20,99,236,144,65,202,73,138,181,100,200,32,
+    6,169,197,212,41,100,16,131,212,82,233,24,50,8,74,140,169,116,10,25,6,
+    185,198,86,66,199,28,180,86,99,75,37,116,16,0,66,67,86,4,0,81,0,
+    0,6,73,34,73,36,201,242,60,162,71,244,44,207,227,137,60,17,128,228,121,
+    52,141,231,73,158,71,243,120,30,0,73,244,120,30,77,147,60,145,231,209,52,
+    1,0,0,1,14,0,0,1,22,66,66,67,86,4,0,113,2,0,22,73,242,
+    60,146,228,121,36,201,243,104,154,40,66,20,45,77,19,61,158,39,138,60,77,
+    20,137,166,105,66,53,45,77,243,68,158,39,138,52,79,20,153,162,106,194,52,
+    61,209,51,77,166,233,170,76,83,85,185,178,44,67,118,61,79,52,77,166,169,
+    186,76,83,85,201,174,44,67,150,1,0,0,88,158,102,154,52,205,20,105,154,
+    105,18,69,211,132,105,90,154,103,154,52,77,52,105,154,105,18,69,211,132,105,
+    122,162,168,170,76,83,85,153,166,170,114,93,215,133,235,122,162,169,170,68,83,
+    85,153,166,170,114,93,215,133,235,2,0,0,144,60,205,52,105,154,105,210,52,
+    83,36,138,166,9,211,180,52,207,52,105,154,105,210,52,209,36,138,166,9,211,
+    244,76,209,85,153,166,171,50,69,85,165,186,174,11,215,245,68,83,117,153,166,
+    170,18,77,85,229,170,174,11,215,5,0,0,160,153,162,235,18,69,87,37,138,
+    170,202,52,93,21,170,171,137,166,235,18,69,213,37,138,170,202,52,85,23,170,
+    42,170,166,236,50,77,215,101,154,174,75,85,93,23,178,43,154,170,43,51,77,
+    215,101,154,174,75,117,93,23,174,12,0,0,0,0,0,0,0,0,0,81,53,
+    101,153,105,186,46,211,116,93,170,235,186,112,93,209,84,101,153,105,186,46,211,
+    116,93,174,42,187,112,93,1,0,0,3,14,0,0,1,38,148,129,66,67,86,
+    2,0,81,0,0,22,199,145,36,203,242,60,142,35,73,150,230,121,28,71,146,
+    52,205,243,72,146,101,105,154,40,194,178,52,77,20,161,105,158,39,138,208,52,
+    207,19,69,0,0,4,0,0,20,56,0,0,4,216,160,41,177,56,64,66,67,
+    86,2,0,33,1,0,22,199,145,36,203,210,52,207,19,69,211,52,77,146,35,
+    73,154,230,121,158,39,138,166,169,170,36,201,178,52,205,243,60,79,20,77,83,
+    85,89,146,101,105,154,231,137,162,105,170,170,234,194,178,52,205,243,68,209,52,
+    85,213,117,161,105,154,38,138,162,104,154,170,234,186,208,52,205,19,69,81,52,
+    77,85,117,93,104,154,231,137,162,105,170,170,235,202,50,240,60,81,52,77,85,
+    117,93,215,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,
+    0,0,112,224,0,0,16,96,4,157,100,84,89,132,141,38,92,120,0,2,66,
+    67,86,4,0,81,0,0,128,49,136,49,197,152,97,10,74,41,37,52,138,65,
+    41,37,148,8,66,72,169,164,148,73,72,45,181,214,50,40,41,181,214,90,37,
+    165,180,86,90,202,164,164,214,82,107,153,148,212,90,107,173,0,0,176,3,7,
+    0,176,3,11,33,66,67,86,2,0,121,0,0,12,66,74,49,198,24,99,20,
+    33,165,24,99,204,57,138,144,82,140,49,230,28,69,72,41,198,156,115,142,82,
+    170,20,99,204,57,71,41,85,138,49,230,156,163,148,42,197,24,99,206,81,74,
+    25,99,140,49,231,40,165,82,50,198,152,115,148,82,74,25,99,140,49,74,41,
+    165,140,49,198,152,0,0,160,2,7,0,128,0,27,69,54,39,24,9,10,66,
+    67,86,2,0,169,0,0,14,199,177,44,77,211,52,207,19,69,201,113,44,203,
+    243,68,81,20,77,211,114,28,203,242,60,81,20,69,211,100,89,154,230,121,162,
+    104,154,170,202,178,52,205,243,68,209,52,85,149,105,122,158,40,154,166,170,186,
+    46,85,245,60,81,52,77,85,117,93,0,0,0,0,0,0,0,0,0,64,0,
+    0,120,130,3,0,80,129,13,171,35,156,20,141,5,6,66,67,86,2,0,25,
+    0,0,140,49,8,33,99,16,66,198,32,132,16,66,8,33,132,144,0,0,128,
+    1,7,0,128,0,19,202,64,66,67,86,2,0,169,0,0,132,49,74,49,230,
+    156,148,148,42,99,148,114,14,66,41,173,85,6,41,229,28,132,82,90,107,150,
+    82,202,57,40,41,181,214,44,165,148,115,82,82,106,173,153,146,49,8,165,164,
+    212,90,83,41,99,16,74,73,169,181,230,156,8,33,164,212,90,140,205,57,17,
+    66,72,169,181,24,155,115,50,150,146,82,139,49,54,231,100,44,37,165,22,99,
+    108,206,57,229,90,107,49,214,156,148,82,202,181,214,98,172,181,0,0,132,6,
+    7,0,176,3,27,86,71,56,41,26,11,12,66,67,86,2,0,121,0,0,144,
+    82,74,49,198,24,99,76,41,165,24,99,140,49,166,148,82,140,49,198,152,83,
+    74,41,198,24,99,204,57,167,20,99,140,49,230,156,99,140,49,198,24,115,206,
+    49,198,24,99,140,57,231,24,99,140,49,198,156,115,206,49,198,24,99,206,57,
+    231,24,99,140,49,231,156,115,140,49,198,152,0,0,160,2,7,0,128,0,27,
+    69,54,39,24,9,10,66,67,86,2,0,225,0,0,128,49,76,57,231,28,132,
+    82,82,169,16,98,12,66,7,165,164,212,90,133,16,99,16,66,40,37,165,214,
+    162,230,156,131,16,66,41,41,181,22,61,231,28,132,16,74,73,169,181,168,90,
+    8,165,148,82,82,106,173,69,215,66,39,165,148,148,90,139,49,74,41,66,8,
+    41,165,212,90,139,209,57,17,66,40,41,165,214,98,108,206,201,88,74,74,173,
+    197,24,99,115,78,198,82,82,106,45,198,24,155,115,206,185,214,90,107,49,214,
+    218,156,115,206,181,150,98,139,177,214,230,156,115,186,199,22,99,141,181,54,231,
+    156,243,185,181,216,106,172,181,0,0,147,7,7,0,168,4,27,103,88,73,58,
+    43,28,13,14,66,67,86,2,0,185,1,0,140,82,140,49,230,156,115,206,57,
+    231,156,115,206,73,165,24,115,206,57,8,33,132,16,66,8,33,148,74,49,230,
+    156,115,16,66,8,33,132,16,66,40,25,115,206,57,7,33,132,16,66,8,33,
+    132,80,74,233,156,115,16,66,8,33,132,16,66,8,161,148,210,57,231,32,132,
+    16,66,8,33,132,16,66,41,165,115,206,65,8,33,132,16,66,8,33,132,82,
+    74,8,33,132,16,66,8,33,132,16,66,8,165,148,82,66,8,33,132,16,66,
+    8,33,132,16,74,41,165,132,16,66,8,33,132,16,66,8,33,148,82,74,9,
+    33,132,16,66,8,33,132,16,66,40,165,148,18,66,8,33,132,16,66,8,37,
+    132,80,74,41,165,148,16,66,8,161,132,16,66,8,161,148,82,74,41,33,132,
+    82,74,41,33,132,16,66,41,165,148,82,66,40,161,132,16,66,8,33,148,82,
+    74,41,165,148,18,66,41,33,132,16,66,8,165,148,82,74,41,165,148,82,66,
+    8,33,132,16,74,41,165,148,82,74,41,165,132,80,66,8,33,148,82,74,41,
+    165,148,82,66,40,37,132,18,66,40,165,148,82,74,41,165,132,80,66,8,33,
+    132,80,74,41,165,148,82,74,9,33,132,18,66,8,161,0,0,160,3,7,0,
+    128,0,35,42,45,196,78,51,174,60,2,71,20,50,76,64,1,66,67,86,2,
+    0,105,1,0,128,33,214,90,107,173,181,214,90,107,173,181,6,41,107,173,181,
+    214,90,107,173,181,214,90,163,148,181,214,90,107,173,181,214,90,107,173,181,212,
+    90,107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,
+    107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,
+    173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,
+    181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,
+    214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,214,
+    90,107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,
+    107,173,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,
+    41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,
+    165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,169,0,
+    236,130,13,7,192,232,9,35,9,169,179,12,43,141,184,241,4,12,17,72,66,
+    67,86,2,0,105,1,0,128,49,140,49,230,24,116,16,74,73,41,165,10,33,
+    231,32,132,78,66,42,173,197,22,99,132,144,115,16,66,40,37,165,214,98,139,
+    49,120,14,66,8,33,148,210,82,108,49,198,88,60,7,33,132,16,82,106,45,
+    198,24,99,12,178,133,80,74,41,41,181,214,98,140,181,22,217,66,40,165,148,
+    148,90,139,49,214,90,131,49,166,148,146,82,106,173,213,88,99,172,197,24,19,
+    74,72,169,181,214,98,204,181,214,98,124,172,37,165,212,98,140,177,198,88,107,
+    49,198,182,20,82,137,45,198,88,107,141,181,24,97,140,106,173,197,88,99,173,
+    177,214,90,140,49,194,149,22,98,138,181,214,90,115,45,70,8,99,115,139,49,
+    214,88,107,174,185,22,97,140,209,185,149,90,106,141,177,214,90,139,47,198,24,
+    97,107,172,53,198,90,107,206,197,24,35,132,176,181,182,26,107,205,53,215,98,
+    140,49,198,8,31,99,172,181,214,220,115,49,198,24,99,132,144,49,198,26,107,
+    206,185,0,128,220,8,7,0,196,5,35,9,169,179,12,43,141,184,241,4,12,
+    17,72,66,67,86,1,0,49,0,0,129,0,0,0,0,0,0,0,0,1,0,
+    0,2,8,0,128,16,0,8,0,132,0,66,0,0,0,0,0,0,0,0,0,
+    66,67,86,2,0,100,0,0,16,22,31,132,50,74,73,76,82,107,177,7,99,
+    41,198,32,148,26,148,199,20,82,12,90,18,30,99,10,41,71,57,137,142,41,
+    132,148,195,156,74,231,24,50,70,106,139,41,100,202,8,101,197,247,216,49,134,
+    28,246,96,116,10,161,147,24,0,66,67,86,2,0,81,0,0,144,113,208,65,
+    105,185,1,8,41,71,173,117,200,65,72,177,181,16,57,196,160,197,216,41,199,
+    24,164,148,66,6,25,99,76,90,41,41,116,140,65,74,45,182,20,58,72,177,
+    247,156,91,73,45,0,66,67,86,8,0,161,25,0,6,73,2,36,77,3,36,
+    77,3,0,0,0,0,0,0,0,201,211,0,77,20,1,77,20,1,0,0,0,
+    0,0,0,64,210,52,64,19,69,64,19,69,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,77,3,60,
+    83,4,52,81,4,0,0,0,0,0,0,0,77,20,1,209,84,1,81,53,1,
+    0,0,0,0,0,0,64,19,69,64,84,69,64,52,85,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,
+    77,3,52,81,4,60,81,4,0,0,0,0,0,0,0,77,20,1,81,53,1,
+    81,84,1,0,0,0,0,0,0,64,19,77,64,52,85,64,84,77,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,1,0,0,1,14,0,0,1,22,66,66,67,86,4,0,113,2,0,
+    6,199,177,44,0,0,112,36,73,179,0,0,192,145,44,77,3,0,0,75,211,
+    68,17,0,0,44,77,19,69,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,1,0,0,3,14,0,0,1,38,148,129,
+    66,67,86,2,0,81,0,0,6,197,240,52,128,101,1,44,11,160,105,0,77,
+    3,120,30,192,243,0,162,8,0,4,0,0,20,56,0,0,4,216,160,41,177,
+    56,64,66,67,86,2,0,81,0,0,6,69,177,44,203,242,60,104,154,166,137,
+    34,52,77,211,68,17,154,166,121,162,8,77,211,52,81,132,40,122,158,105,194,
+    19,61,207,52,97,154,162,104,154,64,20,77,83,0,0,64,129,3,0,64,128,
+    13,154,18,139,3,4,66,67,86,2,0,33,1,0,6,71,177,44,79,243,60,
+    207,19,69,211,84,85,104,154,231,137,162,40,138,166,105,170,42,52,205,243,68,
+    81,20,77,211,52,85,21,154,230,121,162,40,138,166,169,170,170,10,77,243,60,
+    81,20,69,211,84,85,85,133,231,137,162,40,154,166,105,170,170,235,194,243,68,
+    81,20,77,211,52,85,213,117,33,138,162,104,154,166,169,170,170,235,186,64,20,
+    77,211,52,85,85,85,93,23,136,162,105,154,166,170,186,174,44,3,81,52,77,
+    211,84,85,215,149,101,96,154,170,170,170,170,235,186,178,12,80,77,85,85,85,
+    215,149,101,128,170,186,170,235,186,174,44,3,84,85,117,93,215,149,101,25,224,
+    186,174,235,202,178,108,219,0,92,215,117,101,217,182,5,0,0,28,56,0,0,
+    4,24,65,39,25,85,22,97,163,9,23,30,128,66,67,86,4,0,81,0,0,
+    128,49,76,41,166,148,97,76,66,40,33,52,138,73,8,41,132,76,74,74,169,
+    149,84,65,72,37,165,82,42,8,169,164,84,74,70,165,165,148,82,202,32,148,
+    82,82,42,21,132,84,74,42,165,0,0,176,3,7,0,176,3,11,33,66,67,
+    86,2,0,121,0,0,4,33,74,49,198,24,115,82,74,165,24,115,206,57,41,
+    165,82,140,57,231,156,148,146,49,198,156,115,78,74,201,24,99,206,57,39,165,
+    116,204,57,231,156,147,82,50,230,156,115,206,73,41,157,115,206,57,231,164,148,
+    82,58,231,156,115,82,74,41,33,116,206,57,41,165,148,206,57,231,156,0,0,
+    160,2,7,0,128,0,27,69,54,39,24,9,10,66,67,86,2,0,169,0,0,
+    6,199,177,44,77,211,52,207,19,69,77,146,52,205,243,60,79,20,77,83,147,
+    44,77,243,60,207,19,69,211,228,121,158,39,138,162,104,154,170,202,243,60,79,
+    20,69,209,52,85,149,235,138,162,105,154,166,170,170,42,89,22,69,81,52,77,
+    85,85,93,152,166,105,170,170,170,186,46,76,83,20,85,85,117,93,23,178,108,
+    154,170,234,186,178,12,219,54,77,85,117,93,89,6,170,170,170,178,43,203,192,
+    117,85,213,117,101,89,0,0,120,130,3,0,80,129,13,171,35,156,20,141,5,
+    6,66,67,86,2,0,25,0,0,4,33,8,41,165,16,82,74,33,164,148,66,
+    72,41,133,144,0,0,128,1,7,0,128,0,19,202,64,66,67,86,4,0,113,
+    2,0,0,66,82,42,232,164,84,18,74,41,165,148,82,74,41,165,148,82,74,
+    41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,
+    165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,
+    148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,58,41,165,148,
+    82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,
+    74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,
+    41,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,
+    41,165,148,82,74,41,165,148,82,74,41,149,148,82,74,41,165,148,82,74,41,
+    165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,
+    148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,
+    82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,
+    74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,
+    41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,
+    165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,
+    148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,
+    82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,
+    74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,
+    41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,
+    165,148,82,74,41,165,148,82,74,41,165,148,82,74,169,0,0,221,8,7,0,
+    221,7,19,202,64,66,67,86,2,0,169,0,0,128,49,74,49,6,33,181,216,
+    42,132,24,115,78,66,107,173,85,8,49,230,156,132,150,82,236,25,115,14,66,
+    41,173,197,214,51,230,24,132,82,82,107,177,151,210,57,41,169,181,22,99,79,
+    165,99,84,82,106,41,198,222,123,41,165,164,20,91,140,189,247,20,82,200,177,
+    197,24,123,239,57,166,212,98,107,53,246,222,107,76,41,182,26,99,236,189,247,
+    30,99,108,53,214,218,123,239,61,198,214,106,205,177,0,0,204,6,7,0,136,
+    4,27,86,71,56,41,26,11,12,66,67,86,2,0,33,1,0,132,49,74,49,
+    198,152,115,206,57,231,156,148,146,49,230,156,131,16,66,8,33,148,82,50,198,
+    152,115,16,66,8,33,132,82,74,198,156,115,14,66,8,161,132,80,74,201,152,
+    115,208,65,8,161,132,80,74,41,157,115,14,58,8,33,132,18,74,41,37,99,
+    206,65,8,33,132,18,74,41,165,116,206,65,8,33,132,80,74,9,169,148,82,
+    58,7,33,132,80,66,8,165,148,146,82,8,33,132,16,66,9,161,164,82,82,
+    10,33,132,16,66,8,161,132,148,74,74,33,132,16,66,8,33,148,144,74,73,
+    41,165,16,66,8,33,132,16,74,41,41,165,20,74,40,33,132,80,66,73,37,
+    149,82,74,9,33,148,16,66,73,169,164,84,82,41,37,132,16,74,8,37,149,
+    148,82,42,169,148,80,66,8,165,0,0,128,3,7,0,128,0,35,232,36,163,
+    202,34,108,52,225,194,3,16,66,67,86,2,0,81,0,0,160,179,212,98,173,
+    189,2,72,41,104,53,136,6,65,6,49,247,14,57,229,36,6,33,42,198,28,
+    196,28,84,7,33,148,214,123,204,28,99,208,106,142,21,67,136,73,140,53,115,
+    72,49,40,45,0,66,67,86,2,0,81,0,0,144,129,18,74,106,177,1,136,
+    49,72,173,118,136,65,39,49,198,146,65,163,152,180,26,42,166,20,147,214,66,
+    7,153,98,142,90,74,41,116,204,73,107,177,182,20,66,104,45,8,221,91,73,
+    49,0,66,67,86,8,0,161,25,0,6,73,2,36,77,3,36,77,3,0,0,
+    0,0,0,0,0,201,211,0,77,20,1,205,19,1,0,0,0,0,0,0,64,
+    210,52,64,19,61,64,19,69,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,36,79,3,60,81,4,60,81,
+    4,0,0,0,0,0,0,0,77,20,1,209,52,1,209,52,1,0,0,0,0,
+    0,0,64,19,69,192,51,69,64,52,77,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,205,3,52,81,
+    4,60,81,4,0,0,0,0,0,0,0,77,20,1,209,52,1,81,52,1,0,
+    0,0,0,0,0,64,19,69,64,52,77,64,52,77,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+    0,0,1,14,0,0,1,22,66,66,67,86,4,0,113,2,0,6,199,177,44,
+    0,0,112,36,73,211,0,0,192,145,36,77,3,0,0,75,211,68,17,0,0,
+    52,77,19,69,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,1,0,0,3,14,0,0,1,38,148,129,66,67,86,2,
+    0,81,0,0,6,69,209,52,32,57,154,6,36,73,211,128,165,121,30,192,243,
+    0,162,9,16,69,128,170,2,0,1,0,0,5,14,0,0,1,54,104,74,44,
+    14,16,66,67,86,2,0,81,0,0,6,71,177,44,77,19,69,146,164,105,158,
+    38,138,36,73,211,60,79,20,105,154,231,121,158,105,194,243,60,207,52,33,138,
+    162,168,170,16,69,81,84,85,152,166,105,170,42,16,69,85,21,0,0,80,224,
+    0,0,16,96,131,166,196,226,0,1,66,67,86,2,0,33,1,0,6,199,177,
+    44,207,243,60,207,19,69,211,84,85,150,165,105,158,39,138,162,104,154,166,170,
+    170,36,75,211,60,79,20,69,209,52,77,85,85,105,154,231,121,158,40,138,162,
+    105,170,170,235,194,243,60,79,20,69,209,52,85,213,117,225,121,162,104,154,166,
+    169,170,170,234,186,240,60,81,52,77,211,84,85,85,117,93,136,162,40,154,166,
+    105,170,170,235,186,50,16,69,211,52,77,85,117,93,89,6,162,104,154,170,170,
+    170,174,43,203,64,20,77,83,53,85,213,117,101,25,152,166,105,170,170,235,186,
+    178,44,3,76,83,85,93,215,149,101,25,160,170,174,235,186,178,108,219,0,85,
+    117,85,215,149,101,89,6,184,174,235,202,178,44,219,54,0,215,117,93,89,182,
+    109,1,0,0,7,14,0,0,1,70,208,73,70,149,69,216,104,194,133,7,32,
+    66,67,86,4,0,81,0,0,128,49,76,41,166,148,97,76,66,72,33,52,140,
+    73,8,41,132,76,74,73,41,149,82,65,72,169,164,82,42,8,169,164,84,74,
+    70,37,165,148,82,170,32,164,82,82,42,21,132,84,74,42,169,0,0,176,3,
+    7,0,176,3,11,33,66,67,86,2,0,121,0,0,132,49,74,49,198,24,115,
+    16,33,165,24,115,206,57,136,144,82,140,57,231,156,100,140,49,198,156,115,78,
+    74,201,24,99,206,57,39,165,116,206,57,231,156,147,82,58,231,156,115,206,73,
+    41,157,115,206,57,231,164,148,82,58,231,156,115,82,74,41,33,116,206,57,41,
+    165,148,206,57,231,156,0,0,160,2,7,0,128,0,27,69,54,39,24,9,10,
+    66,67,86,2,0,169,0,0,6,199,177,44,77,211,52,207,19,69,77,146,52,
+    205,243,60,79,20,77,83,179,36,77,243,60,207,19,69,211,228,121,158,39,138,
+    162,104,154,170,202,243,60,79,20,69,209,52,85,149,235,138,162,105,154,166,170,
+    170,42,89,22,69,81,52,77,85,85,93,136,166,105,170,170,171,186,46,76,83,
+    20,85,213,117,93,23,178,108,154,170,234,186,178,12,219,54,77,85,117,93,89,
+    6,170,171,170,178,43,203,192,117,85,85,118,109,91,0,0,120,130,3,0,80,
+    129,13,171,35,156,20,141,5,6,66,67,86,2,0,25,0,0,132,49,198,40,
+    132,16,82,8,33,164,148,66,72,41,133,144,0,0,128,1,7,0,128,0,19,
+    202,64,66,67,86,2,0,81,0,0,0,33,148,82,74,41,97,138,82,74,41,
+    53,142,81,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,169,181,
+    214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,0,0,
+    221,9,7,0,221,7,27,52,37,22,7,8,66,67,86,2,0,169,0,0,128,
+    49,74,49,6,161,164,214,42,132,24,115,78,74,75,173,85,8,49,230,156,148,
+    150,90,11,26,115,14,66,41,173,197,88,52,230,24,132,82,90,107,49,153,210,
+    57,41,41,181,22,107,82,165,99,82,82,106,45,182,164,148,41,165,164,212,90,
+    140,73,41,21,82,168,45,182,24,147,51,178,166,212,90,140,53,54,231,116,76,
+    37,166,24,107,108,206,57,39,107,107,49,198,216,156,115,78,198,214,122,204,177,
+    0,0,204,6,7,0,136,4,27,86,71,56,41,26,11,12,66,67,86,2,0,
+    33,1,0,4,66,74,49,198,152,115,206,57,231,156,84,138,49,198,156,131,16,
+    66,8,33,148,74,49,230,152,115,16,66,8,33,132,146,49,198,156,115,16,66,
+    8,33,132,80,74,201,152,115,208,65,8,161,132,80,74,73,157,115,14,66,8,
+    33,132,18,74,41,165,115,206,65,8,33,132,16,74,73,165,116,14,66,8,33,
+    132,16,66,41,165,148,148,58,7,33,132,16,66,8,37,165,148,82,8,33,132,
+    16,66,9,37,164,84,82,10,33,132,16,66,8,161,132,148,74,74,33,132,16,
+    66,8,33,148,144,74,74,41,165,16,74,8,33,132,16,74,42,41,165,84,74,
+    41,33,132,16,66,73,41,165,148,66,9,33,132,16,66,72,169,164,148,74,41,
+    33,132,16,66,8,37,149,148,82,74,41,132,16,66,8,161,0,0,128,3,7,
+    0,128,0,35,232,36,163,202,34,108,52,225,194,3,16,66,67,86,2,0,81,
+    0,0,148,178,24,107,15,194,17,200,49,104,57,135,6,65,6,173,23,85,49,
+    163,28,213,98,34,133,16,147,26,76,196,152,98,18,123,138,24,99,78,90,142,
+    21,67,136,65,139,189,131,74,49,40,45,0,66,67,86,2,0,81,0,0,16,
+    130,18,66,73,45,2,72,41,38,173,134,72,57,39,173,214,18,57,164,28,197,
+    26,34,166,148,147,150,66,6,153,82,76,74,9,45,116,140,73,75,41,182,18,
+    58,72,169,230,28,83,8,41,0,66,67,86,8,0,161,25,0,14,199,1,36,
+    205,2,36,75,3,0,0,0,0,0,0,0,73,211,0,205,243,0,205,243,0,
+    0,0,0,0,0,0,64,210,52,64,243,60,64,243,60,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,
+    77,3,52,207,3,52,207,3,0,0,0,0,0,0,0,205,243,0,79,52,1,
+    79,20,1,0,0,0,0,0,0,192,242,60,192,19,61,192,19,69,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,28,77,3,52,207,3,52,79,4,0,0,0,0,0,0,0,203,243,0,
+    207,20,1,207,19,1,0,0,0,0,0,0,64,243,60,192,19,69,192,19,69,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,1,0,0,1,14,0,0,1,22,66,66,67,86,4,0,
+    113,2,0,14,197,177,36,0,0,112,28,199,178,0,0,192,113,36,203,2,0,
+    0,203,178,60,15,0,0,44,203,242,60,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,3,14,0,0,1,
+    38,148,129,66,67,86,2,0,81,0,0,6,197,208,52,32,203,150,5,92,150,
+    5,208,52,128,166,1,60,17,224,121,0,213,4,0,2,0,0,10,28,0,0,
+    2,108,208,148,88,28,32,66,67,86,2,0,81,0,0,6,69,177,36,203,242,
+    60,104,154,166,137,34,52,77,211,68,17,154,230,121,166,9,77,243,60,211,132,
+    40,122,158,105,194,243,60,207,52,97,154,162,168,170,64,20,85,85,0,0,64,
+    129,3,0,64,128,13,154,18,139,3,4,66,67,86,2,0,33,1,0,6,71,
+    177,44,77,243,60,207,19,69,211,84,85,104,154,231,137,162,40,154,166,105,170,
+    42,52,205,243,68,81,20,77,211,52,85,21,154,230,121,162,40,138,166,169,170,
+    170,10,77,243,60,81,20,69,211,84,85,87,133,231,137,162,104,154,166,105,170,
+    170,235,194,243,68,209,20,77,211,52,85,213,117,33,138,162,104,154,166,169,170,
+    174,235,186,64,20,77,211,52,85,213,117,93,23,136,162,105,154,170,170,186,174,
+    44,3,81,52,77,211,84,85,215,149,101,96,154,166,169,170,174,235,186,178,12,
+    48,77,85,117,93,215,149,101,128,170,186,174,235,202,178,44,3,84,85,85,93,
+    87,150,101,25,224,186,174,235,186,178,108,219,0,92,215,117,101,217,182,5,0,
+    0,28,56,0,0,4,24,65,39,25,85,22,97,163,9,23,30,128,66,67,86,
+    4,0,81,0,0,128,49,76,41,166,148,97,76,66,72,33,52,140,73,8,41,
+    132,74,74,74,41,149,82,65,72,165,164,82,42,8,169,164,84,74,70,37,165,
+    212,82,202,32,164,82,82,42,21,132,82,74,43,169,0,0,176,3,7,0,176,
+    3,11,33,66,67,86,2,0,121,0,0,4,33,74,49,198,152,115,82,74,165,
+    24,115,206,57,41,165,82,140,57,231,156,148,146,49,198,156,115,78,74,201,24,
+    99,206,57,39,165,100,204,57,231,156,147,82,50,230,156,115,206,73,41,157,115,
+    206,57,231,164,148,82,58,231,156,115,82,74,41,33,116,206,57,41,165,148,206,
+    57,231,156,0,0,160,2,7,0,128,0,27,69,54,39,24,9,10,66,67,86,
+    2,0,169,0,0,6,199,177,44,77,211,52,207,51,69,77,178,52,205,243,60,
+    79,20,77,83,147,36,77,243,60,207,19,69,211,228,121,158,39,138,162,104,154,
+    170,201,243,60,79,20,69,209,52,85,149,235,138,162,104,154,166,170,170,42,89,
+    22,69,81,52,77,85,85,85,152,166,105,170,170,171,186,46,76,211,20,85,213,
+    85,101,23,178,108,154,170,234,186,178,12,219,54,77,85,117,93,89,6,170,171,
+    170,174,107,203,192,85,85,85,54,109,89,0,0,120,130,3,0,80,129,13,171,
+    35,156,20,141,5,6,66,67,86,2,0,25,0,0,4,33,8,41,165,16,82,
+    74,33,164,148,66,72,41,133,144,0,0,128,1,7,0,128,0,19,202,64,66,
+    67,86,2,0,169,0,0,128,33,82,74,41,165,148,82,26,167,164,148,82,74,
+    41,165,52,142,73,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,
+    165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,
+    148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,
+    82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,
+    74,41,165,148,82,74,41,165,0,192,165,10,7,0,221,7,27,86,71,56,41,
+    26,11,12,66,67,86,2,0,169,0,0,128,49,10,49,6,161,148,214,42,132,
+    24,115,78,74,75,173,85,8,49,230,156,148,148,90,203,25,115,14,66,74,173,
+    197,150,59,231,24,132,82,90,139,177,167,210,57,41,41,181,22,99,79,41,116,
+    84,82,106,45,182,222,123,73,37,181,214,90,140,189,247,20,82,168,173,181,24,
+    123,239,173,166,214,90,140,53,246,222,115,108,37,150,88,99,236,189,247,30,107,
+    139,177,197,216,123,239,61,182,150,106,203,177,0,0,204,6,7,0,136,4,27,
+    86,71,56,41,26,11,12,66,67,86,2,0,33,1,0,132,49,74,41,197,152,
+    115,206,57,231,156,148,146,49,198,156,131,16,66,8,33,148,82,50,230,152,115,
+    16,66,8,33,132,82,74,198,156,115,16,66,8,161,132,80,74,201,152,115,208,
+    65,8,161,132,80,74,74,157,115,14,66,8,33,148,16,74,41,165,115,206,65,
+    8,33,132,16,74,73,41,117,14,66,8,33,132,16,66,41,165,164,148,58,7,
+    33,132,18,66,8,33,165,148,82,8,33,132,16,66,8,33,164,82,82,10,33,
+    132,16,66,8,165,148,146,74,74,33,132,16,66,8,161,148,80,74,74,41,165,
+    16,66,9,33,132,16,74,74,41,165,84,74,41,33,132,16,66,73,41,165,148,
+    66,9,33,132,18,66,72,41,165,148,82,41,33,132,16,66,9,41,149,148,82,
+    42,41,132,16,66,8,161,0,0,128,3,7,0,128,0,35,232,36,163,202,34,
+    108,52,225,194,3,16,66,67,86,2,0,81,0,0,148,195,22,107,238,189,17,
+    134,41,71,49,151,198,56,229,168,6,21,41,164,156,213,160,34,164,16,147,216,
+    91,197,28,115,18,115,236,28,99,78,90,206,25,67,136,65,171,185,115,74,49,
+    39,41,0,66,67,86,2,0,81,0,0,144,113,18,66,73,173,17,72,41,39,
+    41,118,70,57,6,173,213,82,57,131,20,164,22,34,133,144,130,148,66,6,21,
+    66,76,74,9,169,99,138,65,74,45,150,18,58,72,41,231,22,83,40,41,0,
+    66,67,86,8,0,161,25,0,6,73,2,36,77,3,36,77,3,0,0,0,0,
+    0,0,0,201,211,0,77,20,1,205,19,1,0,0,0,0,0,0,64,210,52,
+    64,19,61,64,19,69,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,36,79,3,60,81,4,60,81,4,0,
+    0,0,0,0,0,0,77,20,1,81,52,1,209,52,1,0,0,0,0,0,0,
+    64,19,69,192,51,69,64,52,77,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,205,3,60,81,4,60,
+    81,4,0,0,0,0,0,0,0,77,20,1,209,52,1,79,52,1,0,0,0,
+    0,0,0,64,19,69,64,52,77,64,52,69,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,
+    1,14,0,0,1,22,66,66,67,86,4,0,113,2,0,14,197,177,44,0,0,
+    112,28,199,178,0,0,192,113,28,203,2,0,0,203,178,68,17,0,0,44,75,
+    19,69,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,1,0,0,3,14,0,0,1,38,148,129,66,67,86,2,0,81,
+    0,0,6,69,209,52,32,73,150,5,36,73,211,128,166,105,26,64,211,0,158,
+    8,240,60,128,105,2,0,1,0,0,5,14,0,0,1,54,104,74,44,14,16,
+    66,67,86,2,0,81,0,0,6,69,177,44,77,19,69,150,165,105,158,39,138,
+    44,75,211,60,79,20,105,154,231,121,158,105,194,243,60,207,52,225,121,162,168,
+    170,16,69,81,84,85,152,166,105,170,42,16,69,85,21,0,0,80,224,0,0,
+    16,96,131,166,196,226,0,1,66,67,86,2,0,33,1,0,14,69,177,44,77,
+    243,60,207,19,69,211,84,85,146,100,89,158,39,138,162,104,154,166,169,170,36,
+    201,178,60,79,20,69,209,52,77,83,85,105,154,166,121,158,40,138,162,105,170,
+    170,235,66,211,60,79,20,69,209,52,85,213,117,225,121,158,39,138,166,105,170,
+    170,234,186,240,60,207,19,69,211,52,77,85,117,93,136,162,40,154,166,105,170,
+    170,235,186,46,16,69,211,52,77,85,117,93,89,6,162,40,138,166,169,170,174,
+    43,203,64,20,69,209,52,85,213,117,101,25,136,162,105,170,170,235,186,174,44,
+    3,76,83,85,93,215,117,101,25,160,170,170,234,186,178,44,203,0,85,85,85,
+    215,149,101,89,6,168,170,235,186,174,44,219,54,0,215,117,93,89,182,109,1,
+    0,0,7,14,0,0,1,70,208,73,70,149,69,216,104,194,133,7,32,66,67,
+    86,4,0,81,0,0,128,49,76,41,166,148,97,76,66,72,33,52,140,73,8,
+    41,132,76,74,73,41,149,82,65,72,169,164,82,42,8,169,164,84,74,70,41,
+    165,148,82,170,32,164,82,82,42,21,132,82,74,42,169,0,0,176,3,7,0,
+    176,3,11,33,66,67,86,2,0,121,0,0,132,49,74,49,198,152,115,18,33,
+    165,24,115,206,57,137,144,82,140,57,231,156,100,140,49,231,156,115,78,74,201,
+    24,99,206,57,39,165,100,204,57,231,156,147,82,50,230,156,115,206,73,41,157,
+    115,206,57,232,164,148,82,58,231,156,115,82,74,41,33,116,206,57,41,165,148,
+    206,57,231,156,0,0,160,2,7,0,128,0,27,69,54,39,24,9,10,66,67,
+    86,2,0,169,0,0,6,199,177,44,77,211,52,207,19,69,77,146,52,205,243,
+    60,79,20,77,83,147,44,77,243,60,207,19,69,213,228,121,158,39,138,162,104,
+    154,170,202,243,60,79,20,69,209,52,85,149,235,138,162,105,154,166,170,170,42,
+    89,22,69,81,52,77,85,117,93,136,166,104,170,170,171,202,46,76,83,20,85,
+    213,117,101,23,178,108,154,170,234,186,178,12,219,54,77,85,117,93,89,6,170,
+    171,170,174,108,203,192,117,85,85,118,109,89,0,0,120,130,3,0,80,129,13,
+    171,35,156,20,141,5,6,66,67,86,2,0,25,0,0,132,49,6,41,132,16,
+    82,8,33,164,16,66,72,41,133,144,0,0,128,1,7,0,128,0,19,202,64,
+    66,67,86,2,0,169,0,0,0,33,24,99,140,49,198,24,19,165,48,198,24,
+    99,140,49,54,142,97,140,49,198,24,99,140,49,198,24,99,140,49,198,24,99,
+    140,49,198,24,99,140,49,198,24,99,140,49,198,24,99,140,49,198,24,99,140,
+    49,198,24,99,140,49,198,24,99,140,49,198,24,99,140,49,198,24,99,140,49,
+    198,24,99,140,49,198,24,99,140,49,198,24,99,140,49,198,24,99,140,49,198,
+    24,99,140,49,198,24,99,140,177,0,192,165,10,7,0,221,7,27,86,71,56,
+    41,26,11,12,66,67,86,2,0,169,0,0,128,49,74,49,6,161,164,214,42,
+    132,24,115,76,74,74,173,85,8,49,230,156,148,148,90,235,25,115,14,66,74,
+    173,197,24,52,230,24,132,84,90,139,49,169,210,57,41,41,181,22,99,82,41,
+    100,84,82,106,45,182,164,148,41,165,164,214,90,172,69,41,21,82,136,173,181,
+    24,147,83,50,167,212,90,140,53,22,229,116,108,37,150,24,99,109,206,57,39,
+    107,107,177,197,216,156,115,78,182,214,106,171,177,0,0,204,6,7,0,136,4,
+    27,86,71,56,41,26,11,12,66,67,86,2,0,33,1,0,4,66,74,49,197,
+    152,115,206,57,231,156,84,138,49,198,156,131,16,66,8,33,148,74,49,230,156,
+    115,16,66,8,33,132,146,49,198,156,115,16,66,8,33,132,80,74,201,152,115,
+    16,66,8,33,132,16,74,74,157,115,14,66,8,33,148,18,74,41,165,115,206,
+    65,8,33,132,16,74,73,165,116,14,66,8,33,132,16,66,9,165,148,148,58,
+    7,33,132,16,66,8,33,165,148,82,8,33,132,16,66,9,37,164,148,82,10,
+    29,132,16,66,8,165,132,148,74,74,33,132,16,66,8,161,148,144,82,74,41,
+    165,16,74,8,33,148,80,74,42,41,165,20,74,41,33,132,16,66,73,41,165,
+    148,66,8,33,132,16,74,72,169,164,148,82,41,33,132,16,66,9,37,149,148,
+    82,74,41,132,18,66,8,161,0,0,128,3,7,0,128,0,35,232,36,163,202,
+    34,108,52,225,194,3,16,66,67,86,2,0,81,0,0,12,195,90,115,47,198,
+    17,200,49,104,57,151,6,73,229,40,7,23,49,164,28,213,160,34,165,144,130,
+    24,92,197,20,82,206,106,205,156,82,12,82,173,29,84,72,65,138,189,148,76,
+    49,39,41,0,66,67,86,2,0,81,0,0,140,97,142,57,105,65,1,74,49,
+    39,45,103,10,66,72,173,6,79,65,197,32,197,160,41,200,152,131,150,59,39,
+    29,99,76,106,40,173,116,206,73,77,49,199,150,82,235,193,24,229,140,239,77,
+    0,66,67,86,8,0,161,25,0,6,199,1,36,77,3,36,77,3,0,0,0,
+    0,0,0,0,201,243,0,79,20,1,77,52,1,0,0,0,0,0,0,64,242,
+    60,64,51,69,192,51,69,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,36,207,3,60,211,4,60,209,4,
+    0,0,0,0,0,0,0,205,52,1,81,84,1,83,85,1,0,0,0,0,0,
+    0,64,51,77,64,84,69,192,84,85,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,207,3,60,211,4,
+    60,211,4,0,0,0,0,0,0,0,205,52,1,83,85,1,81,84,1,0,0,
+    0,0,0,0,64,51,77,192,84,85,64,84,69,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,
+    0,1,14,0,0,1,22,66,66,67,86,4,0,113,2,0,6,199,209,44,0,
+    0,112,36,73,211,0,0,192,145,36,77,3,0,0,75,211,68,17,0,0,44,
+    77,19,69,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,1,0,0,3,14,0,0,1,38,148,129,66,67,86,2,0,
+    81,0,0,6,67,209,52,128,101,1,44,11,160,105,0,77,3,136,30,192,243,
+    0,166,9,0,4,0,0,20,56,0,0,4,216,160,41,177,56,64,66,67,86,
+    2,0,81,0,0,6,69,177,44,203,242,60,88,150,166,137,34,44,75,211,68,
+    17,154,230,121,166,9,77,243,60,211,132,40,138,162,105,66,20,69,209,52,97,
+    154,166,169,170,192,52,85,85,0,0,64,129,3,0,64,128,13,154,18,139,3,
+    4,66,67,86,2,0,33,1,0,6,71,177,44,77,243,60,207,19,69,211,52,
+    77,104,154,231,137,162,40,154,166,105,170,42,52,205,243,68,81,20,77,211,52,
+    85,21,154,230,121,162,40,138,166,169,170,170,11,77,243,60,81,20,69,211,84,
+    85,85,133,231,137,162,40,154,166,105,170,170,235,194,243,68,81,20,77,211,84,
+    85,213,117,33,138,166,104,154,166,169,170,170,234,186,64,20,77,211,52,85,213,
+    117,93,23,136,162,105,154,170,170,186,174,44,3,81,52,77,211,84,85,215,149,
+    101,96,154,170,169,170,170,43,187,178,12,80,77,85,117,93,215,149,101,128,170,
+    186,174,235,202,178,108,3,84,213,117,93,87,150,101,27,224,186,174,44,203,178,
+    108,219,0,92,87,118,101,217,182,5,0,0,28,56,0,0,4,24,65,39,25,
+    85,22,97,163,9,23,30,128,66,67,86,4,0,81,0,0,128,49,76,41,166,
+    148,81,74,66,72,33,52,74,73,8,37,132,76,74,74,169,165,148,65,72,169,
+    164,82,50,8,169,164,84,74,38,37,165,212,82,202,32,164,82,82,41,25,132,
+    84,74,42,165,0,0,176,3,7,0,176,3,11,33,66,67,86,2,0,121,0,
+    0,128,49,74,49,230,156,115,82,74,166,156,115,206,57,41,37,83,140,57,231,
+    156,148,146,49,231,156,115,78,74,201,152,115,206,57,39,165,116,206,57,8,33,
+    148,82,58,231,28,132,16,74,41,33,132,16,66,8,165,148,82,66,8,33,132,
+    82,74,41,33,132,16,66,41,165,148,16,66,8,161,0,0,160,2,7,0,128,
+    0,27,69,54,39,24,9,10,66,67,86,2,0,169,0,0,6,199,177,44,77,
+    243,60,81,52,77,75,146,52,205,243,60,79,20,85,85,147,36,77,243,60,207,
+    19,77,85,229,121,158,39,138,162,104,154,170,202,243,60,79,20,69,209,52,85,
+    149,235,138,162,104,154,166,170,170,46,89,22,69,81,52,77,85,85,93,152,166,
+    105,170,170,235,186,50,76,211,52,85,213,117,101,23,182,173,154,170,235,202,178,
+    13,93,87,85,87,117,93,91,6,174,235,186,178,108,219,64,150,93,87,150,101,
+    91,0,0,120,130,3,0,80,129,13,171,35,156,20,141,5,6,66,67,86,2,
+    0,25,0,0,4,33,8,41,165,16,82,74,33,164,148,66,72,41,133,144,0,
+    0,128,1,7,0,128,0,19,202,64,66,67,86,4,0,113,2,0,0,99,148,
+    58,74,41,53,148,80,74,41,165,148,82,74,41,165,146,82,74,41,165,148,82,
+    74,41,165,148,82,74,41,165,146,82,74,41,165,148,82,74,41,165,148,82,74,
+    41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,
+    165,148,82,74,41,165,148,82,74,41,165,148,50,74,41,165,148,82,74,41,165,
+    148,82,74,41,165,148,82,73,41,165,148,82,74,41,165,148,82,74,41,165,148,
+    82,42,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,
+    74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,
+    41,165,148,82,74,41,117,148,82,74,41,165,148,82,74,41,165,148,82,74,41,
+    165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,
+    148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,
+    82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,
+    74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,
+    41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,
+    165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,
+    148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,
+    82,74,41,165,148,82,74,41,165,148,82,74,41,165,148,82,106,173,181,214,90,
+    107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,
+    173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,181,214,90,107,173,
+    181,214,90,107,173,181,214,90,107,173,0,0,221,8,7,0,221,7,19,202,64,
+    66,67,86,2,0,169,0,0,128,49,74,57,7,165,164,148,42,132,24,115,14,
+    74,72,169,69,8,49,230,160,148,214,106,204,25,115,14,74,74,165,149,148,51,
+    231,28,132,148,98,107,49,151,210,57,41,173,165,90,74,78,169,115,82,90,140,
+    53,199,156,115,41,165,180,22,91,44,57,231,82,82,137,41,198,28,115,206,49,
+    150,148,82,43,53,229,92,107,44,165,165,24,107,205,57,231,156,82,74,45,229,
+    150,115,206,185,181,148,106,139,181,0,0,204,6,7,0,136,4,27,86,71,56,
+    41,26,11,12,66,67,86,2,0,33,1,0,136,33,74,49,230,28,132,16,66,
+    8,161,164,84,41,198,156,131,16,66,8,33,148,82,42,197,152,115,16,66,8,
+    33,132,82,74,198,152,115,14,66,8,33,148,80,82,201,20,99,206,65,8,33,
+    132,80,74,73,25,115,206,57,8,33,132,16,66,41,37,99,206,57,7,33,132,
+    16,66,73,41,117,206,57,231,32,132,16,66,8,169,148,148,58,231,32,132,16,
+    66,9,165,148,146,82,8,33,132,16,66,8,33,164,84,82,10,33,132,16,66,
+    8,165,148,146,74,74,33,132,16,66,8,33,132,144,74,73,41,165,16,66,8,
+    33,132,82,74,74,37,165,20,74,9,33,132,16,66,73,41,165,148,66,8,33,
+    132,16,66,72,41,165,148,82,41,33,132,16,66,8,41,165,146,82,74,41,132,
+    80,66,8,161,0,0,128,3,7,0,128,0,35,232,36,163,202,34,108,52,225,
+    194,3,16,66,67,86,2,0,81,0,0,36,180,220,98,175,61,3,72,51,137,
+    189,135,70,121,71,189,247,218,48,15,173,246,94,34,166,161,213,156,99,7,181,
+    180,88,115,12,33,83,142,90,171,157,67,6,57,106,189,148,10,41,7,37,0,
+    66,67,86,2,0,81,0,0,8,113,206,57,105,53,17,138,49,39,173,103,138,
+    65,39,173,246,78,57,131,24,164,152,41,135,20,131,84,59,39,25,83,78,98,
+    72,45,132,204,73,43,49,167,84,66,137,177,7,155,107,172,65,0,66,67,86,
+    8,0,161,25,0,6,71,2,36,77,3,36,77,3,0,0,0,0,0,0,0,
+    201,243,0,79,20,1,205,19,1,0,0,0,0,0,0,64,242,60,64,19,61,
+    192,19,69,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,36,207,3,60,83,4,60,81,4,0,0,0,0,
+    0,0,0,205,20,1,81,52,1,209,52,1,0,0,0,0,0,0,64,19,69,
+    192,51,69,64,52,77,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,36,207,3,60,81,4,60,209,4,0,
+    0,0,0,0,0,0,77,20,1,209,52,1,79,52,1,0,0,0,0,0,0,
+    64,19,77,64,52,77,64,52,69,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,14,0,
+    0,1,22,66,66,67,86,4,0,113,2,0,6,199,177,44,0,0,112,36,73,
+    211,0,0,192,145,36,77,3,0,0,75,211,68,17,0,0,52,77,19,69,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,1,0,0,3,14,0,0,1,38,148,129,66,67,86,2,0,81,0,0,6,
+    197,209,52,224,56,154,6,28,73,211,128,165,121,30,192,243,0,162,8,48,69,
+    128,170,2,0,1,0,0,5,14,0,0,1,54,104,74,44,14,16,66,67,86,
+    2,0,81,0,0,6,71,177,44,77,19,69,146,164,105,158,38,138,36,73,211,
+    60,79,20,105,154,231,121,158,105,194,243,60,207,52,33,138,162,104,154,16,69,
+    81,52,77,152,166,105,170,42,48,77,85,21,0,0,80,224,0,0,16,96,131,
+    166,196,226,0,1,66,67,86,2,0,33,1,0,6,199,177,44,207,19,69,207,
+    19,69,211,84,85,150,165,105,158,39,138,162,104,154,170,234,186,44,73,211,60,
+    79,20,69,209,52,85,213,117,105,154,166,121,158,40,138,162,105,170,170,235,66,
+    211,60,79,20,77,83,85,85,213,117,225,121,162,104,154,166,169,170,174,235,186,
+    240,60,81,52,77,211,84,85,215,117,93,136,162,40,154,166,105,170,170,235,202,
+    50,16,69,211,52,77,85,117,93,89,6,162,104,154,170,234,186,178,44,203,64,
+    20,77,83,85,93,215,149,101,25,152,166,170,170,170,235,202,178,109,3,84,85,
+    85,93,87,150,109,27,160,170,174,43,203,178,108,219,0,85,117,93,89,150,101,
+    219,6,184,174,43,203,178,109,219,54,0,215,149,101,219,182,109,1,0,0,7,
+    14,0,0,1,70,208,73,70,149,69,216,104,194,133,7,32,66,67,86,4,0,
+    81,0,0,128,49,76,41,166,148,97,74,66,72,33,52,138,73,8,41,132,76,
+    74,73,41,165,82,65,72,165,164,82,42,8,169,164,84,74,70,41,165,212,82,
+    202,32,164,82,90,41,25,132,84,74,42,165,0,0,176,3,7,0,176,3,11,
+    33,66,67,86,2,0,121,0,0,132,49,8,49,198,152,115,18,33,165,24,115,
+    206,57,137,144,82,140,57,231,156,100,140,49,231,156,115,78,74,201,24,99,206,
+    57,39,165,116,206,57,231,156,147,82,58,231,156,115,206,73,41,157,115,206,57,
+    8,165,148,82,58,231,28,132,82,74,41,33,132,208,65,41,165,148,14,58,7,
+    157,0,0,160,2,7,0,128,0,27,69,54,39,24,9,10,66,67,86,2,0,
+    169,0,0,6,199,177,44,77,211,52,81,52,77,77,146,52,205,243,60,207,20,
+    85,83,147,36,77,243,60,207,19,77,85,229,121,158,39,138,162,104,154,170,202,
+    243,60,79,20,69,209,52,85,149,235,138,162,104,154,166,170,186,46,89,22,69,
+    81,52,77,85,117,93,152,166,105,170,170,235,186,50,76,211,52,85,213,117,93,
+    23,182,173,170,170,234,202,178,12,219,86,77,85,117,93,89,6,174,235,186,178,
+    44,219,64,118,93,87,150,101,91,0,0,120,130,3,0,80,129,13,171,35,156,
+    20,141,5,6,66,67,86,2,0,25,0,0,132,49,6,41,132,16,82,8,33,
+    164,16,66,72,41,133,144,0,0,128,1,7,0,128,0,19,202,64,66,67,86,
+    2,0,81,0,0,128,49,150,98,172,181,97,140,98,173,181,38,142,104,173,181,
+    214,90,90,173,181,214,90,107,164,157,214,90,107,171,177,214,90,107,173,177,150,
+    90,107,173,181,214,90,107,173,181,214,90,107,173,181,0,0,221,9,7,0,221,
+    7,27,52,37,22,7,8,66,67,86,2,0,169,0,0,128,49,74,57,7,161,
+    164,148,42,132,24,115,78,74,73,41,85,8,49,230,156,148,212,90,171,25,99,
+    14,66,74,169,165,22,52,230,24,132,148,90,107,173,166,212,57,41,169,181,152,
+    90,77,169,115,82,82,107,49,182,154,107,41,165,164,214,90,75,53,246,82,74,
+    104,169,181,88,107,174,53,150,146,82,75,49,213,150,99,77,165,149,214,98,140,
+    177,230,220,90,74,45,197,86,107,173,193,181,84,98,138,177,0,0,204,6,7,
+    0,136,4,27,86,71,56,41,26,11,12,66,67,86,2,0,33,1,0,136,49,
+    74,49,230,156,115,16,66,8,161,84,74,41,198,156,115,16,66,8,33,148,74,
+    41,197,152,115,206,65,8,33,132,146,49,198,156,115,14,66,8,33,132,80,74,
+    201,24,115,206,65,8,33,132,16,74,41,157,115,206,57,8,33,132,16,66,41,
+    165,115,206,57,7,33,132,16,66,72,37,117,206,57,231,32,132,16,66,8,165,
+    148,148,58,231,28,132,16,66,8,33,149,148,82,8,33,132,16,66,8,33,148,
+    84,82,10,33,132,16,66,8,33,148,148,74,74,33,132,16,66,8,33,132,144,
+    74,74,41,165,16,66,8,33,132,16,74,74,41,165,20,74,41,33,132,16,66,
+    42,41,165,148,66,8,33,132,16,66,72,41,165,148,82,41,33,132,16,66,8,
+    37,165,148,82,74,41,132,16,66,8,161,0,0,128,3,7,0,128,0,35,232,
+    36,163,202,34,108,52,225,194,3,16,66,67,86,2,0,81,0,0,144,178,218,
+    106,15,198,17,136,50,105,53,135,6,81,38,49,23,93,49,164,28,197,158,34,
+    133,144,130,152,91,196,20,82,208,106,171,152,83,12,90,172,157,99,8,57,105,
+    61,132,78,41,6,33,0,
+};
+
+const expanded_codebook pcb_expanded[CODEBOOK_COUNT - 1] = {
+    { &pcb_expanded_data[0], 119 },
+    { &pcb_expanded_data[15], 175 },
+    { &pcb_expanded_data[37], 329 },
+    { &pcb_expanded_data[79], 119 },
+    { &pcb_expanded_data[94], 175 },
+    { &pcb_expanded_data[116], 329 },
+    { &pcb_expanded_data[158], 390 },
+    { &pcb_expanded_data[207], 1350 },
+    { &pcb_expanded_data[376], 710 },
+    { &pcb_expanded_data[465], 230 },
+    { &pcb_expanded_data[494], 678 },
+    { &pcb_expanded_data[579], 173 },
+    { &pcb_expanded_data[601], 280 },
+    { &pcb_expanded_data[636], 588 },
+    { &pcb_expanded_data[710], 173 },
+    { &pcb_expanded_data[732], 280 },
+    { &pcb_expanded_data[767], 588 },
+    { &pcb_expanded_data[841], 110 },
+    { &pcb_expanded_data[855], 390 },
+    { &pcb_expanded_data[904], 390 },
+    { &pcb_expanded_data[953], 1350 },
+    { &pcb_expanded_data[1122], 90 },
+    { &pcb_expanded_data[1134], 110 },
+    { &pcb_expanded_data[1148], 170 },
+    { &pcb_expanded_data[1170], 329 },
+    { &pcb_expanded_data[1212], 1350 },
+    { &pcb_expanded_data[1381], 90 },
+    { &pcb_expanded_data[1393], 110 },
+    { &pcb_expanded_data[1407], 170 },
+    { &pcb_expanded_data[1429], 329 },
+    { &pcb_expanded_data[1471], 390 },
+    { &pcb_expanded_data[1520], 1350 },
+    { &pcb_expanded_data[1689], 119 },
+    { &pcb_expanded_data[1704], 175 },
+    { &pcb_expanded_data[1726], 329 },
+    { &pcb_expanded_data[1768], 119 },
+    { &pcb_expanded_data[1783], 175 },
+    { &pcb_expanded_data[1805], 329 },
+    { &pcb_expanded_data[1847], 110 },
+    { &pcb_expanded_data[1861], 390 },
+    { &pcb_expanded_data[1910], 390 },
+    { &pcb_expanded_data[1959], 710 },
+    { &pcb_expanded_data[2048], 230 },
+    { &pcb_expanded_data[2077], 678 },
+    { &pcb_expanded_data[2162], 173 },
+    { &pcb_expanded_data[2184], 280 },
+    { &pcb_expanded_data[2219], 588 },
+    { &pcb_expanded_data[2293], 173 },
+    { &pcb_expanded_data[2315], 280 },
+    { &pcb_expanded_data[2350], 588 },
+    { &pcb_expanded_data[2424], 110 },
+    { &pcb_expanded_data[2438], 390 },
+    { &pcb_expanded_data[2487], 390 },
+    { &pcb_expanded_data[2536], 710 },
+    { &pcb_expanded_data[2625], 230 },
+    { &pcb_expanded_data[2654], 678 },
+    { &pcb_expanded_data[2739], 173 },
+    { &pcb_expanded_data[2761], 280 },
+    { &pcb_expanded_data[2796], 588 },
+    { &pcb_expanded_data[2870], 173 },
+    { &pcb_expanded_data[2892], 280 },
+    { &pcb_expanded_data[2927], 588 },
+    { &pcb_expanded_data[3001], 150 },
+    { &pcb_expanded_data[3020], 110 },
+    { &pcb_expanded_data[3034], 1350 },
+    { &pcb_expanded_data[3203], 390 },
+    { &pcb_expanded_data[3252], 710 },
+    { &pcb_expanded_data[3341], 230 },
+    { &pcb_expanded_data[3370], 678 },
+    { &pcb_expanded_data[3455], 230 },
+    { &pcb_expanded_data[3484], 678 },
+    { &pcb_expanded_data[3569], 173 },
+    { &pcb_expanded_data[3591], 280 },
+    { &pcb_expanded_data[3626], 588 },
+    { &pcb_expanded_data[3700], 173 },
+    { &pcb_expanded_data[3722], 280 },
+    { &pcb_expanded_data[3757], 588 },
+    { &pcb_expanded_data[3831], 150 },
+    { &pcb_expanded_data[3850], 110 },
+    { &pcb_expanded_data[3864], 1350 },
+    { &pcb_expanded_data[4033], 390 },
+    { &pcb_expanded_data[4082], 710 },
+    { &pcb_expanded_data[4171], 230 },
+    { &pcb_expanded_data[4200], 678 },
+    { &pcb_expanded_data[4285], 230 },
+    { &pcb_expanded_data[4314], 678 },
+    { &pcb_expanded_data[4399], 173 },
+    { &pcb_expanded_data[4421], 280 },
+    { &pcb_expanded_data[4456], 588 },
+    { &pcb_expanded_data[4530], 173 },
+    { &pcb_expanded_data[4552], 280 },
+    { &pcb_expanded_data[4587], 588 },
+    { &pcb_expanded_data[4661], 1350 },
+    { &pcb_expanded_data[4830], 90 },
+    { &pcb_expanded_data[4842], 110 },
+    { &pcb_expanded_data[4856], 170 },
+    { &pcb_expanded_data[4878], 329 },
+    { &pcb_expanded_data[4920], 550 },
+    { &pcb_expanded_data[4989], 550 },
+    { &pcb_expanded_data[5058], 3844 },
+    { &pcb_expanded_data[5539], 3884 },
+    { &pcb_expanded_data[6025], 580 },
+    { &pcb_expanded_data[6098], 1050 },
+    { &pcb_expanded_data[6230], 279 },
+    { &pcb_expanded_data[6265], 550 },
+    { &pcb_expanded_data[6334], 1324 },
+    { &pcb_expanded_data[6500], 2449 },
+    { &pcb_expanded_data[6807], 390 },
+    { &pcb_expanded_data[6856], 570 },
+    { &pcb_expanded_data[6928], 550 },
+    { &pcb_expanded_data[6997], 550 },
+    { &pcb_expanded_data[7066], 3279 },
+    { &pcb_expanded_data[7476], 3279 },
+    { &pcb_expanded_data[7886], 580 },
+    { &pcb_expanded_data[7959], 580 },
+    { &pcb_expanded_data[8032], 550 },
+    { &pcb_expanded_data[8101], 788 },
+    { &pcb_expanded_data[8200], 788 },
+    { &pcb_expanded_data[8299], 788 },
+    { &pcb_expanded_data[8398], 1324 },
+    { &pcb_expanded_data[8564], 1324 },
+    { &pcb_expanded_data[8730], 1669 },
+    { &pcb_expanded_data[8939], 570 },
+    { &pcb_expanded_data[9011], 570 },
+    { &pcb_expanded_data[9083], 550 },
+    { &pcb_expanded_data[9152], 3279 },
+    { &pcb_expanded_data[9562], 580 },
+    { &pcb_expanded_data[9635], 1669 },
+    { &pcb_expanded_data[9844], 550 },
+    { &pcb_expanded_data[9913], 788 },
+    { &pcb_expanded_data[10012], 1036 },
+    { &pcb_expanded_data[10142], 195 },
+    { &pcb_expanded_data[10167], 1036 },
+    { &pcb_expanded_data[10297], 788 },
+    { &pcb_expanded_data[10396], 1324 },
+    { &pcb_expanded_data[10562], 2449 },
+    { &pcb_expanded_data[10869], 1324 },
+    { &pcb_expanded_data[11035], 2039 },
+    { &pcb_expanded_data[11290], 678 },
+    { &pcb_expanded_data[11375], 570 },
+    { &pcb_expanded_data[11447], 550 },
+    { &pcb_expanded_data[11516], 550 },
+    { &pcb_expanded_data[11585], 3864 },
+    { &pcb_expanded_data[12068], 3279 },
+    { &pcb_expanded_data[12478], 580 },
+    { &pcb_expanded_data[12551], 1090 },
+    { &pcb_expanded_data[12688], 279 },
+    { &pcb_expanded_data[12723], 550 },
+    { &pcb_expanded_data[12792], 1324 },
+    { &pcb_expanded_data[12958], 2449 },
+    { &pcb_expanded_data[13265], 390 },
+    { &pcb_expanded_data[13314], 550 },
+    { &pcb_expanded_data[13383], 550 },
+    { &pcb_expanded_data[13452], 3864 },
+    { &pcb_expanded_data[13935], 3279 },
+    { &pcb_expanded_data[14345], 580 },
+    { &pcb_expanded_data[14418], 580 },
+    { &pcb_expanded_data[14491], 550 },
+    { &pcb_expanded_data[14560], 788 },
+    { &pcb_expanded_data[14659], 788 },
+    { &pcb_expanded_data[14758], 788 },
+    { &pcb_expanded_data[14857], 1324 },
+    { &pcb_expanded_data[15023], 1324 },
+    { &pcb_expanded_data[15189], 1669 },
+    { &pcb_expanded_data[15398], 570 },
+    { &pcb_expanded_data[15470], 390 },
+    { &pcb_expanded_data[15519], 550 },
+    { &pcb_expanded_data[15588], 550 },
+    { &pcb_expanded_data[15657], 3809 },
+    { &pcb_expanded_data[16134], 3884 },
+    { &pcb_expanded_data[16620], 580 },
+    { &pcb_expanded_data[16693], 1190 },
+    { &pcb_expanded_data[16842], 279 },
+    { &pcb_expanded_data[16877], 3279 },
+    { &pcb_expanded_data[17287], 1036 },
+    { &pcb_expanded_data[17417], 1036 },
+    { &pcb_expanded_data[17547], 390 },
+    { &pcb_expanded_data[17596], 390 },
+    { &pcb_expanded_data[17645], 550 },
+    { &pcb_expanded_data[17714], 550 },
+    { &pcb_expanded_data[17783], 3809 },
+    { &pcb_expanded_data[18260], 3884 },
+    { &pcb_expanded_data[18746], 580 },
+    { &pcb_expanded_data[18819], 1190 },
+    { &pcb_expanded_data[18968], 279 },
+    { &pcb_expanded_data[19003], 405 },
+    { &pcb_expanded_data[19054], 1036 },
+    { &pcb_expanded_data[19184], 1036 },
+    { &pcb_expanded_data[19314], 390 },
+    { &pcb_expanded_data[19363], 390 },
+    { &pcb_expanded_data[19412], 550 },
+    { &pcb_expanded_data[19481], 550 },
+    { &pcb_expanded_data[19550], 3794 },
+    { &pcb_expanded_data[20025], 3279 },
+    { &pcb_expanded_data[20435], 580 },
+    { &pcb_expanded_data[20508], 1185 },
+    { &pcb_expanded_data[20657], 279 },
+    { &pcb_expanded_data[20692], 580 },
+    { &pcb_expanded_data[20765], 1036 },
+    { &pcb_expanded_data[20895], 1036 },
+    { &pcb_expanded_data[21025], 390 },
+    { &pcb_expanded_data[21074], 390 },
+    { &pcb_expanded_data[21123], 550 },
+    { &pcb_expanded_data[21192], 550 },
+    { &pcb_expanded_data[21261], 3749 },
+    { &pcb_expanded_data[21730], 3279 },
+    { &pcb_expanded_data[22140], 580 },
+    { &pcb_expanded_data[22213], 1200 },
+    { &pcb_expanded_data[22363], 279 },
+    { &pcb_expanded_data[22398], 580 },
+    { &pcb_expanded_data[22471], 1324 },
+    { &pcb_expanded_data[22637], 1669 },
+    { &pcb_expanded_data[22846], 390 },
+    { &pcb_expanded_data[22895], 390 },
+    { &pcb_expanded_data[22944], 550 },
+    { &pcb_expanded_data[23013], 550 },
+    { &pcb_expanded_data[23082], 3779 },
+    { &pcb_expanded_data[23555], 3279 },
+    { &pcb_expanded_data[23965], 580 },
+    { &pcb_expanded_data[24038], 1200 },
+    { &pcb_expanded_data[24188], 279 },
+    { &pcb_expanded_data[24223], 1036 },
+    { &pcb_expanded_data[24353], 1324 },
+    { &pcb_expanded_data[24519], 1669 },
+    { &pcb_expanded_data[24728], 390 },
+    { &pcb_expanded_data[24777], 570 },
+    { &pcb_expanded_data[24849], 550 },
+    { &pcb_expanded_data[24918], 550 },
+    { &pcb_expanded_data[24987], 3779 },
+    { &pcb_expanded_data[25460], 3279 },
+    { &pcb_expanded_data[25870], 580 },
+    { &pcb_expanded_data[25943], 580 },
+    { &pcb_expanded_data[26016], 550 },
+    { &pcb_expanded_data[26085], 788 },
+    { &pcb_expanded_data[26184], 788 },
+    { &pcb_expanded_data[26283], 788 },
+    { &pcb_expanded_data[26382], 1036 },
+    { &pcb_expanded_data[26512], 1324 },
+    { &pcb_expanded_data[26678], 1669 },
+    { &pcb_expanded_data[26887], 570 },
+    { &pcb_expanded_data[26959], 570 },
+    { &pcb_expanded_data[27031], 550 },
+    { &pcb_expanded_data[27100], 550 },
+    { &pcb_expanded_data[27169], 3714 },
+    { &pcb_expanded_data[27634], 3279 },
+    { &pcb_expanded_data[28044], 580 },
+    { &pcb_expanded_data[28117], 580 },
+    { &pcb_expanded_data[28190], 550 },
+    { &pcb_expanded_data[28259], 788 },
+    { &pcb_expanded_data[28358], 788 },
+    { &pcb_expanded_data[28457], 788 },
+    { &pcb_expanded_data[28556], 1324 },
+    { &pcb_expanded_data[28722], 1324 },
+    { &pcb_expanded_data[28888], 1669 },
+    { &pcb_expanded_data[29097], 570 },
+    { &pcb_expanded_data[29169], 570 },
+    { &pcb_expanded_data[29241], 550 },
+    { &pcb_expanded_data[29310], 550 },
+    { &pcb_expanded_data[29379], 3719 },
+    { &pcb_expanded_data[29844], 3279 },
+    { &pcb_expanded_data[30254], 580 },
+    { &pcb_expanded_data[30327], 580 },
+    { &pcb_expanded_data[30400], 550 },
+    { &pcb_expanded_data[30469], 788 },
+    { &pcb_expanded_data[30568], 788 },
+    { &pcb_expanded_data[30667], 788 },
+    { &pcb_expanded_data[30766], 788 },
+    { &pcb_expanded_data[30865], 1036 },
+    { &pcb_expanded_data[30995], 315 },
+    { &pcb_expanded_data[31035], 570 },
+    { &pcb_expanded_data[31107], 570 },
+    { &pcb_expanded_data[31179], 570 },
+    { &pcb_expanded_data[31251], 550 },
+    { &pcb_expanded_data[31320], 3279 },
+    { &pcb_expanded_data[31730], 580 },
+    { &pcb_expanded_data[31803], 1669 },
+    { &pcb_expanded_data[32012], 550 },
+    { &pcb_expanded_data[32081], 788 },
+    { &pcb_expanded_data[32180], 1036 },
+    { &pcb_expanded_data[32310], 279 },
+    { &pcb_expanded_data[32345], 1036 },
+    { &pcb_expanded_data[32475], 788 },
+    { &pcb_expanded_data[32574], 1324 },
+    { &pcb_expanded_data[32740], 2449 },
+    { &pcb_expanded_data[33047], 580 },
+    { &pcb_expanded_data[33120], 2039 },
+    { &pcb_expanded_data[33375], 315 },
+    { &pcb_expanded_data[33415], 570 },
+    { &pcb_expanded_data[33487], 570 },
+    { &pcb_expanded_data[33559], 550 },
+    { &pcb_expanded_data[33628], 3279 },
+    { &pcb_expanded_data[34038], 580 },
+    { &pcb_expanded_data[34111], 1669 },
+    { &pcb_expanded_data[34320], 550 },
+    { &pcb_expanded_data[34389], 788 },
+    { &pcb_expanded_data[34488], 1036 },
+    { &pcb_expanded_data[34618], 279 },
+    { &pcb_expanded_data[34653], 1036 },
+    { &pcb_expanded_data[34783], 788 },
+    { &pcb_expanded_data[34882], 1324 },
+    { &pcb_expanded_data[35048], 2449 },
+    { &pcb_expanded_data[35355], 1324 },
+    { &pcb_expanded_data[35521], 2039 },
+    { &pcb_expanded_data[35776], 678 },
+    { &pcb_expanded_data[35861], 390 },
+    { &pcb_expanded_data[35910], 550 },
+    { &pcb_expanded_data[35979], 550 },
+    { &pcb_expanded_data[36048], 3814 },
+    { &pcb_expanded_data[36525], 3889 },
+    { &pcb_expanded_data[37012], 580 },
+    { &pcb_expanded_data[37085], 1170 },
+    { &pcb_expanded_data[37232], 279 },
+    { &pcb_expanded_data[37267], 3279 },
+    { &pcb_expanded_data[37677], 1036 },
+    { &pcb_expanded_data[37807], 1036 },
+    { &pcb_expanded_data[37937], 390 },
+    { &pcb_expanded_data[37986], 7111 },
+    { &pcb_expanded_data[38875], 904 },
+    { &pcb_expanded_data[38988], 351 },
+    { &pcb_expanded_data[39032], 531 },
+    { &pcb_expanded_data[39099], 1568 },
+    { &pcb_expanded_data[39295], 550 },
+    { &pcb_expanded_data[39364], 788 },
+    { &pcb_expanded_data[39463], 1060 },
+    { &pcb_expanded_data[39596], 279 },
+    { &pcb_expanded_data[39631], 550 },
+    { &pcb_expanded_data[39700], 1324 },
+    { &pcb_expanded_data[39866], 2449 },
+    { &pcb_expanded_data[40173], 570 },
+    { &pcb_expanded_data[40245], 570 },
+    { &pcb_expanded_data[40317], 7111 },
+    { &pcb_expanded_data[41206], 904 },
+    { &pcb_expanded_data[41319], 351 },
+    { &pcb_expanded_data[41363], 531 },
+    { &pcb_expanded_data[41430], 1568 },
+    { &pcb_expanded_data[41626], 550 },
+    { &pcb_expanded_data[41695], 788 },
+    { &pcb_expanded_data[41794], 1075 },
+    { &pcb_expanded_data[41929], 279 },
+    { &pcb_expanded_data[41964], 1036 },
+    { &pcb_expanded_data[42094], 1324 },
+    { &pcb_expanded_data[42260], 2449 },
+    { &pcb_expanded_data[42567], 570 },
+    { &pcb_expanded_data[42639], 570 },
+    { &pcb_expanded_data[42711], 271 },
+    { &pcb_expanded_data[42745], 1624 },
+    { &pcb_expanded_data[42948], 481 },
+    { &pcb_expanded_data[43009], 1148 },
+    { &pcb_expanded_data[43153], 550 },
+    { &pcb_expanded_data[43222], 788 },
+    { &pcb_expanded_data[43321], 795 },
+    { &pcb_expanded_data[43421], 279 },
+    { &pcb_expanded_data[43456], 1036 },
+    { &pcb_expanded_data[43586], 788 },
+    { &pcb_expanded_data[43685], 1324 },
+    { &pcb_expanded_data[43851], 2449 },
+    { &pcb_expanded_data[44158], 1669 },
+    { &pcb_expanded_data[44367], 2039 },
+    { &pcb_expanded_data[44622], 315 },
+    { &pcb_expanded_data[44662], 570 },
+    { &pcb_expanded_data[44734], 7111 },
+    { &pcb_expanded_data[45623], 904 },
+    { &pcb_expanded_data[45736], 351 },
+    { &pcb_expanded_data[45780], 531 },
+    { &pcb_expanded_data[45847], 1568 },
+    { &pcb_expanded_data[46043], 550 },
+    { &pcb_expanded_data[46112], 788 },
+    { &pcb_expanded_data[46211], 1040 },
+    { &pcb_expanded_data[46341], 279 },
+    { &pcb_expanded_data[46376], 550 },
+    { &pcb_expanded_data[46445], 1324 },
+    { &pcb_expanded_data[46611], 2449 },
+    { &pcb_expanded_data[46918], 570 },
+    { &pcb_expanded_data[46990], 7111 },
+    { &pcb_expanded_data[47879], 904 },
+    { &pcb_expanded_data[47992], 351 },
+    { &pcb_expanded_data[48036], 531 },
+    { &pcb_expanded_data[48103], 1568 },
+    { &pcb_expanded_data[48299], 550 },
+    { &pcb_expanded_data[48368], 788 },
+    { &pcb_expanded_data[48467], 1075 },
+    { &pcb_expanded_data[48602], 279 },
+    { &pcb_expanded_data[48637], 1036 },
+    { &pcb_expanded_data[48767], 1324 },
+    { &pcb_expanded_data[48933], 2449 },
+    { &pcb_expanded_data[49240], 570 },
+    { &pcb_expanded_data[49312], 570 },
+    { &pcb_expanded_data[49384], 7111 },
+    { &pcb_expanded_data[50273], 1184 },
+    { &pcb_expanded_data[50421], 904 },
+    { &pcb_expanded_data[50534], 381 },
+    { &pcb_expanded_data[50582], 561 },
+    { &pcb_expanded_data[50653], 1598 },
+    { &pcb_expanded_data[50853], 550 },
+    { &pcb_expanded_data[50922], 788 },
+    { &pcb_expanded_data[51021], 1075 },
+    { &pcb_expanded_data[51156], 279 },
+    { &pcb_expanded_data[51191], 1036 },
+    { &pcb_expanded_data[51321], 1036 },
+    { &pcb_expanded_data[51451], 1669 },
+    { &pcb_expanded_data[51660], 570 },
+    { &pcb_expanded_data[51732], 570 },
+    { &pcb_expanded_data[51804], 7111 },
+    { &pcb_expanded_data[52693], 1184 },
+    { &pcb_expanded_data[52841], 904 },
+    { &pcb_expanded_data[52954], 381 },
+    { &pcb_expanded_data[53002], 561 },
+    { &pcb_expanded_data[53073], 1598 },
+    { &pcb_expanded_data[53273], 550 },
+    { &pcb_expanded_data[53342], 788 },
+    { &pcb_expanded_data[53441], 1075 },
+    { &pcb_expanded_data[53576], 279 },
+    { &pcb_expanded_data[53611], 1036 },
+    { &pcb_expanded_data[53741], 1324 },
+    { &pcb_expanded_data[53907], 1669 },
+    { &pcb_expanded_data[54116], 570 },
+    { &pcb_expanded_data[54188], 570 },
+    { &pcb_expanded_data[54260], 7111 },
+    { &pcb_expanded_data[55149], 1184 },
+    { &pcb_expanded_data[55297], 904 },
+    { &pcb_expanded_data[55410], 381 },
+    { &pcb_expanded_data[55458], 561 },
+    { &pcb_expanded_data[55529], 1598 },
+    { &pcb_expanded_data[55729], 550 },
+    { &pcb_expanded_data[55798], 788 },
+    { &pcb_expanded_data[55897], 1075 },
+    { &pcb_expanded_data[56032], 279 },
+    { &pcb_expanded_data[56067], 1036 },
+    { &pcb_expanded_data[56197], 1324 },
+    { &pcb_expanded_data[56363], 2449 },
+    { &pcb_expanded_data[56670], 570 },
+    { &pcb_expanded_data[56742], 570 },
+    { &pcb_expanded_data[56814], 7111 },
+    { &pcb_expanded_data[57703], 1184 },
+    { &pcb_expanded_data[57851], 904 },
+    { &pcb_expanded_data[57964], 381 },
+    { &pcb_expanded_data[58012], 561 },
+    { &pcb_expanded_data[58083], 1598 },
+    { &pcb_expanded_data[58283], 550 },
+    { &pcb_expanded_data[58352], 788 },
+    { &pcb_expanded_data[58451], 1075 },
+    { &pcb_expanded_data[58586], 279 },
+    { &pcb_expanded_data[58621], 1324 },
+    { &pcb_expanded_data[58787], 1669 },
+    { &pcb_expanded_data[58996], 2449 },
+    { &pcb_expanded_data[59303], 570 },
+    { &pcb_expanded_data[59375], 570 },
+    { &pcb_expanded_data[59447], 471 },
+    { &pcb_expanded_data[59506], 2584 },
+    { &pcb_expanded_data[59829], 511 },
+    { &pcb_expanded_data[59893], 1178 },
+    { &pcb_expanded_data[60041], 550 },
+    { &pcb_expanded_data[60110], 788 },
+    { &pcb_expanded_data[60209], 795 },
+    { &pcb_expanded_data[60309], 279 },
+    { &pcb_expanded_data[60344], 1036 },
+    { &pcb_expanded_data[60474], 788 },
+    { &pcb_expanded_data[60573], 1324 },
+    { &pcb_expanded_data[60739], 2449 },
+    { &pcb_expanded_data[61046], 1036 },
+    { &pcb_expanded_data[61176], 1036 },
+    { &pcb_expanded_data[61306], 678 },
+    { &pcb_expanded_data[61391], 570 },
+    { &pcb_expanded_data[61463], 570 },
+    { &pcb_expanded_data[61535], 471 },
+    { &pcb_expanded_data[61594], 2584 },
+    { &pcb_expanded_data[61917], 511 },
+    { &pcb_expanded_data[61981], 1178 },
+    { &pcb_expanded_data[62129], 550 },
+    { &pcb_expanded_data[62198], 788 },
+    { &pcb_expanded_data[62297], 795 },
+    { &pcb_expanded_data[62397], 279 },
+    { &pcb_expanded_data[62432], 1036 },
+    { &pcb_expanded_data[62562], 788 },
+    { &pcb_expanded_data[62661], 1324 },
+    { &pcb_expanded_data[62827], 2449 },
+    { &pcb_expanded_data[63134], 1036 },
+    { &pcb_expanded_data[63264], 1036 },
+    { &pcb_expanded_data[63394], 678 },
+    { &pcb_expanded_data[63479], 570 },
+    { &pcb_expanded_data[63551], 570 },
+    { &pcb_expanded_data[63623], 471 },
+    { &pcb_expanded_data[63682], 2584 },
+    { &pcb_expanded_data[64005], 511 },
+    { &pcb_expanded_data[64069], 1178 },
+    { &pcb_expanded_data[64217], 550 },
+    { &pcb_expanded_data[64286], 788 },
+    { &pcb_expanded_data[64385], 795 },
+    { &pcb_expanded_data[64485], 279 },
+    { &pcb_expanded_data[64520], 1036 },
+    { &pcb_expanded_data[64650], 788 },
+    { &pcb_expanded_data[64749], 1324 },
+    { &pcb_expanded_data[64915], 2449 },
+    { &pcb_expanded_data[65222], 1669 },
+    { &pcb_expanded_data[65431], 2039 },
+    { &pcb_expanded_data[65686], 315 },
+    { &pcb_expanded_data[65726], 570 },
+    { &pcb_expanded_data[65798], 570 },
+    { &pcb_expanded_data[65870], 471 },
+    { &pcb_expanded_data[65929], 2584 },
+    { &pcb_expanded_data[66252], 511 },
+    { &pcb_expanded_data[66316], 1178 },
+    { &pcb_expanded_data[66464], 550 },
+    { &pcb_expanded_data[66533], 788 },
+    { &pcb_expanded_data[66632], 795 },
+    { &pcb_expanded_data[66732], 279 },
+    { &pcb_expanded_data[66767], 1036 },
+    { &pcb_expanded_data[66897], 788 },
+    { &pcb_expanded_data[66996], 1324 },
+    { &pcb_expanded_data[67162], 2449 },
+    { &pcb_expanded_data[67469], 2039 },
+    { &pcb_expanded_data[67724], 2039 },
+    { &pcb_expanded_data[67979], 315 },
+    { &pcb_expanded_data[68019], 570 },
+    { &pcb_expanded_data[68091], 475 },
+    { &pcb_expanded_data[68151], 7111 },
+    { &pcb_expanded_data[69040], 904 },
+    { &pcb_expanded_data[69153], 351 },
+    { &pcb_expanded_data[69197], 531 },
+    { &pcb_expanded_data[69264], 1568 },
+    { &pcb_expanded_data[69460], 550 },
+    { &pcb_expanded_data[69529], 788 },
+    { &pcb_expanded_data[69628], 1075 },
+    { &pcb_expanded_data[69763], 279 },
+    { &pcb_expanded_data[69798], 3279 },
+    { &pcb_expanded_data[70208], 1036 },
+    { &pcb_expanded_data[70338], 1669 },
+    { &pcb_expanded_data[70547], 475 },
+    { &pcb_expanded_data[70607], 475 },
+    { &pcb_expanded_data[70667], 7111 },
+    { &pcb_expanded_data[71556], 904 },
+    { &pcb_expanded_data[71669], 381 },
+    { &pcb_expanded_data[71717], 561 },
+    { &pcb_expanded_data[71788], 1598 },
+    { &pcb_expanded_data[71988], 550 },
+    { &pcb_expanded_data[72057], 788 },
+    { &pcb_expanded_data[72156], 1075 },
+    { &pcb_expanded_data[72291], 279 },
+    { &pcb_expanded_data[72326], 580 },
+    { &pcb_expanded_data[72399], 1036 },
+    { &pcb_expanded_data[72529], 1669 },
+    { &pcb_expanded_data[72738], 475 },
+    { &pcb_expanded_data[72798], 475 },
+    { &pcb_expanded_data[72858], 7111 },
+    { &pcb_expanded_data[73747], 904 },
+    { &pcb_expanded_data[73860], 366 },
+    { &pcb_expanded_data[73906], 531 },
+    { &pcb_expanded_data[73973], 1568 },
+    { &pcb_expanded_data[74169], 550 },
+    { &pcb_expanded_data[74238], 788 },
+    { &pcb_expanded_data[74337], 1075 },
+    { &pcb_expanded_data[74472], 279 },
+    { &pcb_expanded_data[74507], 1036 },
+    { &pcb_expanded_data[74637], 1036 },
+    { &pcb_expanded_data[74767], 1669 },
+    { &pcb_expanded_data[74976], 475 },
+    { &pcb_expanded_data[75036], 475 },
+    { &pcb_expanded_data[75096], 7111 },
+    { &pcb_expanded_data[75985], 904 },
+    { &pcb_expanded_data[76098], 381 },
+    { &pcb_expanded_data[76146], 561 },
+    { &pcb_expanded_data[76217], 1598 },
+    { &pcb_expanded_data[76417], 550 },
+    { &pcb_expanded_data[76486], 788 },
+    { &pcb_expanded_data[76585], 1075 },
+    { &pcb_expanded_data[76720], 279 },
+    { &pcb_expanded_data[76755], 1036 },
+    { &pcb_expanded_data[76885], 1036 },
+    { &pcb_expanded_data[77015], 1669 },
+    { &pcb_expanded_data[77224], 475 },
+    { &pcb_expanded_data[77284], 475 },
+    { &pcb_expanded_data[77344], 7111 },
+    { &pcb_expanded_data[78233], 904 },
+    { &pcb_expanded_data[78346], 351 },
+    { &pcb_expanded_data[78390], 531 },
+    { &pcb_expanded_data[78457], 1568 },
+    { &pcb_expanded_data[78653], 550 },
+    { &pcb_expanded_data[78722], 788 },
+    { &pcb_expanded_data[78821], 1075 },
+    { &pcb_expanded_data[78956], 279 },
+    { &pcb_expanded_data[78991], 3279 },
+    { &pcb_expanded_data[79401], 1036 },
+    { &pcb_expanded_data[79531], 1669 },
+    { &pcb_expanded_data[79740], 475 },
+    { &pcb_expanded_data[79800], 475 },
+    { &pcb_expanded_data[79860], 7111 },
+    { &pcb_expanded_data[80749], 904 },
+    { &pcb_expanded_data[80862], 381 },
+    { &pcb_expanded_data[80910], 561 },
+    { &pcb_expanded_data[80981], 1598 },
+    { &pcb_expanded_data[81181], 550 },
+    { &pcb_expanded_data[81250], 788 },
+    { &pcb_expanded_data[81349], 1075 },
+    { &pcb_expanded_data[81484], 279 },
+    { &pcb_expanded_data[81519], 580 },
+    { &pcb_expanded_data[81592], 1036 },
+    { &pcb_expanded_data[81722], 1669 },
+    { &pcb_expanded_data[81931], 475 },
+};
@@ -0,0 +1,1004 @@
+#include "setup.h"
+
+// A cached setup header, keyed by the raw Wwise setup packet, the channel count and the codebook libraries
+typedef struct setup_cache_entry {
+    // FNV-1a hash of the channel count and the packet
+    uint64_t hash;
+
+    uint32_t channels;
+
+    // The libraries the header was rebuilt with, see codebook_libraries_hash
+    uint64_t libraries;
+
+    // The Wwise setup packet, compared in full on a hash match
+    uint8_t* packet;
+    uint32_t packet_size;
+
+    // The rebuilt setup header
+    uint8_t* bits;
+    uint64_t n_bits;
+
+    bool mode_blockflag[64];
+    int mode_bits;
+    bool long_windows;
+
+    // Value of the cache clock on the last use, 0 for unused entries
+    uint64_t last_used;
+} setup_cache_entry;
+
+static setup_cache_entry setup_cache[SETUP_CACHE_ENTRIES];
+static uint64_t setup_cache_clock = 0;
+static SRWLOCK setup_cache_lock = SRWLOCK_INIT;
+
+// Reports an error of rebuild_setup, unless the rebuild is only a trial
+#define SETUP_ERROR(verbose, ...) if (verbose) { perrf(__VA_ARGS__); }
+
+// Identifies cache files, followed by the format version
+static const char SETUP_CACHE_MAGIC[8] = { 'N', 'M', 'E', '2', 'S', 'E', 'T', 'C' };
+#define SETUP_CACHE_VERSION 3
+
+// Upper bound for the packet and the rebuilt header of a cache record, larger sizes mean a damaged file
+#define SETUP_CACHE_MAX_BYTES (1 << 24)
+
+// At most 64 modes, as in audio_packet_writers
+#define SETUP_MAX_MODE_BITS 6
+
+vorbis_setup new_vorbis_setup(void) {
+    vorbis_setup setup;
+    setup.bits = new_bit_writer();
+    memset(setup.mode_blockflag, 0, sizeof(setup.mode_blockflag));
+    setup.mode_bits = 0;
+    setup.long_windows = false;
+
+    return setup;
+}
+
+void reset_vorbis_setup(vorbis_setup* setup) {
+    reset_bit_writer(&setup->bits);
+    memset(setup->mode_blockflag, 0, sizeof(setup->mode_blockflag));
+    setup->mode_bits = 0;
+    setup->long_windows = false;
+}
+
+void free_vorbis_setup(vorbis_setup* setup) {
+    free_bit_writer(&setup->bits);
+}
+
+// Kinds of setup_op
+#define SETUP_OP_COPY       0   // Copies a field, zero extended to write_bits
+#define SETUP_OP_CONST      1   // Writes value without reading anything
+#define SETUP_OP_EXPECT     2   // Copies a field that has to equal value, as it shapes the rest of the packet
+#define SETUP_OP_LIMIT      3   // Copies a field that has to be below value
+#define SETUP_OP_CODEBOOK   4   // Reads a codebook id and writes the expanded codebook
+#define SETUP_OP_CLASSBOOK  5   // A residue classbook below value, whose codebook fits aux classifications
+#define SETUP_OP_RESIDUEBOOK 6  // A residue book below value, whose codebook fits partitions of aux samples in strict programs
+#define SETUP_OP_MASTERBOOK 7   // A floor1 masterbook below value, whose codebook has aux entries in strict programs
+#define SETUP_OP_SUBCLASSBOOK 8 // A floor1 subclass book plus one below value, whose codebook is scalar in strict programs
+
+// One step of transcribing a setup packet
+typedef struct setup_op {
+    uint8_t type;
+    uint8_t read_bits;
+    uint8_t write_bits;
+    uint32_t value;
+    uint32_t aux;
+} setup_op;
+
+// The transcription of a setup packet, recorded while rebuilding it. Setup packets with the same layout
+// replay it instead of going through the rebuild
+typedef struct setup_program {
+    uint32_t channels;
+    uint32_t packet_size;
+    const codebook_library* library;
+
+    // Whether the codebooks were held to the strict checks
+    bool strict;
+
+    setup_op* ops;
+    uint32_t n_ops;
+    uint32_t capacity;
+
+    // The modes are fixed by the EXPECT ops
+    bool mode_blockflag[64];
+    int mode_bits;
+    bool long_windows;
+} setup_program;
+
+// Recorded programs, never removed so replays can run without holding the lock
+static setup_program* setup_programs[SETUP_PROGRAMS];
+static unsigned int n_setup_programs = 0;
+static SRWLOCK setup_programs_lock = SRWLOCK_INIT;
+
+// State of a rebuild: the fields are read from ss, written to bw and recorded into program, if any
+typedef struct transcriber {
+    bit_stream* ss;
+    bit_writer* bw;
+    setup_program* program;
+    bool recording_failed;
+} transcriber;
+
+static void record_op(transcriber* t, uint8_t type, uint32_t in_bits, uint32_t out_bits, uint32_t value, uint32_t aux) {
+    setup_program* p = t->program;
+
+    if (p == NULL || t->recording_failed || (in_bits == 0 && out_bits == 0)) {
+        return;
+    }
+
+    // Runs of plain copies, constants and expected values become single ops of up to 32 bits
+    if (p->n_ops > 0) {
+        setup_op* last = &p->ops[p->n_ops - 1];
+
+        bool same_width = in_bits == out_bits && last->read_bits == last->write_bits;
+        bool mergeable = type == SETUP_OP_CONST || ((type == SETUP_OP_COPY || type == SETUP_OP_EXPECT) && same_width);
+
+        if (mergeable && last->type == type && last->write_bits + out_bits <= 32) {
+            last->value |= value << last->write_bits;
+            last->read_bits += (uint8_t)in_bits;
+            last->write_bits += (uint8_t)out_bits;
+
+            return;
+        }
+    }
+
+    if (p->n_ops == p->capacity) {
+        uint32_t capacity = p->capacity ? p->capacity * 2 : 256;
+        setup_op* ops = realloc(p->ops, capacity * sizeof(setup_op));
+
+        if (ops == NULL) {
+            t->recording_failed = true;
+
+            return;
+        }
+
+        p->ops = ops;
+        p->capacity = capacity;
+    }
+
+    setup_op* op = &p->ops[p->n_ops++];
+    op->type = type;
+    op->read_bits = (uint8_t)in_bits;
+    op->write_bits = (uint8_t)out_bits;
+    op->value = value;
+    op->aux = aux;
+}
+
+// Transcribes a field that only carries data
+static uint32_t copy_field(transcriber* t, uint32_t in_bits, uint32_t out_bits) {
+    uint32_t value = in_bits ? read_bits(t->ss, in_bits) : 0;
+    bw_write(t->bw, new_uint_var(value, out_bits));
+
+    record_op(t, SETUP_OP_COPY, in_bits, out_bits, 0, 0);
+
+    return value;
+}
+
+// Transcribes a field that decides how the rest of the packet is laid out
+static uint32_t control_field(transcriber* t, uint32_t in_bits, uint32_t out_bits) {
+    uint32_t value = in_bits ? read_bits(t->ss, in_bits) : 0;
+    bw_write(t->bw, new_uint_var(value, out_bits));
+
+    record_op(t, SETUP_OP_EXPECT, in_bits, out_bits, value, 0);
+
+    return value;
+}
+
+// Transcribes a field that has to be below limit, returns false if it isn't
+static bool limited_field(transcriber* t, uint32_t in_bits, uint32_t out_bits, uint32_t limit, uint32_t* value) {
+    *value = read_bits(t->ss, in_bits);
+    bw_write(t->bw, new_uint_var(*value, out_bits));
+
+    record_op(t, SETUP_OP_LIMIT, in_bits, out_bits, limit, 0);
+
+    return *value < limit;
+}
+
+// Writes a field that isn't stored in the packet
+static void const_field(transcriber* t, uint32_t value, uint32_t out_bits) {
+    bw_write(t->bw, new_uint_var(value, out_bits));
+
+    record_op(t, SETUP_OP_CONST, 0, out_bits, value, 0);
+}
+
+// Checks that a residue classbook has an entry for every combination of classifications, as decoders require.
+// If strict, it also can't have more than one extra entry, which only an early encoder ever added
+static bool classbook_fits(const expanded_codebook* book, uint32_t classifications, bool strict) {
+    uint32_t dimensions = codebook_dimensions(book);
+    uint64_t partvals = 1;
+
+    for (uint32_t j = dimensions; j > 0 && partvals <= UINT32_MAX; j--) {
+        partvals *= classifications;
+    }
+
+    uint32_t entries = codebook_entries(book);
+
+    return dimensions != 0 && partvals <= entries && (!strict || entries <= partvals + 1);
+}
+
+// Checks that a floor1 masterbook has one entry for every combination of subclasses over the class
+// dimensions, which is how encoders build them. Only used in strict rebuilds, decoders don't require it
+static bool masterbook_fits(const expanded_codebook* book, uint32_t class_values) {
+    return codebook_entries(book) == class_values;
+}
+
+// Checks that a floor1 subclass book, if there is one, is a scalar codebook as encoders use them.
+// Only used in strict rebuilds
+static bool subclass_book_fits(const expanded_codebook* const* books, uint32_t subclass_book_plus1) {
+    return subclass_book_plus1 == 0 || codebook_dimensions(books[subclass_book_plus1 - 1]) == 1;
+}
+
+// Checks that a residue book is a vector codebook that splits partitions of partition_size evenly, as
+// encoders use them. Only used in strict rebuilds
+static bool residue_book_fits(const expanded_codebook* book, uint32_t partition_size) {
+    uint32_t dimensions = codebook_dimensions(book);
+
+    return dimensions != 0 && partition_size % dimensions == 0 && codebook_lookup_type(book) != 0;
+}
+
+// Rebuilds the setup header like rebuild_setup, recording the transcription into program unless it's NULL.
+// If strict, the codebooks also have to be laid out like encoders lay them out. Returns 2 if only recording failed
+static errno_t record_setup(bit_stream* ss, unsigned int channels, const codebook_library* cbl, arena* scratch,
+    vorbis_setup* setup, setup_program* program, bool strict, bool verbose) {
+    transcriber tr = { ss, &setup->bits, program, false };
+    transcriber* t = &tr;
+
+    unsigned int codebook_count = control_field(t, 8, 8) + 1;
+
+    // The codebooks referenced by the setup, in setup order
+    const expanded_codebook* books[256];
+
+    for (unsigned int i = 0; i < codebook_count; i++) {
+        uint32_t codebook_id = read_bits(ss, 10);
+
+        books[i] = get_expanded_codebook(cbl, codebook_id);
+        if (books[i] == NULL) {
+            SETUP_ERROR(verbose, "Invalid codebook id %u\n", codebook_id);
+
+            return 1;
+        }
+
+        bw_write_bits(t->bw, books[i]->bits, books[i]->n_bits);
+
+        record_op(t, SETUP_OP_CODEBOOK, 10, 0, 0, 0);
+    }
+
+    // Time domain transforms, which are placeholders in Vorbis I
+    const_field(t, 0, 6);
+    const_field(t, 0, 16);
+
+    // Floors
+    unsigned int floor_count = control_field(t, 6, 6) + 1;
+
+    for (unsigned int i = 0; i < floor_count; i++) {
+        // Floor type 1
+        const_field(t, 1, 16);
+
+        unsigned int floor1_partitions = control_field(t, 5, 5);
+
+        unsigned int* floor1_partition_class_list = arena_alloc(scratch, floor1_partitions * sizeof(unsigned int));
+
+        unsigned int maximum_class = 0;
+        for (unsigned int j = 0; j < floor1_partitions; j++) {
+            floor1_partition_class_list[j] = control_field(t, 4, 4);
+
+            if (floor1_partition_class_list[j] > maximum_class) {
+                maximum_class = floor1_partition_class_list[j];
+            }
+        }
+
+        unsigned int* floor1_class_dimensions_list = arena_alloc(scratch, (maximum_class + 1) * sizeof(unsigned int));
+
+        for (unsigned int j = 0; j <= maximum_class; j++) {
+            floor1_class_dimensions_list[j] = control_field(t, 3, 3) + 1;
+
+            unsigned int class_subclasses = control_field(t, 2, 2);
+
+            if (class_subclasses != 0) {
+                uint32_t masterbook = read_bits(ss, 8);
+                bw_write(t->bw, new_uint_var(masterbook, 8));
+
+                uint32_t class_values = 1U << (class_subclasses * floor1_class_dimensions_list[j]);
+                record_op(t, SETUP_OP_MASTERBOOK, 8, 8, codebook_count, class_values);
+
+                if (masterbook >= codebook_count) {
+                    SETUP_ERROR(verbose, "Invalid floor1 masterbook\n");
+
+                    return 1;
+                }
+
+                if (strict && !masterbook_fits(books[masterbook], class_values)) {
+                    SETUP_ERROR(verbose, "Floor1 masterbook doesn't match its class\n");
+
+                    return 1;
+                }
+            }
+
+            for (unsigned int k = 0; k < (1U << class_subclasses); k++) {
+                // Stored plus one, 0 means no book
+                uint32_t subclass_book_plus1 = read_bits(ss, 8);
+                bw_write(t->bw, new_uint_var(subclass_book_plus1, 8));
+
+                record_op(t, SETUP_OP_SUBCLASSBOOK, 8, 8, codebook_count + 1, 0);
+
+                if (subclass_book_plus1 >= codebook_count + 1) {
+                    SETUP_ERROR(verbose, "Invalid floor1 subclass book\n");
+
+                    return 1;
+                }
+
+                if (strict && !subclass_book_fits(books, subclass_book_plus1)) {
+                    SETUP_ERROR(verbose, "Floor1 subclass book isn't scalar\n");
+
+                    return 1;
+                }
+            }
+        }
+
+        // Multiplier
+        copy_field(t, 2, 2);
+
+        unsigned int rangebits = control_field(t, 4, 4);
+
+        for (unsigned int j = 0; j < floor1_partitions; j++) {
+            unsigned int current_class_number = floor1_partition_class_list[j];
+
+            for (unsigned int k = 0; k < floor1_class_dimensions_list[current_class_number]; k++) {
+                // X
+                copy_field(t, rangebits, rangebits);
+            }
+        }
+    }
+
+    // Residues
+    unsigned int residue_count = control_field(t, 6, 6) + 1;
+
+    for (unsigned int i = 0; i < residue_count; i++) {
+        uint32_t residue_type;
+        if (!limited_field(t, 2, 16, 3, &residue_type)) {
+            SETUP_ERROR(verbose, "Invalid residue type");
+
+            return 1;
+        }
+
+        // Begin and end
+        copy_field(t, 24, 24);
+        copy_field(t, 24, 24);
+
+        // The residue books are checked against the partition size
+        unsigned int residue_partition_size = control_field(t, 24, 24) + 1;
+
+        unsigned int residue_classifications = control_field(t, 6, 6) + 1;
+
+        uint32_t residue_classbook = read_bits(ss, 8);
+        bw_write(t->bw, new_uint_var(residue_classbook, 8));
+
+        record_op(t, SETUP_OP_CLASSBOOK, 8, 8, codebook_count, residue_classifications);
+
+        if (residue_classbook >= codebook_count) {
+            SETUP_ERROR(verbose, "Invalid residue classbook\n");
+
+            return 1;
+        }
+
+        if (!classbook_fits(books[residue_classbook], residue_classifications, strict)) {
+            SETUP_ERROR(verbose, "Residue classbook doesn't match the classifications\n");
+
+            return 1;
+        }
+
+        unsigned int* residue_cascade = arena_alloc(scratch, residue_classifications * sizeof(unsigned int));
+
+        for (unsigned int j = 0; j < residue_classifications; j++) {
+            unsigned int low_bits = control_field(t, 3, 3);
+            unsigned int high_bits = 0;
+
+            unsigned int bitflag = control_field(t, 1, 1);
+            if (bitflag) {
+                high_bits = control_field(t, 5, 5);
+            }
+
+            residue_cascade[j] = high_bits * 8 + low_bits;
+        }
+
+        for (unsigned int j = 0; j < residue_classifications; j++) {
+            for (unsigned int k = 0; k < 8; k++) {
+                if (residue_cascade[j] & (1 << k)) {
+                    uint32_t residue_book = read_bits(ss, 8);
+                    bw_write(t->bw, new_uint_var(residue_book, 8));
+
+                    record_op(t, SETUP_OP_RESIDUEBOOK, 8, 8, codebook_count, residue_partition_size);
+
+                    if (residue_book >= codebook_count) {
+                        SETUP_ERROR(verbose, "Invalid residue book\n");
+
+                        return 1;
+                    }
+
+                    if (strict && !residue_book_fits(books[residue_book], residue_partition_size)) {
+                        SETUP_ERROR(verbose, "Residue book doesn't match the partition size\n");
+
+                        return 1;
+                    }
+                }
+            }
+        }
+    }
+
+    // Mappings
+    unsigned int mapping_count = control_field(t, 6, 6) + 1;
+
+    for (unsigned int i = 0; i < mapping_count; i++) {
+        // Mapping type 0
+        const_field(t, 0, 16);
+
+        unsigned int submaps = 1;
+        if (control_field(t, 1, 1)) {
+            submaps = control_field(t, 4, 4) + 1;
+        }
+
+        unsigned int square_polar_flag = control_field(t, 1, 1);
+
+        if (square_polar_flag) {
+            unsigned int coupling_steps = control_field(t, 8, 8) + 1;
+
+            for (unsigned int j = 0; j < coupling_steps; j++) {
+                unsigned int magnitude = control_field(t, ilog(channels - 1), ilog(channels - 1));
+                unsigned int angle = control_field(t, ilog(channels - 1), ilog(channels - 1));
+
+                if (angle == magnitude || magnitude >= channels || angle >= channels) {
+                    SETUP_ERROR(verbose, "Invalid coupling\n");
+
+                    return 1;
+                }
+            }
+        }
+
+        unsigned int mapping_reserved = control_field(t, 2, 2);
+        if (mapping_reserved != 0) {
+            SETUP_ERROR(verbose, "Mapping reserved field nonzero\n");
+
+            return 1;
+        }
+
+        if (submaps > 1) {
+            for (unsigned int j = 0; j < channels; j++) {
+                uint32_t mapping_mux;
+                if (!limited_field(t, 4, 4, submaps, &mapping_mux)) {
+                    SETUP_ERROR(verbose, "mapping_mux >= submaps\n");
+
+                    return 1;
+                }
+            }
+        }
+
+        for (unsigned int j = 0; j < submaps; j++) {
+            // Time config
+            copy_field(t, 8, 8);
+
+            uint32_t floor_number;
+            if (!limited_field(t, 8, 8, floor_count, &floor_number)) {
+                SETUP_ERROR(verbose, "Invalid floor mapping\n");
+
+                return 1;
+            }
+
+            uint32_t residue_number;
+            if (!limited_field(t, 8, 8, residue_count, &residue_number)) {
+                SETUP_ERROR(verbose, "Invalid residue mapping\n");
+
+                return 1;
+            }
+        }
+    }
+
+    // Modes
+    unsigned int mode_count = control_field(t, 6, 6) + 1;
+
+    setup->mode_bits = ilog(mode_count - 1);
+    setup->long_windows = false;
+
+    for (unsigned int i = 0; i < mode_count; i++) {
+        setup->mode_blockflag[i] = control_field(t, 1, 1) != 0;
+        setup->long_windows |= setup->mode_blockflag[i];
+
+        // Window and transform type
+        const_field(t, 0, 16);
+        const_field(t, 0, 16);
+
+        uint32_t mapping;
+        if (!limited_field(t, 8, 8, mapping_count, &mapping)) {
+            SETUP_ERROR(verbose, "Invalid mode mapping\n");
+
+            return 1;
+        }
+    }
+
+    // Framing
+    const_field(t, 1, 1);
+
+    if (program != NULL) {
+        memcpy(program->mode_blockflag, setup->mode_blockflag, sizeof(program->mode_blockflag));
+        program->mode_bits = setup->mode_bits;
+        program->long_windows = setup->long_windows;
+    }
+
+    return tr.recording_failed ? 2 : 0;
+}
+
+errno_t rebuild_setup(bit_stream* ss, unsigned int channels, const codebook_library* cbl, arena* scratch, vorbis_setup* setup,
+    bool verbose) {
+    return record_setup(ss, channels, cbl, scratch, setup, NULL, false, verbose);
+}
+
+// Replays program on the setup packet read from ss. Returns false as soon as the packet doesn't fit it
+static bool replay_setup(const setup_program* program, bit_stream* ss, vorbis_setup* setup) {
+    bit_writer* bw = &setup->bits;
+    const expanded_codebook* books[256];
+    unsigned int n_books = 0;
+
+    for (uint32_t i = 0; i < program->n_ops; i++) {
+        const setup_op* op = &program->ops[i];
+        uint32_t value = 0;
+
+        if (op->type != SETUP_OP_CONST) {
+            value = read_bits(ss, op->read_bits);
+        }
+
+        switch (op->type) {
+            case SETUP_OP_COPY:
+                bw_write(bw, new_uint_var(value, op->write_bits));
+                break;
+
+            case SETUP_OP_CONST:
+                bw_write(bw, new_uint_var(op->value, op->write_bits));
+                break;
+
+            case SETUP_OP_EXPECT:
+                if (value != op->value) {
+                    return false;
+                }
+
+                bw_write(bw, new_uint_var(value, op->write_bits));
+                break;
+
+            case SETUP_OP_LIMIT:
+                if (value >= op->value) {
+                    return false;
+                }
+
+                bw_write(bw, new_uint_var(value, op->write_bits));
+                break;
+
+            case SETUP_OP_CODEBOOK:
+                books[n_books] = get_expanded_codebook(program->library, value);
+                if (books[n_books] == NULL) {
+                    return false;
+                }
+
+                bw_write_bits(bw, books[n_books]->bits, books[n_books]->n_bits);
+                n_books++;
+                break;
+
+            case SETUP_OP_CLASSBOOK:
+                if (value >= op->value || !classbook_fits(books[value], op->aux, program->strict)) {
+                    return false;
+                }
+
+                bw_write(bw, new_uint_var(value, op->write_bits));
+                break;
+
+            case SETUP_OP_MASTERBOOK:
+                if (value >= op->value || (program->strict && !masterbook_fits(books[value], op->aux))) {
+                    return false;
+                }
+
+                bw_write(bw, new_uint_var(value, op->write_bits));
+                break;
+
+            case SETUP_OP_SUBCLASSBOOK:
+                if (value >= op->value || (program->strict && !subclass_book_fits(books, value))) {
+                    return false;
+                }
+
+                bw_write(bw, new_uint_var(value, op->write_bits));
+                break;
+
+            case SETUP_OP_RESIDUEBOOK:
+                if (value >= op->value || (program->strict && !residue_book_fits(books[value], op->aux))) {
+                    return false;
+                }
+
+                bw_write(bw, new_uint_var(value, op->write_bits));
+                break;
+        }
+    }
+
+    memcpy(setup->mode_blockflag, program->mode_blockflag, sizeof(setup->mode_blockflag));
+    setup->mode_bits = program->mode_bits;
+    setup->long_windows = program->long_windows;
+
+    return true;
+}
+
+// Rebuilds the setup header with the codebooks of cbl, replaying a recorded program if one fits the packet
+// at offset and recording one otherwise. strict is passed on to record_setup
+static errno_t transcribe_setup(membuf* data, long offset, Packet p, unsigned int channels, const codebook_library* cbl,
+    arena* scratch, vorbis_setup* setup, bool strict, bool verbose) {
+    AcquireSRWLockShared(&setup_programs_lock);
+    unsigned int n_programs = n_setup_programs;
+    ReleaseSRWLockShared(&setup_programs_lock);
+
+    for (unsigned int i = 0; i < n_programs; i++) {
+        const setup_program* program = setup_programs[i];
+
+        if (program->channels != channels || program->packet_size != p.size || program->library != cbl ||
+            program->strict != strict) {
+            continue;
+        }
+
+        data->pos = offset;
+        bit_stream ss = new_bit_stream(data);
+
+        if (replay_setup(program, &ss, setup) && (ss.total_bits_read + 7) / 8 == p.size) {
+            return 0;
+        }
+
+        reset_vorbis_setup(setup);
+    }
+
+    setup_program* program = calloc(1, sizeof(setup_program));
+    if (program != NULL) {
+        program->channels = channels;
+        program->packet_size = p.size;
+        program->library = cbl;
+        program->strict = strict;
+    }
+
+    data->pos = offset;
+    bit_stream ss = new_bit_stream(data);
+
+    errno_t err = record_setup(&ss, channels, cbl, scratch, setup, program, strict, verbose);
+
+    if (err != 1 && (ss.total_bits_read + 7) / 8 != p.size) {
+        SETUP_ERROR(verbose, "Didn't fully read setup packet\n");
+
+        err = 1;
+    }
+
+    // Only complete recordings of valid packets are kept
+    if (err == 0 && program != NULL) {
+        AcquireSRWLockExclusive(&setup_programs_lock);
+
+        if (n_setup_programs < SETUP_PROGRAMS) {
+            setup_programs[n_setup_programs++] = program;
+            program = NULL;
+        }
+
+        ReleaseSRWLockExclusive(&setup_programs_lock);
+    }
+
+    if (program != NULL) {
+        free(program->ops);
+        free(program);
+    }
+
+    return (err == 1) ? 1 : 0;
+}
+
+// Continues an FNV-1a hash over size bytes of data
+static uint64_t fnv1a(uint64_t hash, const void* data, size_t size) {
+    const uint8_t* bytes = data;
+
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * UINT64_C(0x100000001b3);
+    }
+
+    return hash;
+}
+
+// Checksum of a whole cache record as it is stored in the file
+static uint64_t record_checksum(uint64_t hash, uint32_t channels, uint64_t libraries, const uint8_t* packet, uint32_t packet_size,
+    const uint8_t* bits, uint64_t n_bits, const uint8_t* mode_blockflag, int32_t mode_bits, uint8_t long_windows) {
+    uint64_t sum = UINT64_C(0xcbf29ce484222325);
+
+    sum = fnv1a(sum, &hash, 8);
+    sum = fnv1a(sum, &channels, 4);
+    sum = fnv1a(sum, &libraries, 8);
+    sum = fnv1a(sum, &packet_size, 4);
+    sum = fnv1a(sum, packet, packet_size);
+    sum = fnv1a(sum, &n_bits, 8);
+    sum = fnv1a(sum, bits, (size_t)((n_bits + 7) / 8));
+    sum = fnv1a(sum, mode_blockflag, 64);
+    sum = fnv1a(sum, &mode_bits, 4);
+    sum = fnv1a(sum, &long_windows, 1);
+
+    return sum;
+}
+
+static uint64_t setup_hash(uint32_t channels, const uint8_t* packet, uint32_t size) {
+    uint64_t hash = UINT64_C(0xcbf29ce484222325);
+
+    for (unsigned int i = 0; i < 4; i++) {
+        hash = (hash ^ ((channels >> (i * 8)) & 0xFF)) * UINT64_C(0x100000001b3);
+    }
+
+    for (uint32_t i = 0; i < size; i++) {
+        hash = (hash ^ packet[i]) * UINT64_C(0x100000001b3);
+    }
+
+    return hash;
+}
+
+// Returns the entry for the packet, or NULL. Must be called with the lock held
+static setup_cache_entry* find_entry(uint64_t hash, uint32_t channels, uint64_t libraries, const uint8_t* packet, uint32_t size) {
+    for (unsigned int i = 0; i < SETUP_CACHE_ENTRIES; i++) {
+        setup_cache_entry* e = &setup_cache[i];
+
+        if (e->last_used != 0 && e->hash == hash && e->channels == channels && e->libraries == libraries && e->packet_size == size &&
+            memcmp(e->packet, packet, size) == 0) {
+            return e;
+        }
+    }
+
+    return NULL;
+}
+
+// Stores a copy of the setup in the unused or least recently used entry. Must be called with the lock held
+static void insert_entry(uint64_t hash, uint32_t channels, uint64_t libraries, const uint8_t* packet, uint32_t size,
+    const vorbis_setup* setup) {
+    if (find_entry(hash, channels, libraries, packet, size) != NULL) {
+        return;
+    }
+
+    setup_cache_entry* e = &setup_cache[0];
+    for (unsigned int i = 1; i < SETUP_CACHE_ENTRIES && e->last_used != 0; i++) {
+        if (setup_cache[i].last_used < e->last_used) {
+            e = &setup_cache[i];
+        }
+    }
+
+    size_t n_bytes = (size_t)((setup->bits.n_bits + 7) / 8);
+    uint8_t* packet_copy = malloc(size);
+    uint8_t* bits_copy = malloc(n_bytes);
+
+    if (packet_copy == NULL || bits_copy == NULL) {
+        free(packet_copy);
+        free(bits_copy);
+
+        return;
+    }
+
+    free(e->packet);
+    free(e->bits);
+
+    memcpy(packet_copy, packet, size);
+    memcpy(bits_copy, setup->bits.data, n_bytes);
+
+    e->hash = hash;
+    e->channels = channels;
+    e->libraries = libraries;
+    e->packet = packet_copy;
+    e->packet_size = size;
+    e->bits = bits_copy;
+    e->n_bits = setup->bits.n_bits;
+    memcpy(e->mode_blockflag, setup->mode_blockflag, sizeof(e->mode_blockflag));
+    e->mode_bits = setup->mode_bits;
+    e->long_windows = setup->long_windows;
+    e->last_used = ++setup_cache_clock;
+}
+
+errno_t get_vorbis_setup(membuf* data, Packet p, unsigned int channels, arena* scratch, vorbis_setup* setup) {
+    long offset = packet_offset(p);
+
+    if ((uint64_t)offset + p.size > data->size) {
+        perrf("Setup packet truncated\n");
+
+        return 1;
+    }
+
+    const uint8_t* packet = (const uint8_t*)&data->data[offset];
+    uint64_t hash = setup_hash(channels, packet, p.size);
+    uint64_t libraries = codebook_libraries_hash();
+
+    AcquireSRWLockExclusive(&setup_cache_lock);
+
+    setup_cache_entry* e = find_entry(hash, channels, libraries, packet, p.size);
+    if (e != NULL) {
+        e->last_used = ++setup_cache_clock;
+
+        bw_write_bits(&setup->bits, e->bits, e->n_bits);
+        memcpy(setup->mode_blockflag, e->mode_blockflag, sizeof(setup->mode_blockflag));
+        setup->mode_bits = e->mode_bits;
+        setup->long_windows = e->long_windows;
+    }
+
+    ReleaseSRWLockExclusive(&setup_cache_lock);
+
+    if (e != NULL) {
+        return 0;
+    }
+
+    // Any library whose codebook ids are in range gives a valid header, so the libraries are first held to
+    // how encoders lay out their codebooks, which the wrong ones rarely match. Setups that no library
+    // matches that way get the first library that is merely valid. Only the last one tried reports why
+    // it didn't fit
+    unsigned int n = codebook_library_count();
+    errno_t err = 1;
+
+    for (unsigned int i = 0; i < n * 2 && err != 0; i++) {
+        reset_vorbis_setup(setup);
+
+        err = transcribe_setup(data, offset, p, channels, codebook_library_at(i % n), scratch, setup, i < n, i == n * 2 - 1);
+    }
+
+    if (err != 0) {
+        return 1;
+    }
+
+    AcquireSRWLockExclusive(&setup_cache_lock);
+    insert_entry(hash, channels, libraries, packet, p.size, setup);
+    ReleaseSRWLockExclusive(&setup_cache_lock);
+
+    return 0;
+}
+
+errno_t load_setup_cache(const char* path) {
+    FILE* f;
+    if (fopen_s(&f, path, "rb") != 0) {
+        return 0;
+    }
+
+    char magic[8];
+    uint32_t version = 0;
+    uint32_t count = 0;
+
+    if (fread(magic, 1, 8, f) != 8 || memcmp(magic, SETUP_CACHE_MAGIC, 8) != 0 ||
+        fread(&version, 4, 1, f) != 1 || version != SETUP_CACHE_VERSION || fread(&count, 4, 1, f) != 1) {
+        perrf("'%s' is not a setup cache\n", path);
+        fclose(f);
+
+        return 1;
+    }
+
+    // A damaged record is left out, so its setup is rebuilt like any other cache miss. Sizes out of
+    // bounds leave no way to find the next record, so the rest of the file is dropped as well
+    bool damaged = false;
+
+    for (uint32_t i = 0; i < count; i++) {
+        uint64_t hash, libraries;
+        uint32_t channels, packet_size;
+        uint64_t n_bits;
+        uint8_t mode_blockflag[64];
+        int32_t mode_bits;
+        uint8_t long_windows;
+        uint64_t checksum;
+
+        if (fread(&hash, 8, 1, f) != 1 || fread(&channels, 4, 1, f) != 1 || fread(&libraries, 8, 1, f) != 1 ||
+            fread(&packet_size, 4, 1, f) != 1 || packet_size > SETUP_CACHE_MAX_BYTES) {
+            damaged = true;
+            break;
+        }
+
+        uint8_t* packet = malloc(packet_size);
+
+        if (packet == NULL || fread(packet, 1, packet_size, f) != packet_size || fread(&n_bits, 8, 1, f) != 1 ||
+            n_bits > (uint64_t)SETUP_CACHE_MAX_BYTES * 8) {
+            free(packet);
+
+            damaged = true;
+            break;
+        }
+
+        size_t n_bytes = (size_t)((n_bits + 7) / 8);
+        uint8_t* bits = malloc(n_bytes);
+
+        if (bits == NULL || fread(bits, 1, n_bytes, f) != n_bytes || fread(mode_blockflag, 1, 64, f) != 64 ||
+            fread(&mode_bits, 4, 1, f) != 1 || fread(&long_windows, 1, 1, f) != 1 || fread(&checksum, 8, 1, f) != 1) {
+            free(bits);
+            free(packet);
+
+            damaged = true;
+            break;
+        }
+
+        if (checksum != record_checksum(hash, channels, libraries, packet, packet_size, bits, n_bits, mode_blockflag, mode_bits, long_windows) ||
+            setup_hash(channels, packet, packet_size) != hash || mode_bits < 0 || mode_bits > SETUP_MAX_MODE_BITS) {
+            damaged = true;
+        } else {
+            vorbis_setup setup = new_vorbis_setup();
+
+            bw_write_bits(&setup.bits, bits, n_bits);
+
+            for (unsigned int j = 0; j < 64; j++) {
+                setup.mode_blockflag[j] = mode_blockflag[j] != 0;
+            }
+
+            setup.mode_bits = mode_bits;
+            setup.long_windows = long_windows != 0;
+
+            AcquireSRWLockExclusive(&setup_cache_lock);
+            insert_entry(hash, channels, libraries, packet, packet_size, &setup);
+            ReleaseSRWLockExclusive(&setup_cache_lock);
+
+            free_vorbis_setup(&setup);
+        }
+
+        free(bits);
+        free(packet);
+    }
+
+    fclose(f);
+
+    if (damaged) {
+        perrf("Setup cache '%s' is damaged, its damaged entries are rebuilt\n", path);
+    }
+
+    return 0;
+}
+
+errno_t save_setup_cache(const char* path) {
+    FILE* f;
+    if (fopen_s(&f, path, "wb") != 0) {
+        perrf("Can't open '%s' for writing\n", path);
+
+        return 1;
+    }
+
+    AcquireSRWLockShared(&setup_cache_lock);
+
+    uint32_t version = SETUP_CACHE_VERSION;
+    uint32_t count = 0;
+    for (unsigned int i = 0; i < SETUP_CACHE_ENTRIES; i++) {
+        count += setup_cache[i].last_used != 0;
+    }
+
+    fwrite(SETUP_CACHE_MAGIC, 1, 8, f);
+    fwrite(&version, 4, 1, f);
+    fwrite(&count, 4, 1, f);
+
+    // Oldest entries first, so loading the file restores the order of use
+    uint64_t last = 0;
+    for (uint32_t n = 0; n < count; n++) {
+        setup_cache_entry* e = NULL;
+        for (unsigned int i = 0; i < SETUP_CACHE_ENTRIES; i++) {
+            if (setup_cache[i].last_used > last && (e == NULL || setup_cache[i].last_used < e->last_used)) {
+                e = &setup_cache[i];
+            }
+        }
+
+        last = e->last_used;
+
+        uint8_t mode_blockflag[64];
+        for (unsigned int j = 0; j < 64; j++) {
+            mode_blockflag[j] = e->mode_blockflag[j];
+        }
+
+        int32_t mode_bits = e->mode_bits;
+        uint8_t long_windows = e->long_windows;
+
+        fwrite(&e->hash, 8, 1, f);
+        fwrite(&e->channels, 4, 1, f);
+        fwrite(&e->libraries, 8, 1, f);
+        fwrite(&e->packet_size, 4, 1, f);
+        fwrite(e->packet, 1, e->packet_size, f);
+        fwrite(&e->n_bits, 8, 1, f);
+        fwrite(e->bits, 1, (size_t)((e->n_bits + 7) / 8), f);
+        fwrite(mode_blockflag, 1, 64, f);
+        fwrite(&mode_bits, 4, 1, f);
+        fwrite(&long_windows, 1, 1, f);
+
+        uint64_t checksum = record_checksum(e->hash, e->channels, e->libraries, e->packet, e->packet_size, e->bits, e->n_bits,
+            mode_blockflag, mode_bits, long_windows);
+        fwrite(&checksum, 8, 1, f);
+    }
+
+    ReleaseSRWLockShared(&setup_cache_lock);
+
+    errno_t err = ferror(f) ? 1 : 0;
+    if (fclose(f) != 0 || err != 0) {
+        perrf("Error writing setup cache '%s'\n", path);
+
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "defs.h"
+#include "bitmanip.h"
+#include "codebook.h"
+#include "arena.h"
+
+// Number of rebuilt setup headers kept in memory
+#define SETUP_CACHE_ENTRIES 64
+
+// Maximum number of recorded setup transcriptions, one for each setup layout
+#define SETUP_PROGRAMS 64
+
+// A Vorbis setup header rebuilt from a Wwise setup packet, with the mode information the audio packets need
+typedef struct vorbis_setup {
+    // The setup header, without the packet type and signature
+    bit_writer bits;
+
+    // Whether each mode uses long windows, invalid mode numbers read as short windows
+    bool mode_blockflag[64];
+
+    // Number of bits of the mode number in audio packets
+    int mode_bits;
+
+    // Whether any mode uses long windows
+    bool long_windows;
+} vorbis_setup;
+
+// Creates an empty vorbis_setup
+vorbis_setup new_vorbis_setup(void);
+
+// Empties a vorbis_setup for the next header, keeping the buffer of its bits
+void reset_vorbis_setup(vorbis_setup* setup);
+
+// Frees the header bits of a vorbis_setup
+void free_vorbis_setup(vorbis_setup* setup);
+
+// Rebuilds the setup header from the Wwise setup packet read from ss into setup, using the codebooks of cbl.
+// Temporaries come from scratch. Errors are only reported if verbose is set
+errno_t rebuild_setup(bit_stream* ss, unsigned int channels, const codebook_library* cbl, arena* scratch, vorbis_setup* setup,
+    bool verbose);
+
+// Gets the setup header for the Wwise setup packet p in data, either from the cache or by rebuilding it
+// with the first codebook library that fits. Temporaries come from scratch
+errno_t get_vorbis_setup(membuf* data, Packet p, unsigned int channels, arena* scratch, vorbis_setup* setup);
+
+// Adds the setup headers saved in the file at path to the cache. A missing file counts as an empty cache and
+// damaged records are skipped. Returns nonzero if the file isn't a setup cache
+errno_t load_setup_cache(const char* path);
+
+// Saves the cached setup headers to the file at path
+errno_t save_setup_cache(const char* path);
@@ -0,0 +1,174 @@
+#include "sink.h"
+
+#include <errno.h>
+#include <limits.h>
+
+static ogg_sink new_sink(void) {
+    ogg_sink s;
+    s.write = NULL;
+    s.flush = NULL;
+    s.fd = -1;
+    s.buffer = NULL;
+    s.size = 0;
+    s.capacity = 0;
+    s.callback = NULL;
+    s.user = NULL;
+    s.total_bytes = 0;
+    s.error = 0;
+
+    return s;
+}
+
+// Writes everything to the descriptor, retrying on partial writes
+static errno_t fd_write_all(int fd, const uint8_t* data, size_t size) {
+    while (size > 0) {
+        unsigned int chunk = (size > INT_MAX) ? INT_MAX : (unsigned int)size;
+        int written = _write(fd, data, chunk);
+
+        // errno is only set when _write fails, a write of nothing leaves it stale
+        if (written < 0) {
+            return errno;
+        }
+
+        if (written == 0) {
+            return EIO;
+        }
+
+        data += written;
+        size -= written;
+    }
+
+    return 0;
+}
+
+static errno_t fd_sink_flush(ogg_sink* sink) {
+    errno_t err = fd_write_all(sink->fd, sink->buffer, sink->size);
+    sink->size = 0;
+
+    return err;
+}
+
+static errno_t fd_sink_write(ogg_sink* sink, const uint8_t* data, size_t size) {
+    if (sink->size + size > sink->capacity) {
+        errno_t err = fd_sink_flush(sink);
+        if (err != 0) {
+            return err;
+        }
+    }
+
+    // Anything that doesn't fit in the empty buffer goes out directly
+    if (size >= sink->capacity) {
+        return fd_write_all(sink->fd, data, size);
+    }
+
+    memcpy(&sink->buffer[sink->size], data, size);
+    sink->size += size;
+
+    return 0;
+}
+
+ogg_sink new_fd_sink(int fd) {
+    ogg_sink s = new_sink();
+    s.write = fd_sink_write;
+    s.flush = fd_sink_flush;
+    s.fd = fd;
+    s.buffer = malloc(FD_SINK_BUFFER_SIZE);
+    s.capacity = FD_SINK_BUFFER_SIZE;
+
+    if (!s.buffer) {
+        s.error = ENOMEM;
+    }
+
+    return s;
+}
+
+void reset_fd_sink(ogg_sink* sink, int fd) {
+    sink->fd = fd;
+    sink->size = 0;
+    sink->total_bytes = 0;
+    sink->error = 0;
+
+    // A buffer that couldn't be allocated before is tried again
+    if (sink->buffer == NULL) {
+        sink->buffer = malloc(FD_SINK_BUFFER_SIZE);
+        sink->capacity = sink->buffer ? FD_SINK_BUFFER_SIZE : 0;
+
+        if (!sink->buffer) {
+            sink->error = ENOMEM;
+        }
+    }
+}
+
+static errno_t memory_sink_write(ogg_sink* sink, const uint8_t* data, size_t size) {
+    if (sink->size + size > sink->capacity) {
+        size_t capacity = sink->capacity ? sink->capacity : 0x10000;
+        while (capacity < sink->size + size) {
+            capacity *= 2;
+        }
+
+        uint8_t* buffer = realloc(sink->buffer, capacity);
+        if (!buffer) {
+            return ENOMEM;
+        }
+
+        sink->buffer = buffer;
+        sink->capacity = capacity;
+    }
+
+    memcpy(&sink->buffer[sink->size], data, size);
+    sink->size += size;
+
+    return 0;
+}
+
+ogg_sink new_memory_sink(void) {
+    ogg_sink s = new_sink();
+    s.write = memory_sink_write;
+
+    return s;
+}
+
+static errno_t callback_sink_write(ogg_sink* sink, const uint8_t* data, size_t size) {
+    return sink->callback(sink->user, data, size);
+}
+
+ogg_sink new_callback_sink(errno_t(*callback)(void* user, const uint8_t* page, size_t size), void* user) {
+    ogg_sink s = new_sink();
+    s.write = callback_sink_write;
+    s.callback = callback;
+    s.user = user;
+
+    return s;
+}
+
+ogg_sink new_null_sink(void) {
+    return new_sink();
+}
+
+errno_t sink_write(ogg_sink* sink, const uint8_t* data, size_t size) {
+    if (sink->error == 0) {
+        if (sink->write) {
+            sink->error = sink->write(sink, data, size);
+        }
+
+        sink->total_bytes += size;
+    }
+
+    return sink->error;
+}
+
+errno_t sink_flush(ogg_sink* sink) {
+    if (sink->error == 0 && sink->flush) {
+        sink->error = sink->flush(sink);
+    }
+
+    return sink->error;
+}
+
+void free_sink(ogg_sink* sink) {
+    free(sink->buffer);
+
+    sink->buffer = NULL;
+    sink->size = 0;
+    sink->capacity = 0;
+}
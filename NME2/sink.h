@@ -0,0 +1,55 @@
+#pragma once
+
+#include "defs.h"
+
+#define FD_SINK_BUFFER_SIZE (1 << 20)
+
+// Destination of the Ogg pages produced by an ogg_output_stream
+typedef struct ogg_sink {
+    // Backend specific write and flush, see sink_write and sink_flush
+    errno_t(*write)(struct ogg_sink* sink, const uint8_t* data, size_t size);
+    errno_t(*flush)(struct ogg_sink* sink);
+
+    // File descriptor written to by fd sinks
+    int fd;
+
+    // Pending bytes for fd sinks, all output for memory sinks
+    uint8_t* buffer;
+    size_t size;
+    size_t capacity;
+
+    // Receives every page of callback sinks
+    errno_t(*callback)(void* user, const uint8_t* page, size_t size);
+    void* user;
+
+    // Total number of bytes written to the sink
+    uint64_t total_bytes;
+
+    // First error returned by the backend, the sink drops all writes after an error
+    errno_t error;
+} ogg_sink;
+
+// A sink that writes to a file descriptor, buffering small writes into large ones
+ogg_sink new_fd_sink(int fd);
+
+// A sink that collects all output in a growable buffer (buffer and size)
+ogg_sink new_memory_sink(void);
+
+// A sink that passes every page to callback as soon as it is complete
+ogg_sink new_callback_sink(errno_t(*callback)(void* user, const uint8_t* page, size_t size), void* user);
+
+// A sink that only counts the bytes written to it
+ogg_sink new_null_sink(void);
+
+// Writes size bytes to the sink, returns the sink's error state
+errno_t sink_write(ogg_sink* sink, const uint8_t* data, size_t size);
+
+// Writes out any buffered data, returns the sink's error state
+errno_t sink_flush(ogg_sink* sink);
+
+// Points an fd sink at fd for the next output. Pending bytes, the byte count and the error state are dropped,
+// the buffer is kept
+void reset_fd_sink(ogg_sink* sink, int fd);
+
+// Releases the sink's buffer, does not close file descriptors
+void free_sink(ogg_sink* sink);
@@ -225,7 +225,7 @@ wchar_t* MakePathW(fpath path){
     return output;
 }
 
-char* ConstructCommand(File* file) {
+char* ConstructCommand(File* file, bool wav) {
     char* cmd = malloc(CMD_MAX_LENGTH);
 
     SYSTEM_INFO* info = malloc(sizeof(SYSTEM_INFO));
@@ -243,7 +243,8 @@ char* ConstructCommand(File* file) {
                 thread_count, file->args.video_args.format, MakePath(file->output));
             break;
         case FORMAT_WSP:
-            sprintf_s(cmd, CMD_MAX_LENGTH, CMD_BASE_AUDIO,
+            // A WAV needs no Ogg remuxing, so a single ffmpeg reads it straight from the pipe
+            sprintf_s(cmd, CMD_MAX_LENGTH, wav ? CMD_BASE_AUDIO_WAV : CMD_BASE_AUDIO,
                 file->args.audio_args.encoder, file->args.audio_args.quality,
                 file->args.audio_args.sample_fmt, thread_count,
                 MakePath(file->output));
@@ -36,8 +36,8 @@ void PrintSettingsVideo(File* file);
 char* MakePath(fpath path);
 wchar_t* MakePathW(fpath path);
 
-// Constructs the conversion command from a given File struct
-char* ConstructCommand(File* file);
+// Constructs the conversion command from a given File struct, wav selects the command for audio piped in as a WAV
+char* ConstructCommand(File* file, bool wav);
 
 // Writes the buffer to the log, prepended with a timestamp
 void WriteToLog(const char* str);
@@ -0,0 +1,363 @@
+#include "wav.h"
+#include "cpu.h"
+#include "utils.h"
+
+#if CPU_X86
+#include <immintrin.h>
+#endif
+
+// Bytes of PCM decoded from IMA ADPCM before they are written out, at least one block is always decoded
+#define IMA_DECODE_BYTES (64 * 1024)
+
+static const int32_t ima_step_table[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97,
+    107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+    876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428,
+    4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350,
+    22385, 24623, 27086, 29794, 32767
+};
+
+static const int32_t ima_index_table[16] = {
+    -1, -1, -1, -1, 2, 4, 6, 8,
+    -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+// The fmt and data chunks of a RIFF, with the fmt fields create_wav needs
+typedef struct wav_chunks {
+    long fmt_offset;
+    uint32_t fmt_size;
+
+    long data_offset;
+    uint32_t data_size;
+
+    uint16_t codec;
+    uint16_t channels;
+    uint32_t sample_rate;
+    uint16_t block_align;
+    uint16_t bits_per_sample;
+} wav_chunks;
+
+// Finds the fmt and data chunks of the RIFF in data, both of which have to fit in the buffer
+static bool read_wav_chunks(membuf* data, wav_chunks* chunks) {
+    if (data->size < 12 || memcmp(data->data, "RIFF", 4) != 0 || memcmp(&data->data[8], "WAVE", 4) != 0) {
+        return false;
+    }
+
+    uint64_t riff_end = (uint64_t)read_32_buf((unsigned char*)&data->data[4]) + 8;
+    if (riff_end > data->size) {
+        riff_end = data->size;
+    }
+
+    chunks->fmt_offset = -1;
+    chunks->data_offset = -1;
+
+    uint64_t chunk_offset = 12;
+    while (chunk_offset + 8 <= riff_end) {
+        const char* chunk_type = &data->data[chunk_offset];
+        uint32_t chunk_size = read_32_buf((unsigned char*)&data->data[chunk_offset + 4]);
+
+        if (chunk_offset + 8 + chunk_size > riff_end) {
+            return false;
+        }
+
+        if (memcmp(chunk_type, "fmt ", 4) == 0) {
+            chunks->fmt_offset = (long)chunk_offset + 8;
+            chunks->fmt_size = chunk_size;
+        } else if (memcmp(chunk_type, "data", 4) == 0) {
+            chunks->data_offset = (long)chunk_offset + 8;
+            chunks->data_size = chunk_size;
+        }
+
+        chunk_offset += 8 + chunk_size;
+    }
+
+    if (chunks->fmt_offset == -1 || chunks->data_offset == -1 || chunks->fmt_size < 0x10) {
+        return false;
+    }
+
+    unsigned char* fmt = (unsigned char*)&data->data[chunks->fmt_offset];
+    chunks->codec = read_16_buf(&fmt[0]);
+    chunks->channels = read_16_buf(&fmt[2]);
+    chunks->sample_rate = read_32_buf(&fmt[4]);
+    chunks->block_align = read_16_buf(&fmt[12]);
+    chunks->bits_per_sample = read_16_buf(&fmt[14]);
+
+    return true;
+}
+
+uint16_t wem_codec(membuf* data) {
+    wav_chunks chunks;
+
+    if (!read_wav_chunks(data, &chunks)) {
+        return 0;
+    }
+
+    return chunks.codec;
+}
+
+bool wem_is_wav(uint16_t codec) {
+    return codec == WEM_CODEC_PCM || codec == WEM_CODEC_EXTENSIBLE || codec == WEM_CODEC_IMA_ADPCM;
+}
+
+static void write_16(unsigned char b[2], uint16_t v) {
+    b[0] = (unsigned char)v;
+    b[1] = (unsigned char)(v >> 8);
+}
+
+// Fills in a WAV header with a plain PCM fmt chunk, followed by data_size bytes of samples
+static void write_wav_header(unsigned char header[WAV_HEADER_SIZE], uint16_t channels, uint32_t sample_rate,
+    uint16_t bits_per_sample, uint32_t data_size) {
+    uint16_t block_align = channels * (bits_per_sample / 8);
+
+    memcpy(&header[0], "RIFF", 4);
+    write_32(&header[4], WAV_HEADER_SIZE - 8 + data_size);
+    memcpy(&header[8], "WAVE", 4);
+
+    memcpy(&header[12], "fmt ", 4);
+    write_32(&header[16], 0x10);
+    write_16(&header[20], WEM_CODEC_PCM);
+    write_16(&header[22], channels);
+    write_32(&header[24], sample_rate);
+    write_32(&header[28], sample_rate * block_align);
+    write_16(&header[32], block_align);
+    write_16(&header[34], bits_per_sample);
+
+    memcpy(&header[36], "data", 4);
+    write_32(&header[40], data_size);
+}
+
+// Decodes count sub-blocks starting at sub-block first, sub-block i holds channel i % channels of block i / channels
+static void decode_ima_scalar(const uint8_t* src, size_t first, size_t count, unsigned int channels, uint32_t sub_block,
+    int16_t* dst) {
+    uint32_t block_samples = (sub_block - 4) * 2;
+
+    for (size_t i = first; i < first + count; i++) {
+        const uint8_t* in = &src[i * sub_block];
+        int16_t* out = &dst[(i / channels) * block_samples * channels + i % channels];
+
+        // The header holds the first sample and the starting step
+        int32_t predictor = (int16_t)(in[0] | (in[1] << 8));
+        int32_t index = (in[2] > 88) ? 88 : in[2];
+
+        out[0] = (int16_t)predictor;
+
+        // Nibbles are stored low first, the last one of the sub-block is unused
+        for (uint32_t s = 1; s < block_samples; s++) {
+            uint32_t nibble = (in[4 + (s - 1) / 2] >> (((s - 1) & 1) * 4)) & 0xF;
+            int32_t step = ima_step_table[index];
+
+            int32_t diff = step >> 3;
+            if (nibble & 4) {
+                diff += step;
+            }
+            if (nibble & 2) {
+                diff += step >> 1;
+            }
+            if (nibble & 1) {
+                diff += step >> 2;
+            }
+            if (nibble & 8) {
+                diff = -diff;
+            }
+
+            predictor += diff;
+            if (predictor > INT16_MAX) {
+                predictor = INT16_MAX;
+            } else if (predictor < INT16_MIN) {
+                predictor = INT16_MIN;
+            }
+
+            index += ima_index_table[nibble];
+            if (index < 0) {
+                index = 0;
+            } else if (index > 88) {
+                index = 88;
+            }
+
+            out[s * channels] = (int16_t)predictor;
+        }
+    }
+}
+
+#if CPU_X86
+// Clamps the step indices to the step table
+TARGET("sse2")
+static inline __m128i ima_clamp_index(__m128i index) {
+    const __m128i max_index = _mm_set1_epi32(88);
+
+    index = _mm_andnot_si128(_mm_cmplt_epi32(index, _mm_setzero_si128()), index);
+
+    __m128i over = _mm_cmpgt_epi32(index, max_index);
+    return _mm_or_si128(_mm_and_si128(over, max_index), _mm_andnot_si128(over, index));
+}
+
+// Every sub-block starts from its own header, so four of them are decoded side by side, one in each lane.
+// Only the step table lookups stay scalar. Decodes the first count sub-blocks, count has to be a multiple
+// of 4 and the nibbles of a sub-block a multiple of 4 bytes
+TARGET("sse2")
+static void decode_ima_sse2(const uint8_t* src, size_t count, unsigned int channels, uint32_t sub_block, int16_t* dst) {
+    uint32_t block_samples = (sub_block - 4) * 2;
+    const __m128i nibble_mask = _mm_set1_epi32(0xF);
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i two = _mm_set1_epi32(2);
+    const __m128i four = _mm_set1_epi32(4);
+    const __m128i eight = _mm_set1_epi32(8);
+    const __m128i three = _mm_set1_epi32(3);
+
+    for (size_t i = 0; i < count; i += 4) {
+        const uint8_t* in[4];
+        int16_t* out[4];
+
+        for (size_t l = 0; l < 4; l++) {
+            in[l] = &src[(i + l) * sub_block];
+            out[l] = &dst[((i + l) / channels) * block_samples * channels + (i + l) % channels];
+        }
+
+        __m128i predictor = _mm_setr_epi32(
+            (int16_t)(in[0][0] | (in[0][1] << 8)), (int16_t)(in[1][0] | (in[1][1] << 8)),
+            (int16_t)(in[2][0] | (in[2][1] << 8)), (int16_t)(in[3][0] | (in[3][1] << 8)));
+        __m128i index = ima_clamp_index(_mm_setr_epi32(in[0][2], in[1][2], in[2][2], in[3][2]));
+
+        for (size_t l = 0; l < 4; l++) {
+            out[l][0] = (int16_t)(in[l][0] | (in[l][1] << 8));
+        }
+
+        uint32_t s = 1;
+        for (uint32_t w = 4; w < sub_block; w += 4) {
+            // 8 nibbles of every lane, shifted down as they are consumed
+            uint32_t words[4];
+            for (size_t l = 0; l < 4; l++) {
+                memcpy(&words[l], &in[l][w], 4);
+            }
+
+            __m128i word = _mm_loadu_si128((const __m128i*)words);
+
+            for (int j = 0; j < 8 && s < block_samples; j++, s++) {
+                __m128i nibble = _mm_and_si128(word, nibble_mask);
+                word = _mm_srli_epi32(word, 4);
+
+                int32_t indices[4];
+                _mm_storeu_si128((__m128i*)indices, index);
+
+                __m128i step = _mm_setr_epi32(ima_step_table[indices[0]], ima_step_table[indices[1]],
+                    ima_step_table[indices[2]], ima_step_table[indices[3]]);
+
+                __m128i diff = _mm_srli_epi32(step, 3);
+                diff = _mm_add_epi32(diff, _mm_and_si128(_mm_cmpeq_epi32(_mm_and_si128(nibble, four), four), step));
+                diff = _mm_add_epi32(diff, _mm_and_si128(_mm_cmpeq_epi32(_mm_and_si128(nibble, two), two), _mm_srli_epi32(step, 1)));
+                diff = _mm_add_epi32(diff, _mm_and_si128(_mm_cmpeq_epi32(_mm_and_si128(nibble, one), one), _mm_srli_epi32(step, 2)));
+
+                __m128i negative = _mm_cmpeq_epi32(_mm_and_si128(nibble, eight), eight);
+                diff = _mm_sub_epi32(_mm_xor_si128(diff, negative), negative);
+
+                // Saturating to 16 bits and sign extending back clamps the predictor
+                __m128i samples = _mm_packs_epi32(_mm_add_epi32(predictor, diff), _mm_setzero_si128());
+                predictor = _mm_srai_epi32(_mm_unpacklo_epi16(samples, samples), 16);
+
+                // The index moves down by 1 for magnitudes below 4, and up by 2, 4, 6 or 8 otherwise
+                __m128i magnitude = _mm_and_si128(nibble, _mm_set1_epi32(7));
+                __m128i small = _mm_cmplt_epi32(magnitude, four);
+                __m128i delta = _mm_or_si128(small, _mm_andnot_si128(small, _mm_slli_epi32(_mm_sub_epi32(magnitude, three), 1)));
+                index = ima_clamp_index(_mm_add_epi32(index, delta));
+
+                out[0][s * channels] = (int16_t)_mm_extract_epi16(samples, 0);
+                out[1][s * channels] = (int16_t)_mm_extract_epi16(samples, 1);
+                out[2][s * channels] = (int16_t)_mm_extract_epi16(samples, 2);
+                out[3][s * channels] = (int16_t)_mm_extract_epi16(samples, 3);
+            }
+        }
+    }
+}
+#endif
+
+void decode_ima_blocks(const uint8_t* src, size_t n_blocks, unsigned int channels, uint32_t sub_block, int16_t* dst) {
+    size_t count = n_blocks * channels;
+    size_t done = 0;
+
+#if CPU_X86
+    if ((sub_block - 4) % 4 == 0 && cpu_supports(CPU_SSE2)) {
+        done = count & ~(size_t)3;
+        decode_ima_sse2(src, done, channels, sub_block, dst);
+    }
+#endif
+
+    decode_ima_scalar(src, done, count - done, channels, sub_block, dst);
+}
+
+errno_t create_wav(conversion_context* ctx, membuf* data, ogg_sink* out) {
+    arena* scratch = &ctx->scratch;
+    reset_arena(scratch);
+
+    wav_chunks chunks;
+    if (!read_wav_chunks(data, &chunks)) {
+        perrf("fmt and data chunks are required\n");
+
+        return 1;
+    }
+
+    if (chunks.channels == 0 || chunks.block_align == 0) {
+        perrf("Invalid fmt chunk\n");
+
+        return 1;
+    }
+
+    const uint8_t* samples = (const uint8_t*)&data->data[chunks.data_offset];
+    unsigned char header[WAV_HEADER_SIZE];
+
+    if (chunks.codec == WEM_CODEC_PCM || chunks.codec == WEM_CODEC_EXTENSIBLE) {
+        if (chunks.bits_per_sample % 8 != 0 || chunks.block_align != chunks.channels * (chunks.bits_per_sample / 8)) {
+            perrf("Invalid PCM block alignment\n");
+
+            return 1;
+        }
+
+        // The samples are already in WAV order, only the header changes
+        write_wav_header(header, chunks.channels, chunks.sample_rate, chunks.bits_per_sample, chunks.data_size);
+
+        sink_write(out, header, WAV_HEADER_SIZE);
+        sink_write(out, samples, chunks.data_size);
+    } else if (chunks.codec == WEM_CODEC_IMA_ADPCM) {
+        uint32_t sub_block = chunks.block_align / chunks.channels;
+
+        if (chunks.bits_per_sample != 4 || chunks.block_align % chunks.channels != 0 || sub_block <= 4) {
+            perrf("Invalid IMA ADPCM block alignment\n");
+
+            return 1;
+        }
+
+        // A trailing partial block holds no complete frame and is dropped
+        size_t n_blocks = chunks.data_size / chunks.block_align;
+        size_t block_bytes = (size_t)(sub_block - 4) * 2 * chunks.channels * sizeof(int16_t);
+
+        if ((uint64_t)n_blocks * block_bytes > UINT32_MAX - (WAV_HEADER_SIZE - 8)) {
+            perrf("Decoded IMA ADPCM doesn't fit in a WAV\n");
+
+            return 1;
+        }
+
+        write_wav_header(header, chunks.channels, chunks.sample_rate, 16, (uint32_t)(n_blocks * block_bytes));
+        sink_write(out, header, WAV_HEADER_SIZE);
+
+        size_t batch = (block_bytes < IMA_DECODE_BYTES) ? IMA_DECODE_BYTES / block_bytes : 1;
+        int16_t* pcm = arena_alloc(scratch, batch * block_bytes);
+
+        for (size_t b = 0; b < n_blocks; b += batch) {
+            size_t n = (n_blocks - b < batch) ? n_blocks - b : batch;
+
+            decode_ima_blocks(&samples[b * chunks.block_align], n, chunks.channels, sub_block, pcm);
+            sink_write(out, (const uint8_t*)pcm, n * block_bytes);
+        }
+    } else {
+        perrf("Unsupported codec id 0x%04X\n", chunks.codec);
+
+        return 1;
+    }
+
+    if (out->error != 0) {
+        perrf("Error writing output: %i\n", out->error);
+
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "defs.h"
+#include "bitmanip.h"
+#include "sink.h"
+#include "wwriff.h"
+
+// Codec ids in the fmt chunk of a Wwise RIFF
+#define WEM_CODEC_PCM           0x0001
+#define WEM_CODEC_IMA_ADPCM     0x0002
+#define WEM_CODEC_EXTENSIBLE    0xFFFE
+#define WEM_CODEC_VORBIS        0xFFFF
+
+// Size of a WAV header with a plain PCM fmt chunk
+#define WAV_HEADER_SIZE 44
+
+// Returns the codec id in the fmt chunk of the RIFF in data, or 0 if it has no valid fmt chunk
+uint16_t wem_codec(membuf* data);
+
+// Checks whether entries with the codec are written by create_wav instead of create_ogg
+bool wem_is_wav(uint16_t codec);
+
+// Decodes n_blocks Wwise IMA ADPCM blocks of channels sub-blocks of sub_block bytes each into interleaved
+// 16 bit samples. Every sub-block holds (sub_block - 4) * 2 samples of its channel
+void decode_ima_blocks(const uint8_t* src, size_t n_blocks, unsigned int channels, uint32_t sub_block, int16_t* dst);
+
+// Writes the PCM or IMA ADPCM RIFF in data to out as a 16 bit PCM WAV. PCM data is passed through as is,
+// only the header is rewritten. Works in the buffers of ctx like create_ogg. Returns nonzero on invalid
+// input or when out reports an error
+errno_t create_wav(conversion_context* ctx, membuf* data, ogg_sink* out);
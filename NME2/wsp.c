@@ -0,0 +1,332 @@
+#include "wsp.h"
+#include "bitmanip.h"
+#include "cpu.h"
+#include "utils.h"
+
+#if CPU_X86
+#include <immintrin.h>
+#endif
+
+// Size of a RIFF header up to and including the WAVE signature
+#define RIFF_HEADER_SIZE 12
+
+// Minimum number of bytes read at once while a stream searches for the next header
+#define WSP_STREAM_CHUNK 0x10000
+
+// Index of the lowest set bit of a nonzero mask
+static inline uint32_t ctz32(uint32_t mask) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return index;
+#else
+    return (uint32_t)__builtin_ctz(mask);
+#endif
+}
+
+// Checks whether the bytes from start up to end are all zero
+static bool is_zero(const char* data, uint64_t start, uint64_t end) {
+    for (uint64_t i = start; i < end; i++) {
+        if (data[i] != 0) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Checks for a RIFF header at offset, which has to be at least RIFF_HEADER_SIZE bytes before the end
+static bool is_riff_header(const char* data, uint64_t offset) {
+    return memcmp(&data[offset], "RIFF", 4) == 0 && memcmp(&data[offset + 8], "WAVE", 4) == 0;
+}
+
+static uint64_t find_riff_header_scalar(const char* data, uint64_t size, uint64_t start) {
+    for (uint64_t i = start; i + RIFF_HEADER_SIZE <= size; i++) {
+        // memchr skips ahead to the next candidate
+        const char* r = memchr(&data[i], 'R', (size_t)(size - RIFF_HEADER_SIZE + 1 - i));
+        if (r == NULL) {
+            break;
+        }
+
+        i = (uint64_t)(r - data);
+        if (is_riff_header(data, i)) {
+            return i;
+        }
+    }
+
+    return size;
+}
+
+#if CPU_X86
+// Candidates are positions with an 'R' that has a 'W' 8 bytes later, which only the real headers
+// and the odd coincidence pass, so the full compare rarely runs
+TARGET("sse2")
+static uint64_t find_riff_header_sse2(const char* data, uint64_t size, uint64_t start) {
+    const __m128i r = _mm_set1_epi8('R');
+    const __m128i w = _mm_set1_epi8('W');
+
+    // Every lane's candidate has to leave room for a whole header, not just for its 'W'
+    uint64_t i = start;
+    for (; i + RIFF_HEADER_SIZE - 1 + 16 <= size; i += 16) {
+        __m128i first = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)&data[i]), r);
+        __m128i wave = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)&data[i + 8]), w);
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_and_si128(first, wave));
+
+        while (mask) {
+            uint64_t offset = i + ctz32(mask);
+            if (is_riff_header(data, offset)) {
+                return offset;
+            }
+
+            mask &= mask - 1;
+        }
+    }
+
+    return find_riff_header_scalar(data, size, i);
+}
+
+TARGET("avx2")
+static uint64_t find_riff_header_avx2(const char* data, uint64_t size, uint64_t start) {
+    const __m256i r = _mm256_set1_epi8('R');
+    const __m256i w = _mm256_set1_epi8('W');
+
+    uint64_t i = start;
+    for (; i + RIFF_HEADER_SIZE - 1 + 32 <= size; i += 32) {
+        __m256i first = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)&data[i]), r);
+        __m256i wave = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)&data[i + 8]), w);
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_and_si256(first, wave));
+
+        while (mask) {
+            uint64_t offset = i + ctz32(mask);
+            if (is_riff_header(data, offset)) {
+                return offset;
+            }
+
+            mask &= mask - 1;
+        }
+    }
+
+    return find_riff_header_sse2(data, size, i);
+}
+#endif
+
+uint64_t find_riff_header(const char* data, uint64_t size, uint64_t start) {
+#if CPU_X86
+    if (cpu_supports(CPU_AVX2)) {
+        return find_riff_header_avx2(data, size, start);
+    }
+
+    if (cpu_supports(CPU_SSE2)) {
+        return find_riff_header_sse2(data, size, start);
+    }
+#endif
+
+    return find_riff_header_scalar(data, size, start);
+}
+
+errno_t index_wsp(const char* data, uint64_t size, wsp_index* index) {
+    index->entries = NULL;
+    index->count = 0;
+
+    if (size < RIFF_HEADER_SIZE || !is_riff_header(data, 0)) {
+        perrf("WSP doesn't start with a RIFF header\n");
+
+        return 1;
+    }
+
+    uint64_t capacity = 0;
+    uint64_t offset = 0;
+
+    while (offset < size) {
+        if (index->count == capacity) {
+            capacity = capacity ? capacity * 2 : 64;
+            wsp_entry* entries = realloc(index->entries, capacity * sizeof(wsp_entry));
+
+            if (entries == NULL) {
+                perrf("Out of memory indexing WSP\n");
+
+                free_wsp_index(index);
+
+                return 1;
+            }
+
+            index->entries = entries;
+        }
+
+        uint64_t riff_size = (uint64_t)read_32_buf((unsigned char*)&data[offset + 4]) + 8;
+        uint64_t next = offset + riff_size;
+        uint64_t entry_size = riff_size;
+
+        // Entries are usually back to back. Otherwise there is padding or the size is damaged,
+        // and the next header has to be searched for
+        if (next > size || (next + RIFF_HEADER_SIZE <= size && !is_riff_header(data, next))) {
+            next = find_riff_header(data, size, offset + RIFF_HEADER_SIZE);
+
+            // Zeros after the declared size are padding, anything else means the size is wrong
+            if (offset + riff_size > next || !is_zero(data, offset + riff_size, next)) {
+                entry_size = next - offset;
+            }
+        } else if (next + RIFF_HEADER_SIZE > size) {
+            next = size;
+        }
+
+        wsp_entry* e = &index->entries[index->count++];
+        e->offset = offset;
+        e->size = entry_size;
+
+        offset = next;
+    }
+
+    return 0;
+}
+
+void free_wsp_index(wsp_index* index) {
+    free(index->entries);
+
+    index->entries = NULL;
+    index->count = 0;
+}
+
+wsp_stream new_wsp_stream(FILE* file) {
+    wsp_stream stream;
+
+    stream.file = file;
+    stream.data = NULL;
+    stream.capacity = 0;
+    stream.start = 0;
+    stream.end = 0;
+    stream.eof = false;
+    stream.count = 0;
+
+    return stream;
+}
+
+// Buffers at least n bytes from the current entry on, or everything up to the end of the input.
+// Returns nonzero on read errors
+static errno_t fill_wsp_stream(wsp_stream* stream, uint64_t n) {
+    if (stream->end - stream->start >= n || stream->eof) {
+        return 0;
+    }
+
+    // The previous entries are done with, so the current one is moved to the front
+    if (stream->start > 0) {
+        memmove(stream->data, &stream->data[stream->start], (size_t)(stream->end - stream->start));
+        stream->end -= stream->start;
+        stream->start = 0;
+    }
+
+    // The buffer grows along with what was actually read, so a damaged size can't make it allocate
+    // much more than the rest of the input
+    while (stream->end < n && !stream->eof) {
+        if (stream->end == stream->capacity) {
+            uint64_t capacity = stream->capacity * 2;
+            capacity = capacity < WSP_STREAM_CHUNK ? WSP_STREAM_CHUNK : capacity;
+            capacity = capacity > n ? n : capacity;
+
+            char* data = realloc(stream->data, (size_t)capacity);
+            if (data == NULL) {
+                perrf("Out of memory reading WSP entry of %llu bytes\n", n);
+
+                return 1;
+            }
+
+            stream->data = data;
+            stream->capacity = capacity;
+        }
+
+        // Only what's needed is read, so an entry can be converted as soon as it's in
+        uint64_t limit = n < stream->capacity ? n : stream->capacity;
+        size_t wanted = (size_t)(limit - stream->end);
+        size_t read = fread(&stream->data[stream->end], 1, wanted, stream->file);
+        stream->end += read;
+
+        if (read < wanted) {
+            if (ferror(stream->file)) {
+                perrf("Error reading WSP\n");
+
+                return 1;
+            }
+
+            stream->eof = true;
+        }
+    }
+
+    return 0;
+}
+
+errno_t next_wsp_entry(wsp_stream* stream, membuf* entry) {
+    *entry = new_membuf(NULL, 0);
+
+    if (fill_wsp_stream(stream, RIFF_HEADER_SIZE) != 0) {
+        return 1;
+    }
+
+    uint64_t available = stream->end - stream->start;
+    if (available < RIFF_HEADER_SIZE || !is_riff_header(stream->data, stream->start)) {
+        // Later entries always start at a header, so this is only the tail after the last one
+        if (stream->count == 0) {
+            perrf("WSP doesn't start with a RIFF header\n");
+
+            return 1;
+        }
+
+        stream->start = stream->end;
+
+        return 0;
+    }
+
+    uint64_t riff_size = (uint64_t)read_32_buf((unsigned char*)&stream->data[stream->start + 4]) + 8;
+
+    // The header of the next entry is read along, to tell whether the entries are back to back
+    if (fill_wsp_stream(stream, riff_size + RIFF_HEADER_SIZE) != 0) {
+        return 1;
+    }
+
+    const char* data = &stream->data[stream->start];
+    available = stream->end - stream->start;
+
+    uint64_t next = riff_size;
+    uint64_t entry_size = riff_size;
+
+    // Same recovery as index_wsp, except that the input is read on until the next header turns up
+    if (next > available || (next + RIFF_HEADER_SIZE <= available && !is_riff_header(data, next))) {
+        uint64_t from = RIFF_HEADER_SIZE;
+
+        while ((next = find_riff_header(data, available, from)) == available && !stream->eof) {
+            // A header can start in the last few bytes searched
+            if (available - (RIFF_HEADER_SIZE - 1) > from) {
+                from = available - (RIFF_HEADER_SIZE - 1);
+            }
+
+            if (fill_wsp_stream(stream, available + WSP_STREAM_CHUNK) != 0) {
+                return 1;
+            }
+
+            data = &stream->data[stream->start];
+            available = stream->end - stream->start;
+        }
+
+        if (riff_size > next || !is_zero(data, riff_size, next)) {
+            entry_size = next;
+        }
+    } else if (next + RIFF_HEADER_SIZE > available) {
+        next = available;
+    }
+
+    *entry = new_membuf(&stream->data[stream->start], entry_size);
+
+    // The entry's bytes stay in place until the next call refills the buffer
+    stream->start += next;
+    stream->count++;
+
+    return 0;
+}
+
+void free_wsp_stream(wsp_stream* stream) {
+    free(stream->data);
+
+    stream->data = NULL;
+    stream->capacity = 0;
+    stream->start = 0;
+    stream->end = 0;
+}
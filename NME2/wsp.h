@@ -0,0 +1,60 @@
+#pragma once
+
+#include "defs.h"
+#include "bitmanip.h"
+
+// An embedded RIFF file in a WSP
+typedef struct wsp_entry {
+    // Offset of the RIFF header in the WSP
+    uint64_t offset;
+
+    // Size of the entry, including its RIFF header. Truncated at the end of the WSP
+    uint64_t size;
+} wsp_entry;
+
+// The embedded files of a WSP, in file order
+typedef struct wsp_index {
+    wsp_entry* entries;
+    uint64_t count;
+} wsp_index;
+
+// Returns the offset of the first RIFF header at or after start, recognized by its RIFF and WAVE signatures,
+// or size if there is none. Never reads past size
+uint64_t find_riff_header(const char* data, uint64_t size, uint64_t start);
+
+// Indexes the RIFF files in the WSP data of size bytes by jumping from header to header using their
+// declared sizes. Padding and damaged sizes are recovered from by scanning for the next header.
+// Returns nonzero if data doesn't start with a RIFF
+errno_t index_wsp(const char* data, uint64_t size, wsp_index* index);
+
+// Frees the entries of a wsp_index
+void free_wsp_index(wsp_index* index);
+
+// Reads the RIFF files of a WSP one at a time from a sequential input. Only the current entry and the
+// start of the next one are buffered, so memory stays around the size of the largest entry
+typedef struct wsp_stream {
+    FILE* file;
+
+    // Buffered input, the current entry starts at start and the bytes read so far end at end
+    char* data;
+    uint64_t capacity;
+    uint64_t start;
+    uint64_t end;
+
+    // Whether the input has been read to its end
+    bool eof;
+
+    // Number of entries read so far
+    uint64_t count;
+} wsp_stream;
+
+// Creates a stream reading the WSP in file from its current position
+wsp_stream new_wsp_stream(FILE* file);
+
+// Reads the next RIFF file of the WSP into entry, which stays valid until the next call. Entries are split
+// like index_wsp does. entry is empty after the last one. Returns nonzero if the input can't be read or
+// doesn't start with a RIFF header
+errno_t next_wsp_entry(wsp_stream* stream, membuf* entry);
+
+// Frees the buffer of a wsp_stream, the file is left open
+void free_wsp_stream(wsp_stream* stream);
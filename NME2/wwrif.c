@@ -1,6 +1,184 @@
 #include "wwriff.h"
 
-errno_t create_ogg(membuf* data, FILE* out) {
+// An audio packet with its header and mode decoded
+typedef struct audio_packet {
+    // Offset of the payload
+    long offset;
+
+    // Offset of the header of the following packet
+    long next_offset;
+
+    uint32_t size;
+    uint32_t granule;
+
+    // Whether the packet's mode uses long windows
+    bool blockflag;
+} audio_packet;
+
+// Decodes the header of the audio packet at offset, which has to fit in the buffer, and looks up its mode
+static audio_packet read_audio_packet(membuf* data, long offset, packet_reader read_packet, uint32_t mode_mask,
+    const bool mode_blockflag[64]) {
+    Packet p = read_packet(data, offset);
+
+    audio_packet ap;
+    ap.offset = packet_offset(p);
+    ap.next_offset = packet_next_offset(p);
+    ap.size = p.size;
+    ap.granule = p.absolute_granule;
+    ap.blockflag = false;
+
+    if (ap.size > 0 && (uint64_t)ap.offset < data->size) {
+        ap.blockflag = mode_blockflag[(uint8_t)data->data[ap.offset] & mode_mask];
+    }
+
+    return ap;
+}
+
+// Rewrites a single Wwise audio packet into a Vorbis packet: the packet type bit is inserted in front,
+// and long windows also get the previous and next window flags after the mode number
+typedef void(*audio_packet_writer)(ogg_output_stream* os, const uint8_t* packet, uint32_t size,
+    bool blockflag, bool next_blockflag, bool* prev_blockflag);
+
+// Defines write_audio_packet_<MODE_BITS>_<LONG_WINDOWS>, with the number of mode bits and whether
+// the setup has any long window modes fixed at compile time so all the shifts and masks fold away
+#define DEFINE_AUDIO_PACKET_WRITER(MODE_BITS, LONG_WINDOWS) \
+static void write_audio_packet_##MODE_BITS##_##LONG_WINDOWS(ogg_output_stream* os, const uint8_t* packet, uint32_t size, \
+    bool blockflag, bool next_blockflag, bool* prev_blockflag) { \
+    if (size == 0) { \
+        return; \
+    } \
+    \
+    uint32_t mode = packet[0] & ((1U << (MODE_BITS)) - 1); \
+    uint32_t remainder = (uint32_t)packet[0] >> (MODE_BITS); \
+    \
+    if ((LONG_WINDOWS) && blockflag) { \
+        uint32_t windows = (uint32_t)*prev_blockflag | ((uint32_t)next_blockflag << 1); \
+        \
+        ogg_write(os, new_uint_var((mode << 1) | (windows << (1 + (MODE_BITS))) | (remainder << (3 + (MODE_BITS))), 11)); \
+        *prev_blockflag = true; \
+    } else { \
+        ogg_write(os, new_uint_var((mode << 1) | (remainder << (1 + (MODE_BITS))), 9)); \
+        *prev_blockflag = false; \
+    } \
+    \
+    /* The rest of the packet is copied as is, only shifted by the bits inserted above */ \
+    ogg_write_bytes(os, &packet[1], size - 1); \
+}
+
+DEFINE_AUDIO_PACKET_WRITER(0, 0)
+DEFINE_AUDIO_PACKET_WRITER(0, 1)
+DEFINE_AUDIO_PACKET_WRITER(1, 0)
+DEFINE_AUDIO_PACKET_WRITER(1, 1)
+DEFINE_AUDIO_PACKET_WRITER(2, 0)
+DEFINE_AUDIO_PACKET_WRITER(2, 1)
+DEFINE_AUDIO_PACKET_WRITER(3, 0)
+DEFINE_AUDIO_PACKET_WRITER(3, 1)
+DEFINE_AUDIO_PACKET_WRITER(4, 0)
+DEFINE_AUDIO_PACKET_WRITER(4, 1)
+DEFINE_AUDIO_PACKET_WRITER(5, 0)
+DEFINE_AUDIO_PACKET_WRITER(5, 1)
+DEFINE_AUDIO_PACKET_WRITER(6, 0)
+DEFINE_AUDIO_PACKET_WRITER(6, 1)
+
+// Copies an audio packet that already is a Vorbis packet, for encoders that don't strip the packets
+static void write_audio_packet_verbatim(ogg_output_stream* os, const uint8_t* packet, uint32_t size,
+    bool blockflag, bool next_blockflag, bool* prev_blockflag) {
+    UNUSED(blockflag);
+    UNUSED(next_blockflag);
+    UNUSED(prev_blockflag);
+
+    ogg_write_bytes(os, packet, size);
+}
+
+// Indexed by the number of mode bits (at most 64 modes) and whether any mode uses long windows
+static const audio_packet_writer audio_packet_writers[7][2] = {
+    { write_audio_packet_0_0, write_audio_packet_0_1 },
+    { write_audio_packet_1_0, write_audio_packet_1_1 },
+    { write_audio_packet_2_0, write_audio_packet_2_1 },
+    { write_audio_packet_3_0, write_audio_packet_3_1 },
+    { write_audio_packet_4_0, write_audio_packet_4_1 },
+    { write_audio_packet_5_0, write_audio_packet_5_1 },
+    { write_audio_packet_6_0, write_audio_packet_6_1 }
+};
+
+// Copies the identification, comment and setup headers that early encoders store as the first packets
+// of the data chunk, each on its own page. The audio packets have to follow at audio_offset
+static errno_t copy_header_triad(ogg_output_stream* os, membuf* data, packet_reader read_packet, uint32_t packet_header_size,
+    long offset, long audio_offset) {
+    static const uint8_t header_types[3] = { 1, 3, 5 };
+
+    for (int i = 0; i < 3; i++) {
+        if ((uint64_t)offset + packet_header_size > data->size) {
+            perrf("Header packet %i truncated\n", i);
+
+            return 1;
+        }
+
+        Packet p = read_packet(data, offset);
+
+        if ((uint64_t)packet_offset(p) + p.size > data->size) {
+            perrf("Header packet %i truncated\n", i);
+
+            return 1;
+        }
+
+        if (p.absolute_granule != 0) {
+            perrf("Header packet %i granule is not 0\n", i);
+
+            return 1;
+        }
+
+        const uint8_t* payload = (const uint8_t*)&data->data[packet_offset(p)];
+
+        if (p.size < 7 || payload[0] != header_types[i] || memcmp(&payload[1], "vorbis", 6) != 0) {
+            perrf("Expected Vorbis header of type %u\n", header_types[i]);
+
+            return 1;
+        }
+
+        ogg_write_bytes(os, payload, p.size);
+        flush_page(os, false, false);
+
+        offset = packet_next_offset(p);
+    }
+
+    if (offset != audio_offset) {
+        perrf("First audio packet doesn't follow setup packet\n");
+
+        return 1;
+    }
+
+    return 0;
+}
+
+conversion_context* new_conversion_context(void) {
+    conversion_context* ctx = malloc(sizeof(conversion_context));
+    if (ctx == NULL) {
+        perrf("Out of memory allocating the conversion context\n");
+
+        exit(1);
+    }
+
+    ctx->os = new_ogg_output_stream(NULL, 0);
+    ctx->scratch = new_arena(0);
+    ctx->setup = new_vorbis_setup();
+    ctx->out = new_fd_sink(-1);
+
+    return ctx;
+}
+
+void free_conversion_context(conversion_context* ctx) {
+    free_arena(&ctx->scratch);
+    free_vorbis_setup(&ctx->setup);
+    free_sink(&ctx->out);
+    free(ctx);
+}
+
+errno_t create_ogg(conversion_context* ctx, membuf* data, ogg_sink* out, uint32_t page_size) {
+    // Drops the temporaries of the previous conversion, including those of one that failed halfway
+    arena* scratch = &ctx->scratch;
+    reset_arena(scratch);
+
     // Check if the RIFF header is valid
     long riff_size = -1;
 
@@ -240,7 +418,38 @@ errno_t create_ogg(membuf* data, FILE* out) {
 
     uint32_t sample_count = read_32_membuf(data);
 
-    data->pos = vorb_offset + 0x10;
+    // The packet header layout and packet format changed between encoder generations: early ones store
+    // the full Vorbis headers in the data chunk and use 8 byte packet headers, later ones 6 byte headers
+    // and a stripped setup packet, and current ones 2 byte headers without granules
+    long packet_header_size = 2;
+    bool header_triad = false;
+    bool mod_packets = false;
+
+    switch (vorb_size) {
+        case -1:
+        case 0x2A: {
+            // Only set if the encoder also stripped the audio packets down, seen as 0xB2, 0xBC, 0xCB and 0xD9
+            uint32_t mod_signal = read_32_membuf(data);
+            mod_packets = mod_signal != 0x4A && mod_signal != 0x4B && mod_signal != 0x69 && mod_signal != 0x70;
+
+            data->pos = vorb_offset + 0x10;
+            break;
+        }
+        case 0x28:
+        case 0x2C:
+            packet_header_size = 8;
+            header_triad = true;
+
+            data->pos = vorb_offset + 0x18;
+            break;
+        default:
+            packet_header_size = 6;
+
+            data->pos = vorb_offset + 0x18;
+            break;
+    }
+
+    packet_reader read_packet = get_packet_reader(packet_header_size);
 
     uint32_t setup_packet_offset = read_32_membuf(data);
     uint32_t first_audio_packet_offset = read_32_membuf(data);
@@ -284,458 +493,129 @@ errno_t create_ogg(membuf* data, FILE* out) {
         }
     }
 
-    ogg_output_stream os = new_ogg_output_stream(out);
+    ogg_output_stream* os = &ctx->os;
+    reset_ogg_output_stream(os, out, page_size);
+
+    // Invalid mode numbers in audio packets read as short windows
+    bool mode_blockflag[64] = { false };
+    int mode_bits = 0;
+    bool prev_blockflag = false;
+    audio_packet_writer write_audio_packet = NULL;
+
+    // Early encoders store complete Vorbis headers in the data chunk, which are copied as they are
+    if (header_triad && copy_header_triad(os, data, read_packet, packet_header_size, data_offset + setup_packet_offset,
+        data_offset + first_audio_packet_offset) != 0) {
+        return 1;
+    }
 
     // ID packet
-    {
-        ogg_write_vph(&os, 1);
+    if (!header_triad) {
+        ogg_write_vph(os, 1);
 
         uint_var version = new_uint_var(0, 32);
-        ogg_write(&os, version);
+        ogg_write(os, version);
 
         uint_var ch = new_uint_var(channels, 8);
-        ogg_write(&os, ch);
+        ogg_write(os, ch);
 
         uint_var srate = new_uint_var(sample_rate, 32);
-        ogg_write(&os, srate);
+        ogg_write(os, srate);
 
         uint_var bitrate_max = new_uint_var(0, 32);
-        ogg_write(&os, bitrate_max);
+        ogg_write(os, bitrate_max);
 
         uint_var bitrate_nominal = new_uint_var(avg_bytes_per_second * 8, 32);
-        ogg_write(&os, bitrate_nominal);
+        ogg_write(os, bitrate_nominal);
 
         uint_var bitrate_minimum = new_uint_var(0, 32);
-        ogg_write(&os, bitrate_minimum);
+        ogg_write(os, bitrate_minimum);
 
         uint_var blocksize_0 = new_uint_var(blocksize_0_pow, 4);
-        ogg_write(&os, blocksize_0);
+        ogg_write(os, blocksize_0);
 
         uint_var blocksize_1 = new_uint_var(blocksize_1_pow, 4);
-        ogg_write(&os, blocksize_1);
+        ogg_write(os, blocksize_1);
 
         uint_var framing = new_uint_var(1, 1);
-        ogg_write(&os, framing);
+        ogg_write(os, framing);
 
-        flush_page(&os, false, false);
+        flush_page(os, false, false);
     }
 
     // Comment packet
-    {
-        ogg_write_vph(&os, 3);
+    if (!header_triad) {
+        ogg_write_vph(os, 3);
 
         const char vendor[] = "Converted using NME2";
         uint_var vendor_size = new_uint_var((uint32_t)strlen(vendor), 32);
-        ogg_write(&os, vendor_size);
+        ogg_write(os, vendor_size);
 
         for (unsigned int i = 0; i < vendor_size.value; i++) {
             uint_var c = new_uint_var(vendor[i], 8);
-            ogg_write(&os, c);
+            ogg_write(os, c);
         }
 
         if (loop_count == 0) {
             uint_var user_comment_count = new_uint_var(0, 32);
-            ogg_write(&os, user_comment_count);
+            ogg_write(os, user_comment_count);
         } else {
             uint_var user_comment_count = new_uint_var(2, 32);
-            ogg_write(&os, user_comment_count);
+            ogg_write(os, user_comment_count);
 
-            char* loop_start_str = malloc(21);
-            char* loop_end_str = malloc(19);
+            char* loop_start_str = arena_alloc(scratch, 21);
+            char* loop_end_str = arena_alloc(scratch, 19);
 
             sprintf_s(loop_start_str, 21, "LoopStart=%i", loop_start);
             sprintf_s(loop_end_str, 19, "LoopEnd=%i", loop_end);
 
             uint_var loop_start_comment_length = new_uint_var((uint32_t)strlen(loop_start_str), 32);
-            ogg_write(&os, loop_start_comment_length);
+            ogg_write(os, loop_start_comment_length);
 
             for (unsigned int i = 0; i < loop_start_comment_length.value; i++) {
                 uint_var c = new_uint_var(loop_start_str[i], 8);
-                ogg_write(&os, c);
+                ogg_write(os, c);
             }
         }
 
         uint_var framing = new_uint_var(1, 1);
-        ogg_write(&os, framing);
+        ogg_write(os, framing);
 
-        flush_page(&os, false, false);
+        flush_page(os, false, false);
     }
 
-    bool* mode_blockflag = NULL;
-    int mode_bits = 0;
-    bool prev_blockflag = false;
     // Setup packet
-    {
-        ogg_write_vph(&os, 5);
-
-        Packet setup_packet = packet(data, data_offset + setup_packet_offset);
+    if (!header_triad) {
+        ogg_write_vph(os, 5);
 
-        data->pos = packet_offset(setup_packet);
-
-        if (setup_packet.absolute_granule != 0) {
-            perrf("Setup packet granule is not 0");
+        if ((uint64_t)data_offset + setup_packet_offset + packet_header_size > data->size) {
+            perrf("Setup packet truncated\n");
 
             return 1;
         }
 
-        bit_stream ss = new_bit_stream(data);
-
-        uint_var codebook_count_less1 = new_uint_var(0, 8);
-        bs_read(&ss, &codebook_count_less1);
-
-        unsigned int codebook_count = codebook_count_less1.value + 1;
-
-        ogg_write(&os, codebook_count_less1);
-
-        codebook_library cbl;
-        cbl.codebook_count = CODEBOOK_COUNT;
-        cbl.codebook_data = malloc(OFFSET_OFFSET);
-        cbl.codebook_offsets = malloc(CODEBOOK_COUNT * sizeof(long));
+        Packet setup_packet = read_packet(data, data_offset + setup_packet_offset);
 
-        memcpy_s(&cbl.codebook_data[0], OFFSET_OFFSET, &pcb[0], OFFSET_OFFSET);
+        if (setup_packet.absolute_granule != 0) {
+            perrf("Setup packet granule is not 0");
 
-        for (long i = 0; i < CODEBOOK_COUNT; i++) {
-            cbl.codebook_offsets[i] = read_32_buf((char*)&pcb[OFFSET_OFFSET + i * 4]);
+            return 1;
         }
 
-        for (unsigned int i = 0; i < codebook_count; i++) {
-            uint_var codebook_id = new_uint_var(0, 10);
-            bs_read(&ss, &codebook_id);
-            unsigned long cb_size = cbl.codebook_offsets[codebook_id.value + 1] - cbl.codebook_offsets[codebook_id.value];
-
-            //bit_stream_mem bsm = bit_stream_mem(&cbl.codebook_data[cbl.codebook_offsets[codebook_id.value]], cb_size);
-            membuf buf;
-            buf.data = &cbl.codebook_data[cbl.codebook_offsets[codebook_id.value]];
-            buf.size = cb_size;
-            buf.pos = 0;
-
-            bit_stream stream = new_bit_stream(&buf);
+        // Identical setup packets come out of the cache instead of being rebuilt
+        vorbis_setup* setup = &ctx->setup;
+        reset_vorbis_setup(setup);
 
-            parse_codebook(&stream, cb_size, &os);
+        if (get_vorbis_setup(data, setup_packet, channels, scratch, setup) != 0) {
+            return 1;
         }
 
-        uint_var time_count_less1 = new_uint_var(0, 6);
-        ogg_write(&os, time_count_less1);
-        uint_var dummy_time_value = new_uint_var(0, 16);
-        ogg_write(&os, dummy_time_value);
-        {
-            uint_var floor_count_less1 = new_uint_var(0, 6);
-            bs_read(&ss, &floor_count_less1);
-            unsigned int floor_count = floor_count_less1.value + 1;
-            ogg_write(&os, floor_count_less1);
-
-
-            for (unsigned int i = 0; i < floor_count; i++) {
-                uint_var floor_type = new_uint_var(1, 16);
-                ogg_write(&os, floor_type);
-
-                uint_var floor1_partitions = new_uint_var(0, 5);
-                bs_read(&ss, &floor1_partitions);
-                ogg_write(&os, floor1_partitions);
-
-                unsigned int* floor1_partition_class_list = malloc(floor1_partitions.value * sizeof(unsigned int));
-
-                unsigned int maximum_class = 0;
-                for (unsigned int j = 0; j < floor1_partitions.value; j++) {
-                    uint_var floor1_partition_class = new_uint_var(0, 4);
-                    bs_read(&ss, &floor1_partition_class);
-                    ogg_write(&os, floor1_partition_class);
-
-                    floor1_partition_class_list[j] = floor1_partition_class.value;
-
-                    if (floor1_partition_class.value > maximum_class) {
-                        maximum_class = floor1_partition_class.value;
-                    }
-                }
-
-                unsigned int* floor1_class_dimensions_list = malloc((maximum_class + 1) * sizeof(unsigned int));
-
-                for (unsigned int j = 0; j <= maximum_class; j++) {
-                    uint_var class_dimensions_less_1 = new_uint_var(0, 3);
-                    bs_read(&ss, &class_dimensions_less_1);
-                    ogg_write(&os, class_dimensions_less_1);
+        ogg_write_bits(os, setup->bits.data, setup->bits.n_bits);
 
-                    floor1_class_dimensions_list[j] = class_dimensions_less_1.value + 1;
+        memcpy(mode_blockflag, setup->mode_blockflag, sizeof(mode_blockflag));
+        mode_bits = setup->mode_bits;
+        write_audio_packet = audio_packet_writers[mode_bits][setup->long_windows];
 
-                    uint_var class_subclasses = new_uint_var(0, 2);
-                    bs_read(&ss, &class_subclasses);
-                    ogg_write(&os, class_subclasses);
-
-                    if (class_subclasses.value != 0) {
-                        uint_var masterbook = new_uint_var(0, 8);
-                        bs_read(&ss, &masterbook);
-                        ogg_write(&os, masterbook);
-
-                        if (masterbook.value >= codebook_count) {
-                            perrf("Invalid floor1 masterbook\n");
-
-                            return 1;
-                        }
-                    }
-
-                    for (unsigned int k = 0; k < (1U << class_subclasses.value); k++) {
-                        uint_var subclass_book_plus1 = new_uint_var(0, 8);
-                        bs_read(&ss, &subclass_book_plus1);
-                        ogg_write(&os, subclass_book_plus1);
-
-                        int subclass_book = ((int)subclass_book_plus1.value) - 1;
-
-                        if (subclass_book >= 0 && (unsigned int)subclass_book >= codebook_count) {
-                            perrf("Invalid floor1 subclass book\n");
-
-                            return 1;
-                        }
-                    }
-                }
-
-                uint_var floor1_multiplier_less1 = new_uint_var(0, 2);
-                bs_read(&ss, &floor1_multiplier_less1);
-                ogg_write(&os, floor1_multiplier_less1);
-
-                uint_var rangebits = new_uint_var(0, 4);
-                bs_read(&ss, &rangebits);
-                ogg_write(&os, rangebits);
-
-                for (unsigned int j = 0; j < floor1_partitions.value; j++) {
-                    unsigned int current_class_number = floor1_partition_class_list[j];
-
-                    for (unsigned int k = 0; k < floor1_class_dimensions_list[current_class_number]; k++) {
-                        uint_var X = new_uint_var(0, rangebits.value);
-                        bs_read(&ss, &X);
-                        ogg_write(&os, X);
-                    }
-                }
-
-                free(floor1_class_dimensions_list);
-                free(floor1_partition_class_list);
-            }
-
-            // Residue count
-            uint_var residue_count_less1 = new_uint_var(0, 6);
-            bs_read(&ss, &residue_count_less1);
-            unsigned int residue_count = residue_count_less1.value + 1;
-            ogg_write(&os, residue_count_less1);
-
-            // Rebuild residues
-            for (unsigned int i = 0; i < residue_count; i++) {
-                uint_var residue_type = new_uint_var(0, 2);
-                bs_read(&ss, &residue_type);
-                ogg_write(&os, new_uint_var(residue_type.value, 16));
-
-                if (residue_type.value > 2) {
-                    perrf("Invalid residue type");
-
-                    return 1;
-                }
-
-                uint_var residue_begin = new_uint_var(0, 24);
-                uint_var residue_end = new_uint_var(0, 24);
-                uint_var residue_partition_size_less1 = new_uint_var(0, 24);
-                uint_var residue_classifications_less1 = new_uint_var(0, 6);
-                uint_var residue_classbook = new_uint_var(0, 8);
-
-                bs_read(&ss, &residue_begin);
-                bs_read(&ss, &residue_end);
-                bs_read(&ss, &residue_partition_size_less1);
-                bs_read(&ss, &residue_classifications_less1);
-                bs_read(&ss, &residue_classbook);
-
-                unsigned int residue_classifications = residue_classifications_less1.value + 1;
-
-                ogg_write(&os, residue_begin);
-                ogg_write(&os, residue_end);
-                ogg_write(&os, residue_partition_size_less1);
-                ogg_write(&os, residue_classifications_less1);
-                ogg_write(&os, residue_classbook);
-
-                if (residue_classbook.value >= codebook_count) {
-                    perrf("Invalid residue classbook\n");
-
-                    return 1;
-                }
-
-                unsigned int* residue_cascade = malloc(residue_classifications * sizeof(unsigned int));
-
-                for (unsigned int j = 0; j < residue_classifications; j++) {
-                    uint_var high_bits = new_uint_var(0, 5);
-                    uint_var low_bits = new_uint_var(0, 3);
-
-                    bs_read(&ss, &low_bits);
-                    ogg_write(&os, low_bits);
-
-                    uint_var bitflag = new_uint_var(0, 1);
-                    bs_read(&ss, &bitflag);
-                    ogg_write(&os, bitflag);
-
-                    if (bitflag.value) {
-                        bs_read(&ss, &high_bits);
-                        ogg_write(&os, high_bits);
-                    }
-
-                    residue_cascade[j] = high_bits.value * 8 + low_bits.value;
-                }
-
-                for (unsigned int j = 0; j < residue_classifications; j++) {
-                    for (unsigned int k = 0; k < 8; k++) {
-                        if (residue_cascade[j] & (1 << k)) {
-                            uint_var residue_book = new_uint_var(0, 8);
-                            bs_read(&ss, &residue_book);
-                            ogg_write(&os, residue_book);
-
-                            if (residue_book.value >= codebook_count) {
-                                perrf("Invalid residue book\n");
-
-                                return 1;
-                            }
-                        }
-                    }
-                }
-
-                free(residue_cascade);
-            }
-
-            // Mapping count
-            uint_var mapping_count_less1 = new_uint_var(0, 6);
-            bs_read(&ss, &mapping_count_less1);
-            unsigned int mapping_count = mapping_count_less1.value + 1;
-            ogg_write(&os, mapping_count_less1);
-
-            for (unsigned int i = 0; i < mapping_count; i++) {
-                uint_var mapping_type = new_uint_var(0, 16);
-                ogg_write(&os, mapping_type);
-
-                uint_var submaps_flag = new_uint_var(0, 1);
-                bs_read(&ss, &submaps_flag);
-                ogg_write(&os, submaps_flag);
-
-                unsigned int submaps = 1;
-                if (submaps_flag.value) {
-                    uint_var submaps_less1 = new_uint_var(0, 4);
-
-                    bs_read(&ss, &submaps_less1);
-                    submaps = submaps_less1.value + 1;
-                    ogg_write(&os, submaps_less1);
-                }
-
-                uint_var square_polar_flag = new_uint_var(0, 1);
-                bs_read(&ss, &square_polar_flag);
-                ogg_write(&os, square_polar_flag);
-
-                if (square_polar_flag.value) {
-                    uint_var coupling_steps_less1 = new_uint_var(0, 8);
-                    bs_read(&ss, &coupling_steps_less1);
-                    unsigned int coupling_steps = coupling_steps_less1.value + 1;
-                    ogg_write(&os, coupling_steps_less1);
-
-                    for (unsigned int j = 0; j < coupling_steps; j++) {
-                        uint_var magnitude = new_uint_var(0, ilog(channels - 1));
-                        uint_var angle = new_uint_var(0, ilog(channels - 1));
-
-                        bs_read(&ss, &magnitude);
-                        bs_read(&ss, &angle);
-
-                        ogg_write(&os, magnitude);
-                        ogg_write(&os, angle);
-
-
-                        if (angle.value == magnitude.value || magnitude.value >= channels || angle.value >= channels) {
-                            perrf("Invalid coupling\n");
-
-                            return 1;
-                        }
-                    }
-                }
-
-                uint_var mapping_reserved = new_uint_var(0, 2);
-                bs_read(&ss, &mapping_reserved);
-                ogg_write(&os, mapping_reserved);
-                if (mapping_reserved.value != 0) {
-                    perrf("Mapping reserved field nonzero\n");
-
-                    return 1;
-                }
-
-                if (submaps > 1) {
-                    for (unsigned int j = 0; j < channels; j++) {
-                        uint_var mapping_mux = new_uint_var(0, 4);
-                        bs_read(&ss, &mapping_mux);
-                        ogg_write(&os, mapping_mux);
-
-                        if (mapping_mux.value >= submaps) {
-                            perrf("mapping_mux >= submaps\n");
-
-                            return 1;
-                        }
-                    }
-                }
-
-                for (unsigned int j = 0; j < submaps; j++) {
-                    uint_var time_config = new_uint_var(0, 8);
-                    bs_read(&ss, &time_config);
-                    ogg_write(&os, time_config);
-
-                    uint_var floor_number = new_uint_var(0, 8);
-                    bs_read(&ss, &floor_number);
-                    ogg_write(&os, floor_number);
-                    if (floor_number.value >= floor_count) {
-                        perrf("Invalid floor mapping\n");
-
-                        return 1;
-                    }
-
-                    uint_var residue_number = new_uint_var(0, 8);
-                    bs_read(&ss, &residue_number);
-                    ogg_write(&os, residue_number);
-                    if (residue_number.value >= residue_count) {
-                        perrf("Invalid residue mapping\n");
-
-                        return 1;
-                    }
-                }
-            }
-
-            // Mode count
-            uint_var mode_count_less1 = new_uint_var(0, 6);
-            bs_read(&ss, &mode_count_less1);
-            unsigned int mode_count = mode_count_less1.value + 1;
-            ogg_write(&os, mode_count_less1);
-
-
-            mode_blockflag = malloc(mode_count * sizeof(bool));
-            mode_bits = ilog(mode_count - 1);
-
-            for (unsigned int i = 0; i < mode_count; i++) {
-                uint_var block_flag = new_uint_var(0, 1);
-                bs_read(&ss, &block_flag);
-                ogg_write(&os, block_flag);
-
-                mode_blockflag[i] = (block_flag.value != 0);
-
-                uint_var windowtype = new_uint_var(0, 16);
-                uint_var transformtype = new_uint_var(0, 16);
-                ogg_write(&os, windowtype);
-                ogg_write(&os, transformtype);
-
-                uint_var mapping = new_uint_var(0, 8);
-                bs_read(&ss, &mapping);
-                ogg_write(&os, mapping);
-                if (mapping.value >= mapping_count) {
-                    perrf("Invalid mode mapping\n");
-
-                    return 1;
-                }
-            }
-
-            uint_var framing = new_uint_var(1, 1);
-            ogg_write(&os, framing);
-        }
-        flush_page(&os, false, false);
-
-        if ((ss.total_bits_read + 7) / 8 != setup_packet.size) {
-            perrf("Didn't fully read setup packet\n");
-
-            return 1;
-        }
+        flush_page(os, false, false);
 
         if (packet_next_offset(setup_packet) != data_offset + (long)first_audio_packet_offset) {
             perrf("First audio packet doesn't follow setup packet\n");
@@ -744,113 +624,80 @@ errno_t create_ogg(membuf* data, FILE* out) {
         }
     }
 
+    // Audio packets that are complete Vorbis packets need no mode information
+    if (!mod_packets) {
+        write_audio_packet = write_audio_packet_verbatim;
+    }
+
     // Audio pages
     {
         long offset = data_offset + first_audio_packet_offset;
+        uint32_t mode_mask = (1U << mode_bits) - 1;
 
-        while (offset < data_offset + data_size) {
-            Packet audio_packet = packet(data, offset);
-            long packet_header_size = 2;
-            uint32_t size = audio_packet.size;
-            long packet_payload_offset = packet_offset(audio_packet);
-            uint32_t granule = audio_packet.absolute_granule;
-            long next_offset = packet_next_offset(audio_packet);
+        if (!write_audio_packet) {
+            perrf("Didn't load mode_blockflag\n");
+
+            return 1;
+        }
 
+        // Every header is decoded once, as the lookahead of the packet before it
+        audio_packet next = { 0 };
+        if (offset + packet_header_size <= data_offset + data_size) {
+            next = read_audio_packet(data, offset, read_packet, mode_mask, mode_blockflag);
+        }
+
+        while (offset < data_offset + data_size) {
             if (offset + packet_header_size > data_offset + data_size) {
                 perrf("Page header truncated\n");
 
                 return 1;
             }
 
-            offset = packet_payload_offset;
+            audio_packet current = next;
 
-            data->pos = offset;
-
-            if (granule == UINT32_C(0xFFFFFFFF)) {
-                os.granule = 1;
-            } else {
-                os.granule = granule;
-            }
-
-            // First byte
-            if (!mode_blockflag) {
-                perrf("Didn't load mode_blockflag\n");
+            if ((uint64_t)current.offset + current.size > data->size) {
+                perrf("File truncated: %li %u\n", current.offset, current.size);
 
                 return 1;
             }
 
-            uint_var packet_type = new_uint_var(0, 1);
-            ogg_write(&os, packet_type);
-
-            uint_var* mode_number_p = malloc(sizeof(uint_var));
-            uint_var* remainder_p = malloc(sizeof(uint_var));
-
-            {
-                bit_stream ss = new_bit_stream(data);
-                *mode_number_p = new_uint_var(0, mode_bits);
-
-                bs_read(&ss, mode_number_p);
-                ogg_write(&os, *mode_number_p);
-
-                *remainder_p = new_uint_var(0, 8 - mode_bits);
-                bs_read(&ss, remainder_p);
+            // Only long windows need the mode of the next packet, a missing or empty one counts as short
+            bool next_blockflag = false;
+            if (current.next_offset + packet_header_size <= data_offset + data_size) {
+                next = read_audio_packet(data, current.next_offset, read_packet, mode_mask, mode_blockflag);
+                next_blockflag = next.blockflag;
             }
 
-            if (mode_blockflag[mode_number_p->value]) {
-                data->pos = next_offset;
-                bool next_blockflag = false;
-                if (next_offset + packet_header_size <= data_offset + data_size) {
-                    Packet audio_packet = packet(data, next_offset);
-                    uint32_t next_packet_size = audio_packet.size;
-
-                    if (next_packet_size > 0) {
-                        data->pos = packet_offset(audio_packet);
-
-                        bit_stream ss = new_bit_stream(data);
-                        uint_var next_mode_number = new_uint_var(0, mode_bits);
-
-                        bs_read(&ss, &next_mode_number);
-
-                        next_blockflag = mode_blockflag[next_mode_number.value];
-                    }
-                }
-
-                uint_var prev_window_type = new_uint_var(prev_blockflag, 1);
-                ogg_write(&os, prev_window_type);
-
-                uint_var next_window_type = new_uint_var(next_blockflag, 1);
-                ogg_write(&os, next_window_type);
-                data->pos = offset + 1;
+            if (current.granule == UINT32_C(0xFFFFFFFF)) {
+                os->granule = 1;
+            } else {
+                os->granule = current.granule;
             }
 
-            prev_blockflag = mode_blockflag[mode_number_p->value];
-            free(mode_number_p);
-            ogg_write(&os, *remainder_p);
-            free(remainder_p);
-
-            for (unsigned int i = 1; i < size; i++) {
-                int v = membufgetc(data);
-                if (v < 0) {
-                    perrf("File truncated: %i %i\n", v, i);
-
-                    return 1;
-                }
+            // The rewritten packet grows by at most one byte
+            ogg_reserve_packet(os, current.size + 1);
 
-                uint_var c = new_uint_var(v, 8);
-                ogg_write(&os, c);
-            }
+            write_audio_packet(os, (const uint8_t*)&data->data[current.offset], current.size,
+                current.blockflag, next_blockflag, &prev_blockflag);
 
-            offset = next_offset;
-            flush_page(&os, (offset == data_offset + data_size), false);
+            offset = current.next_offset;
+            ogg_end_packet(os);
         }
 
+        flush_page(os, false, false);
+
         if (offset > data_offset + data_size) {
             perrf("Page truncated\n");
 
             return 1;
         }
     }
-    free(mode_blockflag);
+
+    if (out->error != 0) {
+        perrf("Error writing output: %i\n", out->error);
+
+        return 1;
+    }
 
     return 0;
 }
\ No newline at end of file
@@ -2,6 +2,32 @@
 
 #include "defs.h"
 #include "bitmanip.h"
+#include "arena.h"
+#include "setup.h"
 
-// Creates an ogg
-errno_t create_ogg(membuf* data, FILE* out);
\ No newline at end of file
+// The buffers create_ogg works in. A worker allocates one and reuses it for every conversion,
+// so the buffers stay allocated and warm in the cache
+typedef struct conversion_context {
+    // Output stream, its page buffer makes up most of the context
+    ogg_output_stream os;
+
+    // Temporaries of the current conversion
+    arena scratch;
+
+    // The rebuilt setup header, its buffer keeps the size of the largest header so far
+    vorbis_setup setup;
+
+    // Sink for output to a file descriptor, rebound with reset_fd_sink for every conversion
+    ogg_sink out;
+} conversion_context;
+
+// Allocates a conversion_context. Exits on out of memory
+conversion_context* new_conversion_context(void);
+
+// Frees a conversion_context and its buffers
+void free_conversion_context(conversion_context* ctx);
+
+// Creates an ogg and writes it to out, packing audio packets into pages of about page_size bytes
+// (0 for one page per packet). Works in the buffers of ctx, which only needs to be reset between
+// conversions. Returns nonzero on invalid input or when out reports an error
+errno_t create_ogg(conversion_context* ctx, membuf* data, ogg_sink* out, uint32_t page_size);
\ No newline at end of file
@@ -0,0 +1,83 @@
+// Generates pcb_expanded.c from pcb[]: the offset table of the packed codebooks and every codebook
+// expanded to a full Vorbis codebook, so NME2 doesn't have to do either at runtime.
+// Usage: codebook_gen <output file>
+
+#include "defs.h"
+#include "utils.h"
+#include "bitmanip.h"
+
+// Number of values per line of the generated arrays
+#define VALUES_PER_LINE 21
+
+int main(int argc, char* argv[]) {
+    if (argc != 2) {
+        perrf("Usage: codebook_gen <output file>\n");
+
+        return 1;
+    }
+
+    uint32_t offsets[CODEBOOK_COUNT];
+    for (uint32_t i = 0; i < CODEBOOK_COUNT; i++) {
+        offsets[i] = read_32_buf((unsigned char*)&pcb[OFFSET_OFFSET + i * 4]);
+    }
+
+    // All codebooks start on a byte boundary in the expanded data
+    bit_writer expanded[CODEBOOK_COUNT - 1];
+    uint64_t expanded_offsets[CODEBOOK_COUNT - 1];
+    uint64_t expanded_bits[CODEBOOK_COUNT - 1];
+    uint64_t expanded_size = 0;
+
+    for (uint32_t i = 0; i < CODEBOOK_COUNT - 1; i++) {
+        membuf buf = new_membuf((char*)&pcb[offsets[i]], offsets[i + 1] - offsets[i]);
+
+        bit_stream bs = new_bit_stream(&buf);
+        expanded[i] = new_bit_writer();
+
+        parse_codebook(&bs, (int)buf.size, &expanded[i]);
+
+        expanded_offsets[i] = expanded_size;
+        expanded_bits[i] = expanded[i].n_bits;
+        expanded_size += (expanded[i].n_bits + 7) / 8;
+    }
+
+    FILE* out;
+    if (fopen_s(&out, argv[1], "w") != 0) {
+        perrf("Can't open '%s' for writing\n", argv[1]);
+
+        return 1;
+    }
+
+    fprintf(out, "// Generated by codebook_gen from pcb.c, do not edit\n\n");
+    fprintf(out, "#include \"codebook.h\"\n\n");
+
+    fprintf(out, "const uint32_t pcb_offsets[CODEBOOK_COUNT] = {");
+    for (uint32_t i = 0; i < CODEBOOK_COUNT; i++) {
+        fprintf(out, "%s%u,", (i % VALUES_PER_LINE == 0) ? "\n    " : "", offsets[i]);
+    }
+    fprintf(out, "\n};\n\n");
+
+    fprintf(out, "static const unsigned char pcb_expanded_data[] = {");
+    uint64_t n = 0;
+    for (uint32_t i = 0; i < CODEBOOK_COUNT - 1; i++) {
+        for (uint64_t j = 0; j < (expanded[i].n_bits + 7) / 8; j++, n++) {
+            fprintf(out, "%s%u,", (n % VALUES_PER_LINE == 0) ? "\n    " : "", expanded[i].data[j]);
+        }
+
+        free_bit_writer(&expanded[i]);
+    }
+    fprintf(out, "\n};\n\n");
+
+    fprintf(out, "const expanded_codebook pcb_expanded[CODEBOOK_COUNT - 1] = {\n");
+    for (uint32_t i = 0; i < CODEBOOK_COUNT - 1; i++) {
+        fprintf(out, "    { &pcb_expanded_data[%llu], %llu },\n", expanded_offsets[i], expanded_bits[i]);
+    }
+    fprintf(out, "};\n");
+
+    if (fclose(out) != 0) {
+        perrf("Error writing '%s'\n", argv[1]);
+
+        return 1;
+    }
+
+    return 0;
+}